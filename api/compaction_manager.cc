@@ -94,6 +94,32 @@ void set_compaction_manager(http_context& ctx, routes& r, sharded<compaction_man
         });
     });
 
+    cm::get_read_amplification_by_table.set(r, [&ctx] (std::unique_ptr<http::request> req) {
+        return ctx.db.map_reduce0([](replica::database& db) {
+            return do_with(std::unordered_map<std::pair<sstring, sstring>, uint64_t, utils::tuple_hash>(), [&db](std::unordered_map<std::pair<sstring, sstring>, uint64_t, utils::tuple_hash>& scores) {
+                return db.get_tables_metadata().for_each_table_gently([&scores] (table_id, lw_shared_ptr<replica::table> table) -> future<> {
+                    replica::table& cf = *table.get();
+                    scores[std::make_pair(cf.schema()->ks_name(), cf.schema()->cf_name())] = cf.read_amplification_score();
+                    return make_ready_future<>();
+                }).then([&scores] {
+                    return std::move(scores);
+                });
+            });
+        }, std::unordered_map<std::pair<sstring, sstring>, uint64_t, utils::tuple_hash>(), sum_pending_tasks).then(
+                [](const std::unordered_map<std::pair<sstring, sstring>, uint64_t, utils::tuple_hash>& score_map) {
+            std::vector<cm::read_amplification> res;
+            res.reserve(score_map.size());
+            for (auto i : score_map) {
+                cm::read_amplification score;
+                score.ks = i.first.first;
+                score.cf = i.first.second;
+                score.score = i.second;
+                res.emplace_back(std::move(score));
+            }
+            return make_ready_future<json::json_return_type>(res);
+        });
+    });
+
     cm::force_user_defined_compaction.set(r, [] (std::unique_ptr<http::request> req) {
         //TBD
         // FIXME
@@ -229,6 +255,7 @@ void set_compaction_manager(http_context& ctx, routes& r, sharded<compaction_man
 void unset_compaction_manager(http_context& ctx, routes& r) {
     cm::get_compactions.unset(r);
     cm::get_pending_tasks_by_table.unset(r);
+    cm::get_read_amplification_by_table.unset(r);
     cm::force_user_defined_compaction.unset(r);
     cm::stop_compaction.unset(r);
     cm::stop_keyspace_compaction.unset(r);
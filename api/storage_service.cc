@@ -13,6 +13,7 @@
 #include "api/api-doc/storage_proxy.json.hh"
 #include "api/scrub_status.hh"
 #include "db/config.hh"
+#include "db/hot_partitions.hh"
 #include "db/schema_tables.hh"
 #include "gms/feature_service.hh"
 #include "schema/schema_builder.hh"
@@ -620,6 +621,32 @@ rest_toppartitions_generic(http_context& ctx, std::unique_ptr<http::request> req
         });
 }
 
+static
+future<json::json_return_type>
+rest_get_hot_partitions(http_context& ctx, std::unique_ptr<http::request> req) {
+        api::req_param<unsigned> list_size(*req, "list_size", 10);
+        if (list_size.value > db::hot_partitions_tracker::capacity) {
+            throw bad_param_exception(fmt::format("list_size must not exceed {}", db::hot_partitions_tracker::capacity));
+        }
+        auto hot = co_await db::get_hot_partitions(ctx.db, list_size.value);
+        auto to_json = [] (const std::vector<db::hot_partition>& list, auto& out) {
+            for (auto& p : list) {
+                ss::hot_partition_record r;
+                r.keyspace = p.keyspace;
+                r.table = p.table;
+                r.partition = p.partition_key;
+                r.count = p.count;
+                r.error = p.error;
+                out.push(r);
+            }
+        };
+        ss::hot_partitions_results results;
+        to_json(hot.reads, results.reads);
+        to_json(hot.writes, results.writes);
+        to_json(hot.write_kib, results.write_kib);
+        co_return json::json_return_type(results);
+}
+
 static
 json::json_return_type
 rest_get_release_version(sharded<service::storage_service>& ss, const_req& req) {
@@ -1808,6 +1835,7 @@ rest_bind(FuncType func, BindArgs&... args) {
 void set_storage_service(http_context& ctx, routes& r, sharded<service::storage_service>& ss, service::raft_group0_client& group0_client) {
     ss::get_token_endpoint.set(r, rest_bind(rest_get_token_endpoint, ctx, ss));
     ss::toppartitions_generic.set(r, rest_bind(rest_toppartitions_generic, ctx));
+    ss::get_hot_partitions.set(r, rest_bind(rest_get_hot_partitions, ctx));
     ss::get_release_version.set(r, rest_bind(rest_get_release_version, ss));
     ss::get_scylla_release_version.set(r, rest_bind(rest_get_scylla_release_version, ss));
     ss::get_schema_version.set(r, rest_bind(rest_get_schema_version, ss));
@@ -1890,6 +1918,7 @@ void set_storage_service(http_context& ctx, routes& r, sharded<service::storage_
 void unset_storage_service(http_context& ctx, routes& r) {
     ss::get_token_endpoint.unset(r);
     ss::toppartitions_generic.unset(r);
+    ss::get_hot_partitions.unset(r);
     ss::get_release_version.unset(r);
     ss::get_scylla_release_version.unset(r);
     ss::get_schema_version.unset(r);
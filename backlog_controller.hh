@@ -11,8 +11,12 @@
 #include <seastar/core/timer.hh>
 #include <seastar/core/gate.hh>
 #include <seastar/core/file.hh>
+#include <seastar/core/metrics_registration.hh>
 #include <chrono>
 #include <cmath>
+#include <functional>
+#include <optional>
+#include <vector>
 
 #include "seastarx.hh"
 
@@ -136,3 +140,91 @@ class compaction_controller : public backlog_controller {
         )
     {}
 };
+
+// Closed-loop controller of the I/O bandwidth of background processes (compaction, streaming).
+//
+// The backlog controllers above only decide the CPU shares of a process and are blind to disk
+// saturation. This controller instead samples the average latency of foreground disk reads and
+// steers the bandwidth of the background scheduling groups so that the latency stays below a
+// target, using additive-increase/multiplicative-decrease:
+//
+//  - above the target, the bandwidth is cut by decrease_factor, down to the minimum;
+//  - well below the target (or when there are no reads at all), the bandwidth grows by a fixed
+//    step, up to the maximum;
+//  - in between, the bandwidth is kept as is, to avoid oscillating around the target.
+//
+// The bandwidth given to a group never exceeds its static limit, if it has one. When the target
+// is 0 the controller is disabled and the groups are left at their static limits.
+class io_bandwidth_controller {
+public:
+    using scheduling_group = seastar::scheduling_group;
+
+    static constexpr float decrease_factor = 0.75f;
+    // The fraction of the target below which the bandwidth is allowed to grow.
+    static constexpr float increase_threshold = 0.75f;
+    // The number of steps it takes to grow from 0 to the maximum bandwidth.
+    static constexpr unsigned increase_steps = 20;
+
+    struct config {
+        // Target average latency of foreground disk reads, 0 disables the controller.
+        std::function<uint32_t()> target_latency_us;
+        std::function<uint32_t()> min_bandwidth_mbs;
+        std::function<uint32_t()> max_bandwidth_mbs;
+    };
+
+    struct controlled_group {
+        scheduling_group sg;
+        // The static bandwidth limit of the group, 0 means unlimited.
+        std::function<uint32_t()> static_bandwidth_mbs;
+    };
+
+    // Cumulative counters of foreground disk reads.
+    struct read_latency_sample {
+        uint64_t requests = 0;
+        uint64_t latency_us = 0;
+    };
+
+    // The bandwidth for the next interval, given the current one and the average read latency
+    // during the last interval (nullopt if there were no reads).
+    static uint32_t next_bandwidth(uint32_t bandwidth_mbs, std::optional<uint64_t> avg_latency_us,
+            uint32_t target_latency_us, uint32_t min_bandwidth_mbs, uint32_t max_bandwidth_mbs);
+
+private:
+    config _cfg;
+    std::vector<controlled_group> _groups;
+    std::function<future<read_latency_sample>()> _sample;
+    read_latency_sample _last_sample;
+    uint32_t _bandwidth_mbs;
+    std::chrono::milliseconds _interval;
+    bool _enabled = false;
+    timer<> _update_timer;
+    future<> _inflight_update;
+
+    struct stats {
+        uint64_t increases = 0;
+        uint64_t decreases = 0;
+        uint64_t avg_latency_us = 0;
+    } _stats;
+    seastar::metrics::metric_groups _metrics;
+
+    void adjust();
+    future<> update_groups(bool enabled);
+    void setup_metrics();
+public:
+    io_bandwidth_controller(config cfg, std::vector<controlled_group> groups,
+                            std::function<future<read_latency_sample>()> sample,
+                            std::chrono::milliseconds interval = std::chrono::seconds(1));
+
+    // Starts adjusting the bandwidth every interval. Only one instance should be started
+    // per node, it samples the reads of all shards and updates the groups on all of them.
+    void start();
+
+    future<> shutdown() {
+        _update_timer.cancel();
+        return std::move(_inflight_update);
+    }
+
+    uint32_t bandwidth_mbs() const noexcept {
+        return _bandwidth_mbs;
+    }
+};
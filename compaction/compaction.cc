@@ -11,6 +11,7 @@
 
 #include <vector>
 #include <map>
+#include <list>
 #include <functional>
 #include <utility>
 #include <assert.h>
@@ -26,6 +27,7 @@
 #include <seastar/core/shard_id.hh>
 #include <seastar/core/on_internal_error.hh>
 #include <seastar/coroutine/maybe_yield.hh>
+#include <seastar/coroutine/parallel_for_each.hh>
 
 #include "compaction/compaction_garbage_collector.hh"
 #include "dht/i_partitioner.hh"
@@ -382,6 +384,9 @@ class compacted_fragments_writer {
     stop_func_t _stop_compaction_writer;
     std::optional<utils::observer<>> _stop_request_observer;
     bool _unclosed_partition = false;
+    // Index of the next sstable copied by compaction, in _c._copied_sstables_first_keys,
+    // which the sstable being written must not overlap.
+    size_t _next_copied_sstable = 0;
     struct partition_state {
         dht::decorated_key_opt dk;
         // Partition tombstone is saved for the purpose of replicating it to every fragment storing a partition pL.
@@ -410,6 +415,7 @@ class compacted_fragments_writer {
     void split_large_partition();
     void do_consume_new_partition(const dht::decorated_key& dk);
     stop_iteration do_consume_end_of_partition();
+    bool passed_copied_sstable(const dht::decorated_key& dk);
 public:
     explicit compacted_fragments_writer(compaction& c, creator_func_t cpw, stop_func_t scw)
             : _c(c)
@@ -449,32 +455,53 @@ class compacted_fragments_writer {
 using use_backlog_tracker = bool_class<class use_backlog_tracker_tag>;
 
 struct compaction_read_monitor_generator final : public read_monitor_generator {
-    class compaction_read_monitor final : public  sstables::read_monitor, public backlog_read_progress_manager {
+    class compaction_read_monitor final : public backlog_read_progress_manager {
+        // Monitors one reader of the sstable. A compaction of sub-ranges reads
+        // the same sstable with several readers at once, see compaction::consume_sub_ranges().
+        class reader_monitor final : public sstables::read_monitor {
+            compaction_read_monitor& _parent;
+            const sstables::reader_position_tracker* _tracker = nullptr;
+            uint64_t _start_position = 0;
+            uint64_t _last_position_seen = 0;
+        public:
+            explicit reader_monitor(compaction_read_monitor& parent) : _parent(parent) { }
+
+            virtual void on_read_started(const sstables::reader_position_tracker& tracker) override {
+                _tracker = &tracker;
+                _start_position = tracker.position;
+                _last_position_seen = tracker.position;
+                _parent.on_read_started();
+            }
+
+            virtual void on_read_completed() override {
+                if (_tracker) {
+                    _last_position_seen = _tracker->position;
+                    _tracker = nullptr;
+                }
+            }
+
+            uint64_t compacted() const {
+                return (_tracker ? _tracker->position : _last_position_seen) - _start_position;
+            }
+        };
+
         sstables::shared_sstable _sst;
         compaction_group_view& _table_s;
-        const sstables::reader_position_tracker* _tracker = nullptr;
-        uint64_t _last_position_seen = 0;
+        std::list<reader_monitor> _readers;
         use_backlog_tracker _use_backlog_tracker;
-    public:
-        virtual void on_read_started(const sstables::reader_position_tracker& tracker) override {
-            _tracker = &tracker;
-            if (_use_backlog_tracker) {
+
+        void on_read_started() {
+            if (_sst && _use_backlog_tracker) {
                 _table_s.get_backlog_tracker().register_compacting_sstable(_sst, *this);
             }
         }
-
-        virtual void on_read_completed() override {
-            if (_tracker) {
-                _last_position_seen = _tracker->position;
-                _tracker = nullptr;
-            }
+    public:
+        sstables::read_monitor& add_reader() {
+            return _readers.emplace_back(*this);
         }
 
         virtual uint64_t compacted() const override {
-            if (_tracker) {
-                return _tracker->position;
-            }
-            return _last_position_seen;
+            return std::ranges::fold_left(_readers | std::views::transform(std::mem_fn(&reader_monitor::compacted)), uint64_t(0), std::plus());
         }
 
         void remove_sstable() {
@@ -486,6 +513,8 @@ struct compaction_read_monitor_generator final : public read_monitor_generator {
 
         compaction_read_monitor(sstables::shared_sstable sst, compaction_group_view& table_s, use_backlog_tracker use_backlog_tracker)
             : _sst(std::move(sst)), _table_s(table_s), _use_backlog_tracker(use_backlog_tracker) { }
+        // Readers refer to their monitor.
+        compaction_read_monitor(compaction_read_monitor&&) = delete;
 
         ~compaction_read_monitor() {
             // We failed to finish handling this SSTable, so we have to update the backlog_tracker
@@ -499,8 +528,8 @@ struct compaction_read_monitor_generator final : public read_monitor_generator {
     };
 
     virtual sstables::read_monitor& operator()(sstables::shared_sstable sst) override {
-        auto p = _generated_monitors.emplace(sst->generation(), compaction_read_monitor(sst, _table_s, _use_backlog_tracker));
-        return p.first->second;
+        auto p = _generated_monitors.try_emplace(sst->generation(), sst, _table_s, _use_backlog_tracker);
+        return p.first->second.add_reader();
     }
 
     explicit compaction_read_monitor_generator(compaction_group_view& table_s, use_backlog_tracker use_backlog_tracker = use_backlog_tracker::yes)
@@ -583,13 +612,17 @@ class compaction {
     // optional clone of sstable set to be used for expiration purposes, so it will be set if expiration is enabled.
     std::optional<sstable_set> _sstable_set;
     // used to incrementally calculate max purgeable timestamp, as we iterate through decorated keys.
-    std::optional<sstable_set::incremental_selector> _selector;
+    // One for each sub-range compacted concurrently, as a selector only moves forward.
+    std::vector<sstable_set::incremental_selector> _selectors;
     std::unordered_set<shared_sstable> _compacting_for_max_purgeable_func;
     // optional owned_ranges vector for cleanup;
     const owned_ranges_ptr _owned_ranges = {};
     // required for reshard compaction.
     const dht::sharder* _sharder = nullptr;
-    const std::optional<dht::incremental_owned_ranges_checker> _owned_ranges_checker;
+    const unsigned _sub_range_parallelism;
+    const bool _is_major;
+    // Number of sub-ranges of the input compacted concurrently, see consume_sub_ranges().
+    size_t _sub_ranges = 1;
     // Garbage collected sstables that are sealed but were not added to SSTable set yet.
     std::vector<shared_sstable> _unused_garbage_collected_sstables;
     // Garbage collected sstables that were added to SSTable set and should be eventually removed from it.
@@ -598,6 +631,9 @@ class compaction {
     // optional tombstone_gc_state that is used when gc has to check only the compacting sstables to collect tombstones.
     std::optional<tombstone_gc_state> _tombstone_gc_state_with_commitlog_check_disabled;
     int64_t _output_repaired_at = 0;
+    // First keys of the input sstables carried over to the output as they are,
+    // in ring order. See copy_sstable().
+    std::vector<dht::decorated_key> _copied_sstables_first_keys;
 private:
     // Keeps track of monitors for input sstable.
     // If _update_backlog_tracker is set to true, monitors are responsible for adjusting backlog as compaction progresses.
@@ -641,14 +677,17 @@ class compaction {
         , _replacer(std::move(descriptor.replacer))
         , _run_identifier(descriptor.run_identifier)
         , _sstable_set(std::move(descriptor.all_sstables_snapshot))
-        , _selector(_sstable_set ? _sstable_set->make_incremental_selector() : std::optional<sstable_set::incremental_selector>{})
         , _compacting_for_max_purgeable_func(std::unordered_set<shared_sstable>(_sstables.begin(), _sstables.end()))
         , _owned_ranges(std::move(descriptor.owned_ranges))
         , _sharder(descriptor.sharder)
-        , _owned_ranges_checker(_owned_ranges ? std::optional<dht::incremental_owned_ranges_checker>(*_owned_ranges) : std::nullopt)
+        , _sub_range_parallelism(std::max(descriptor.sub_range_parallelism, 1u))
+        , _is_major(descriptor.is_major)
         , _tombstone_gc_state_with_commitlog_check_disabled(descriptor.gc_check_only_compacting_sstables ? std::make_optional(_table_s.get_tombstone_gc_state().with_commitlog_check_disabled()) : std::nullopt)
         , _progress_monitor(progress_monitor)
     {
+        if (_sstable_set) {
+            _selectors.push_back(_sstable_set->make_incremental_selector());
+        }
         std::unordered_set<run_id> ssts_run_ids;
         _contains_multi_fragment_runs = std::any_of(_sstables.begin(), _sstables.end(), [&ssts_run_ids] (shared_sstable& sst) {
             return !ssts_run_ids.insert(sst->run_identifier()).second;
@@ -666,7 +705,7 @@ class compaction {
     virtual uint64_t partitions_per_sstable() const {
         // some tests use _max_sstable_size == 0 for force many one partition per sstable
         auto max_sstable_size = std::max<uint64_t>(_max_sstable_size, 1);
-        uint64_t estimated_sstables = std::max(1UL, uint64_t(ceil(double(_compacting_data_file_size) / max_sstable_size)));
+        uint64_t estimated_sstables = std::max<uint64_t>(_sub_ranges, uint64_t(ceil(double(_compacting_data_file_size) / max_sstable_size)));
         return std::min(uint64_t(ceil(double(_estimated_partitions) / estimated_sstables)),
                         _table_s.get_compaction_strategy().adjust_partition_estimate(_ms_metadata, _estimated_partitions, _schema));
     }
@@ -799,11 +838,11 @@ class compaction {
                                                         streamed_mutation::forwarding fwd,
                                                         mutation_reader::forwarding) = 0;
 
-    mutation_reader setup_sstable_reader() {
-        if (!_owned_ranges_checker) {
+    mutation_reader setup_sstable_reader(const dht::partition_range& range = query::full_partition_range) {
+        if (!_owned_ranges) {
             return make_sstable_reader(_schema,
                                        _permit,
-                                       query::full_partition_range,
+                                       range,
                                        _schema->full_slice(),
                                        tracing::trace_state_ptr(),
                                        ::streamed_mutation::forwarding::no,
@@ -827,13 +866,15 @@ class compaction {
                                        fwd_mr);
         });
 
-        auto owned_range_generator = [this] () -> std::optional<dht::partition_range> {
-            auto r = _owned_ranges_checker->next_owned_range();
-            if (r == nullptr) {
-                return std::nullopt;
+        auto owned_range_generator = [this, range, owned_ranges_checker = dht::incremental_owned_ranges_checker(*_owned_ranges)] () -> std::optional<dht::partition_range> {
+            while (auto r = owned_ranges_checker.next_owned_range()) {
+                auto owned_range = dht::to_partition_range(*r).intersection(range, dht::ring_position_comparator(*_schema));
+                if (owned_range) {
+                    log_trace("Skipping to the next owned range {}", *owned_range);
+                    return owned_range;
+                }
             }
-            log_trace("Skipping to the next owned range {}", *r);
-            return dht::to_partition_range(*r);
+            return std::nullopt;
         };
 
         return make_multi_range_reader(_schema, _permit, std::move(source),
@@ -850,9 +891,108 @@ class compaction {
         return _tombstone_gc_state_with_commitlog_check_disabled ? _tombstone_gc_state_with_commitlog_check_disabled.value() : _table_s.get_tombstone_gc_state();
     }
 
+    // Only regular compactions into a run of sstables can carry input sstables
+    // over to their output. The others, major compactions included, exist to
+    // rewrite their input, and one whose output is a single sstable has to
+    // merge its input to make progress.
+    bool sstable_copy_enabled() const {
+        return _type == compaction_type::Compaction
+                && !_is_major
+                && !_owned_ranges
+                && _max_sstable_size != std::numeric_limits<uint64_t>::max()
+                && !use_interposer_consumer();
+    }
+
+    // Returns the input sstables which can be carried over to the output as they
+    // are, instead of being rewritten. That's the case for an sstable which doesn't
+    // overlap any other input, so none of its partitions is merged with another
+    // sstable, and which has nothing compaction would purge, expire or drop: no
+    // tombstones, no expiring cells, and no data of dropped columns.
+    std::unordered_set<shared_sstable> sstables_to_copy(const std::unordered_set<shared_sstable>& fully_expired) const {
+        std::unordered_set<shared_sstable> ret;
+        if (!sstable_copy_enabled()) {
+            return ret;
+        }
+        auto repaired_at = std::ranges::max(_sstables | std::views::transform([] (const shared_sstable& sst) {
+            return sst->get_stats_metadata().repaired_at;
+        }));
+        auto can_copy = [&] (const shared_sstable& sst) {
+            auto& stats = sst->get_stats_metadata();
+            return sst->get_storage().can_snapshot()
+                && sst->data_size() <= _max_sstable_size
+                && stats.repaired_at == repaired_at
+                && stats.min_local_deletion_time == std::numeric_limits<int32_t>::max()
+                && std::ranges::all_of(_schema->dropped_columns() | std::views::values, [&] (const schema::dropped_column& dc) {
+                    return dc.timestamp < stats.min_timestamp;
+                });
+        };
+
+        auto inputs = _sstables
+                | std::views::filter([&] (const shared_sstable& sst) { return !fully_expired.contains(sst); })
+                | std::ranges::to<std::vector>();
+        std::ranges::sort(inputs, [this] (const shared_sstable& a, const shared_sstable& b) {
+            return a->get_first_decorated_key().less_compare(*_schema, b->get_first_decorated_key());
+        });
+        // The input at i overlaps none of the others if it starts after all the
+        // preceding ones end, and ends before the following one starts.
+        const dht::decorated_key* max_last_key = nullptr;
+        for (size_t i = 0; i < inputs.size(); i++) {
+            auto& sst = inputs[i];
+            bool after_previous = !max_last_key || max_last_key->less_compare(*_schema, sst->get_first_decorated_key());
+            bool before_next = i + 1 == inputs.size() || sst->get_last_decorated_key().less_compare(*_schema, inputs[i + 1]->get_first_decorated_key());
+            if (after_previous && before_next && can_copy(sst)) {
+                ret.insert(sst);
+            }
+            if (!max_last_key || max_last_key->less_compare(*_schema, sst->get_last_decorated_key())) {
+                max_last_key = &sst->get_last_decorated_key();
+            }
+        }
+        return ret;
+    }
+
+    // Carries an input sstable over to the output as it is, by linking its files
+    // under a new generation, rather than rewriting it. Only its level and run
+    // identifier, which are the output's, are written.
+    // Returns false, leaving the sstable to be rewritten, if it isn't written in
+    // the version and format of the output, as the links keep those of the input.
+    future<bool> copy_sstable(const shared_sstable& sst) {
+        auto new_sst = _sstable_creator(this_shard_id());
+        if (new_sst->get_version() != sst->get_version() || new_sst->get_format() != sst->get_format()) {
+            log_debug("Rewriting sstable {} instead of copying it, as it's not written in version {} and format {}",
+                    sst->get_filename(), new_sst->get_version(), new_sst->get_format());
+            co_return false;
+        }
+        _new_partial_sstables.insert(new_sst);
+        co_await sst->clone(new_sst->generation());
+        std::exception_ptr ex;
+        try {
+            co_await new_sst->load(_schema->get_sharder(), sstable_open_config{.current_shard_as_sstable_owner = true});
+        } catch (...) {
+            ex = std::current_exception();
+        }
+        if (ex) {
+            // The links aren't known to be an sstable yet, so remove them here
+            // rather than leaving them to delete_sstables_for_interrupted_compaction().
+            _new_partial_sstables.erase(new_sst);
+            co_await new_sst->unlink();
+            std::rethrow_exception(std::move(ex));
+        }
+        co_await new_sst->mutate_sstable_level(_sstable_level);
+        co_await new_sst->mutate_run_identifier(_run_identifier);
+        log_debug("Copied sstable {} to {} instead of rewriting it", sst->get_filename(), new_sst->get_filename());
+        _end_size += new_sst->bytes_on_disk();
+        _cdata.total_keys_written += new_sst->get_estimated_key_count();
+        _all_new_sstables.push_back(new_sst);
+        _new_unused_sstables.push_back(new_sst);
+        _new_partial_sstables.erase(new_sst);
+        _copied_sstables_first_keys.push_back(new_sst->get_first_decorated_key());
+        co_return true;
+    }
+
     future<> setup() {
         auto ssts = make_lw_shared<sstables::sstable_set>(make_sstable_set_for_input());
         auto fully_expired = _table_s.fully_expired_sstables(_sstables, gc_clock::now());
+        auto to_copy = sstables_to_copy(fully_expired);
         min_max_tracker<api::timestamp_type> timestamp_tracker;
 
         double sum_of_estimated_droppable_tombstone_ratio = 0;
@@ -882,6 +1022,22 @@ class compaction {
                 log_debug("Fully expired sstable {} will be dropped on compaction completion", sst->get_filename());
                 continue;
             }
+            if (to_copy.contains(sst)) {
+                bool copied = false;
+                std::exception_ptr ex;
+                try {
+                    copied = co_await copy_sstable(sst);
+                } catch (...) {
+                    ex = std::current_exception();
+                }
+                if (ex) {
+                    delete_sstables_for_interrupted_compaction();
+                    std::rethrow_exception(std::move(ex));
+                }
+                if (copied) {
+                    continue;
+                }
+            }
             _stats_collector.update(sst->get_encoding_stats_for_compaction());
 
             compaction_size += sst->data_size();
@@ -904,12 +1060,18 @@ class compaction {
             _output_repaired_at = repaired_at;
         }
         log_debug("repaired_at_vec={} output_repaired_at={}", repaired_at_for_compacted_sstables, _output_repaired_at);
-        if (ssts->size() < _sstables.size()) {
+        if (ssts->size() + to_copy.size() < _sstables.size()) {
             log_debug("{} out of {} input sstables are fully expired sstables that will not be actually compacted",
-                      _sstables.size() - ssts->size(), _sstables.size());
+                      _sstables.size() - ssts->size() - to_copy.size(), _sstables.size());
+        }
+        if (!to_copy.empty()) {
+            log_debug("{} out of {} input sstables were copied instead of being rewritten", to_copy.size(), _sstables.size());
+            std::ranges::sort(_copied_sstables_first_keys, [this] (const dht::decorated_key& a, const dht::decorated_key& b) {
+                return a.less_compare(*_schema, b);
+            });
         }
         // _estimated_droppable_tombstone_ratio could exceed 1.0 in certain cases, so limit it to 1.0.
-        _estimated_droppable_tombstone_ratio = std::min(1.0, sum_of_estimated_droppable_tombstone_ratio / ssts->size());
+        _estimated_droppable_tombstone_ratio = ssts->empty() ? 0 : std::min(1.0, sum_of_estimated_droppable_tombstone_ratio / ssts->size());
 
         _compacting = std::move(ssts);
 
@@ -933,6 +1095,63 @@ class compaction {
                                                streamed_mutation::forwarding::no, &_tombstone_purge_stats));
     }
 
+    // Splits the token span of the input into sub-ranges of equal span, which
+    // together cover the whole ring, so that they can be compacted independently.
+    // Incremental compaction releases input sstables as soon as the output
+    // passes them, which requires the output to be written in ring order, and
+    // interposer consumers split the output in their own way, so both are
+    // compacted as a single range.
+    dht::partition_range_vector split_into_sub_ranges() const {
+        if (_sub_range_parallelism <= 1 || enable_garbage_collected_sstable_writer() || use_interposer_consumer() || _compacting->empty()) {
+            return {query::full_partition_range};
+        }
+        auto all = _compacting->all();
+        auto first = std::ranges::min(*all | std::views::transform([] (const shared_sstable& sst) { return sst->get_first_decorated_key().token(); }));
+        auto last = std::ranges::max(*all | std::views::transform([] (const shared_sstable& sst) { return sst->get_last_decorated_key().token(); }));
+        // Unsigned arithmetic, which wraps around instead of overflowing.
+        const auto first_token = uint64_t(dht::token::to_int64(first));
+        const auto step = (uint64_t(dht::token::to_int64(last)) - first_token) / _sub_range_parallelism;
+        if (step == 0) {
+            return {query::full_partition_range};
+        }
+        dht::partition_range_vector ranges;
+        ranges.reserve(_sub_range_parallelism);
+        std::optional<dht::partition_range::bound> start;
+        for (unsigned i = 1; i < _sub_range_parallelism; i++) {
+            auto boundary = dht::ring_position::starting_at(dht::token::from_int64(int64_t(first_token + step * i)));
+            ranges.emplace_back(std::move(start), dht::partition_range::bound(boundary, false));
+            start.emplace(std::move(boundary), true);
+        }
+        ranges.emplace_back(std::move(start), std::nullopt);
+        return ranges;
+    }
+
+    // Compacts disjoint sub-ranges of the input concurrently, overlapping the
+    // reading, merging and writing of one sub-range with the I/O of the others.
+    // Each sub-range is written to its own sstables, which don't overlap the
+    // sstables of the other sub-ranges, so together they make the output run.
+    future<> consume_sub_ranges(gc_clock::time_point compaction_time, dht::partition_range_vector ranges) {
+        log_debug("Compacting {} sub-ranges concurrently: {}", ranges.size(), ranges);
+        _sub_ranges = ranges.size();
+        while (_sstable_set && _selectors.size() < ranges.size()) {
+            _selectors.push_back(_sstable_set->make_incremental_selector());
+        }
+        co_await coroutine::parallel_for_each(std::views::iota(size_t(0), ranges.size()), [&] (size_t i) {
+            return seastar::async([this, compaction_time, &range = ranges[i], i] {
+                auto reader = setup_sstable_reader(range);
+                auto close_reader = deferred_close(reader);
+                using compact_mutations = compact_for_compaction<compacted_fragments_writer, noop_compacted_fragments_consumer>;
+                auto cfc = compact_mutations(*schema(), compaction_time,
+                    max_purgeable_func(i),
+                    get_tombstone_gc_state(),
+                    get_compacted_fragments_writer(),
+                    noop_compacted_fragments_consumer(),
+                    &_tombstone_purge_stats);
+                reader.consume_in_thread(std::move(cfc));
+            });
+        });
+    }
+
     future<> consume() {
         auto now = gc_clock::now();
         // consume_without_gc_writer(), which uses compacting_reader, is ~3% slower.
@@ -941,6 +1160,9 @@ class compaction {
         if (!enable_garbage_collected_sstable_writer() && use_interposer_consumer()) {
             return consume_without_gc_writer(now);
         }
+        if (auto ranges = split_into_sub_ranges(); ranges.size() > 1) {
+            return consume_sub_ranges(now, std::move(ranges));
+        }
         auto consumer = make_interposer_consumer([this, now] (mutation_reader reader) mutable
         {
             return seastar::async([this, reader = std::move(reader), now] () mutable {
@@ -1042,12 +1264,12 @@ class compaction {
     virtual std::string_view report_start_desc() const = 0;
     virtual std::string_view report_finish_desc() const = 0;
 
-    max_purgeable_fn max_purgeable_func() {
+    max_purgeable_fn max_purgeable_func(size_t sub_range = 0) {
         if (!tombstone_expiration_enabled()) {
             return can_never_purge;
         }
-        return [this] (const dht::decorated_key& dk, is_shadowable is_shadowable) {
-            return get_max_purgeable_timestamp(_table_s, *_selector, _compacting_for_max_purgeable_func, dk, _bloom_filter_checks, _compacting_max_timestamp, _tombstone_gc_state_with_commitlog_check_disabled.has_value(), is_shadowable);
+        return [this, sub_range] (const dht::decorated_key& dk, is_shadowable is_shadowable) {
+            return get_max_purgeable_timestamp(_table_s, _selectors[sub_range], _compacting_for_max_purgeable_func, dk, _bloom_filter_checks, _compacting_max_timestamp, _tombstone_gc_state_with_commitlog_check_disabled.has_value(), is_shadowable);
         };
     }
 
@@ -1122,7 +1344,8 @@ compacted_fragments_writer::compacted_fragments_writer(compacted_fragments_write
         : _c(other._c)
         , _compaction_writer(std::move(other._compaction_writer))
         , _create_compaction_writer(std::move(other._create_compaction_writer))
-        , _stop_compaction_writer(std::move(other._stop_compaction_writer)) {
+        , _stop_compaction_writer(std::move(other._stop_compaction_writer))
+        , _next_copied_sstable(other._next_copied_sstable) {
     if (std::exchange(other._stop_request_observer, std::nullopt)) {
         _stop_request_observer = make_stop_request_observer(_c._stop_request_observable);
     }
@@ -1195,7 +1418,22 @@ stop_iteration compacted_fragments_writer::do_consume_end_of_partition() {
     return _compaction_writer->writer.consume_end_of_partition();
 }
 
+bool compacted_fragments_writer::passed_copied_sstable(const dht::decorated_key& dk) {
+    auto& first_keys = _c._copied_sstables_first_keys;
+    bool passed = false;
+    while (_next_copied_sstable < first_keys.size() && first_keys[_next_copied_sstable].less_compare(*_c.schema(), dk)) {
+        _next_copied_sstable++;
+        passed = true;
+    }
+    return passed;
+}
+
 void compacted_fragments_writer::consume_new_partition(const dht::decorated_key& dk) {
+    // Sstables of a run must not overlap, so start a new sstable after
+    // every sstable copied into the run.
+    if (passed_copied_sstable(dk) && _compaction_writer) {
+        stop_current_writer();
+    }
     _current_partition = {
         .dk = dk,
         .tombstone = tombstone(),
@@ -1382,7 +1620,11 @@ class regular_compaction : public compaction {
                 _sstable_set->insert(sst);
             }
         }
-        _selector.emplace(_sstable_set->make_incremental_selector());
+        auto selectors = _selectors.size();
+        _selectors.clear();
+        while (_selectors.size() < selectors) {
+            _selectors.push_back(_sstable_set->make_incremental_selector());
+        }
     }
 };
 
@@ -2116,6 +2358,17 @@ uint64_t compaction_descriptor::sstables_size() const {
     return std::ranges::fold_left(sstables | std::views::transform(std::mem_fn(&sstables::sstable::data_size)), uint64_t(0), std::plus{});
 }
 
+uint64_t compaction_descriptor::read_amplification_score() const {
+    if (sstables.empty()) {
+        return 0;
+    }
+    // A read hitting several of the inputs will hit only the output, so at
+    // best every hit but the ones of the most read input goes away.
+    auto now = lowres_clock::now();
+    auto hits = sstables | std::views::transform([now] (const sstables::shared_sstable& sst) { return sst->read_amplification_hits(now); });
+    return std::ranges::fold_left(hits, uint64_t(0), std::plus{}) - std::ranges::max(hits);
+}
+
 }
 
 auto fmt::formatter<sstables::compaction_type>::format(sstables::compaction_type type, fmt::format_context& ctx) const
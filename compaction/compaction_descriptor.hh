@@ -181,6 +181,14 @@ struct compaction_descriptor {
     // timestamp comparison, similar to memtables, is performed.
     bool gc_check_only_compacting_sstables = false;
 
+    // Number of disjoint token sub-ranges of the input to compact concurrently,
+    // each producing its own sstables of the output run. Ignored by compactions
+    // which need their output to be written in ring order, e.g. incremental ones.
+    unsigned sub_range_parallelism = 1;
+    // Set for major compactions, which rewrite all their input into a single
+    // run, so none of it is carried over to the output as it is.
+    bool is_major = false;
+
     compaction_descriptor() = default;
 
     static constexpr int default_level = 0;
@@ -216,6 +224,10 @@ struct compaction_descriptor {
     void enable_garbage_collection(sstables::sstable_set snapshot) { all_sstables_snapshot = std::move(snapshot); }
     // Returns total size of all sstables contained in this descriptor
     uint64_t sstables_size() const;
+    // Returns how many sstable lookups of single-partition reads served by
+    // the sstables of this descriptor would have been saved, had they been a
+    // single sstable. Used to schedule the jobs relieving hot reads first.
+    uint64_t read_amplification_score() const;
 };
 
 }
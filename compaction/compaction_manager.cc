@@ -584,6 +584,8 @@ class major_compaction_task_executor : public compaction_task_executor, public m
         sstables::compaction_strategy cs = t->get_compaction_strategy();
         sstables::compaction_descriptor descriptor = cs.get_major_compaction_job(*t, co_await _cm.get_candidates(*t));
         descriptor.gc_check_only_compacting_sstables = _consider_only_existing_data;
+        descriptor.sub_range_parallelism = _cm.sub_range_parallelism();
+        descriptor.is_major = true;
         auto compacting = compacting_sstable_registration(_cm, _cm.get_compaction_state(t), descriptor.sstables);
         auto on_replace = compacting.update_on_sstable_replacement();
         setup_new_compaction(descriptor.run_identifier);
@@ -1144,11 +1146,16 @@ future<> compaction_manager::postponed_compactions_reevaluation() {
         }
         // A task_state being reevaluated can re-insert itself into postponed list, which is the reason
         // for moving the list to be processed into a local.
-        auto postponed = std::exchange(_postponed, {});
+        auto postponed = std::exchange(_postponed, {}) | std::ranges::to<std::vector>();
+        // Tables are resubmitted in the order of the read amplification score of the jobs they
+        // postponed, such that the jobs relieving reads the most get the released weights first.
+        std::ranges::sort(postponed, std::ranges::greater(), [this] (compaction_group_view* t) {
+            return read_amplification_score(*t);
+        });
+        auto it = postponed.begin();
         try {
-            for (auto it = postponed.begin(); it != postponed.end();) {
-                compaction_group_view* t = *it;
-                it = postponed.erase(it);
+            while (it != postponed.end()) {
+                compaction_group_view* t = *it++;
                 // skip reevaluation of a compaction_group_view that became invalid post its removal
                 if (!_compaction_state.contains(t)) {
                     continue;
@@ -1158,7 +1165,7 @@ future<> compaction_manager::postponed_compactions_reevaluation() {
                 co_await coroutine::maybe_yield();
             }
         } catch (...) {
-            _postponed.insert(postponed.begin(), postponed.end());
+            _postponed.insert(it, postponed.end());
         }
     }
 }
@@ -1408,6 +1415,7 @@ class regular_compaction_task_executor : public compaction_task_executor, public
             sstables::compaction_strategy cs = t.get_compaction_strategy();
             sstables::compaction_descriptor descriptor = co_await cs.get_sstables_for_compaction(t, _cm.get_strategy_control());
             int weight = calculate_weight(descriptor);
+            _compaction_state.read_amplification_score = descriptor.read_amplification_score();
             cmlog.debug("Started minor compaction sstables={} sstables_reapired_at={} range={} uuid={} compaction_uuid={}",
                     descriptor.sstables, compacting_table()->get_sstables_repaired_at(),
                     compacting_table()->token_range(), uuid, _compaction_data.compaction_uuid);
@@ -2030,6 +2038,7 @@ class cleanup_sstables_compaction_task_executor : public compaction_task_executo
             auto active_job = std::move(_pending_cleanup_jobs.back());
             active_job.options = _cleanup_options;
             active_job.owned_ranges = _owned_ranges_ptr;
+            active_job.sub_range_parallelism = _cm.sub_range_parallelism();
             co_await run_cleanup_job(std::move(active_job));
             _pending_cleanup_jobs.pop_back();
             _cm._stats.pending_tasks--;
@@ -2416,6 +2425,13 @@ bool compaction_manager::has_table_ongoing_compaction(const compaction_group_vie
     });
 };
 
+uint64_t compaction_manager::read_amplification_score(const compaction_group_view& t) const {
+    if (auto it = _compaction_state.find(const_cast<compaction_group_view*>(&t)); it != _compaction_state.end()) {
+        return it->second.read_amplification_score;
+    }
+    return 0;
+}
+
 bool compaction_manager::compaction_disabled(compaction_group_view& t) const {
     if (auto it = _compaction_state.find(&t); it != _compaction_state.end()) {
         return it->second.compaction_disabled();
@@ -82,6 +82,7 @@ class compaction_manager: public peering_sharded_service<compaction_manager> {
         size_t available_memory = 0;
         utils::updateable_value<float> static_shares = utils::updateable_value<float>(0);
         utils::updateable_value<uint32_t> throughput_mb_per_sec = utils::updateable_value<uint32_t>(0);
+        utils::updateable_value<uint32_t> sub_range_parallelism = utils::updateable_value<uint32_t>(1);
         std::chrono::seconds flush_all_tables_before_major = std::chrono::duration_cast<std::chrono::seconds>(std::chrono::days(1));
     };
 
@@ -296,6 +297,10 @@ class compaction_manager: public peering_sharded_service<compaction_manager> {
         return _cfg.throughput_mb_per_sec.get();
     }
 
+    uint32_t sub_range_parallelism() const noexcept {
+        return _cfg.sub_range_parallelism.get();
+    }
+
     std::chrono::seconds flush_all_tables_before_major() const noexcept {
         return _cfg.flush_all_tables_before_major;
     }
@@ -418,6 +423,10 @@ class compaction_manager: public peering_sharded_service<compaction_manager> {
     // Returns true if table has an ongoing compaction, running on its behalf
     bool has_table_ongoing_compaction(const compaction::compaction_group_view& t) const;
 
+    // Returns the read amplification score of the last regular compaction
+    // job selected for the table, or 0 if there is none.
+    uint64_t read_amplification_score(const compaction::compaction_group_view& t) const;
+
     bool compaction_disabled(compaction::compaction_group_view& t) const;
 
     // Stops ongoing compaction of a given type.
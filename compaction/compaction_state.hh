@@ -53,6 +53,11 @@ struct compaction_state {
 
     gc_clock::time_point last_regular_compaction;
 
+    // Read amplification score of the last regular compaction job selected
+    // for the table, whether it ran or was postponed.
+    // See sstables::compaction_descriptor::read_amplification_score().
+    uint64_t read_amplification_score = 0;
+
     explicit compaction_state(compaction_group_view& t);
     compaction_state(compaction_state&&) = delete;
     ~compaction_state();
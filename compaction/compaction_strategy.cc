@@ -30,6 +30,7 @@
 #include "leveled_manifest.hh"
 #include "utils/to_string.hh"
 #include "incremental_compaction_strategy.hh"
+#include "unified_compaction_strategy.hh"
 #include "sstables/sstable_set_impl.hh"
 
 logging::logger leveled_manifest::logger("LeveledManifest");
@@ -178,6 +179,9 @@ void compaction_strategy_impl::validate_options_for_strategy_type(const std::map
         case compaction_strategy_type::incremental:
             incremental_compaction_strategy::validate_options(options, unchecked_options);
             break;
+        case compaction_strategy_type::unified:
+            unified_compaction_strategy::validate_options(options, unchecked_options);
+            break;
         default:
             break;
         case compaction_strategy_type::null:
@@ -775,6 +779,9 @@ compaction_strategy make_compaction_strategy(compaction_strategy_type strategy,
     case compaction_strategy_type::incremental:
         impl = make_shared<incremental_compaction_strategy>(incremental_compaction_strategy(options));
         break;
+    case compaction_strategy_type::unified:
+        impl = make_shared<unified_compaction_strategy>(unified_compaction_strategy(options));
+        break;
     default:
         throw std::runtime_error("strategy not supported");
     }
@@ -793,6 +800,10 @@ std::unique_ptr<sstable_set_impl> incremental_compaction_strategy::make_sstable_
     return std::make_unique<partitioned_sstable_set>(ts.schema(), ts.token_range());
 }
 
+std::unique_ptr<sstable_set_impl> unified_compaction_strategy::make_sstable_set(const compaction_group_view& ts) const {
+    return std::make_unique<partitioned_sstable_set>(ts.schema(), ts.token_range());
+}
+
 }
 
 namespace compaction {
@@ -802,6 +813,7 @@ compaction_strategy_state compaction_strategy_state::make(const compaction_strat
         case compaction_strategy_type::null:
         case compaction_strategy_type::size_tiered:
         case compaction_strategy_type::incremental:
+        case compaction_strategy_type::unified:
             return compaction_strategy_state(default_empty_state{});
         case compaction_strategy_type::leveled:
             return compaction_strategy_state(leveled_compaction_strategy_state{});
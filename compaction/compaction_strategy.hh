@@ -74,6 +74,8 @@ class compaction_strategy {
             return "InMemoryCompactionStrategy";
         case compaction_strategy_type::incremental:
             return "IncrementalCompactionStrategy";
+        case compaction_strategy_type::unified:
+            return "UnifiedCompactionStrategy";
         default:
             throw std::runtime_error("Invalid Compaction Strategy");
         }
@@ -94,6 +96,8 @@ class compaction_strategy {
             return compaction_strategy_type::in_memory;
         } else if (short_name == "IncrementalCompactionStrategy") {
             return compaction_strategy_type::incremental;
+        } else if (short_name == "UnifiedCompactionStrategy") {
+            return compaction_strategy_type::unified;
         } else {
             throw exceptions::configuration_exception(format("Unable to find compaction strategy class '{}'", name));
         }
@@ -72,6 +72,24 @@ static int validate_compaction_window_size(const std::map<sstring, sstring>& opt
     return window_size;
 }
 
+static uint64_t validate_max_data_segregation_window_count(const std::map<sstring, sstring>& options) {
+    auto tmp_value = compaction_strategy_impl::get_value(options, time_window_compaction_strategy_options::MAX_DATA_SEGREGATION_WINDOW_COUNT_KEY);
+    auto window_count = cql3::statements::property_definitions::to_long(time_window_compaction_strategy_options::MAX_DATA_SEGREGATION_WINDOW_COUNT_KEY, tmp_value,
+            time_window_compaction_strategy_options::DEFAULT_MAX_DATA_SEGREGATION_WINDOW_COUNT);
+
+    if (window_count <= 0) {
+        throw exceptions::configuration_exception(fmt::format("{} value ({}) must be greater than 0", time_window_compaction_strategy_options::MAX_DATA_SEGREGATION_WINDOW_COUNT_KEY, window_count));
+    }
+
+    return window_count;
+}
+
+static uint64_t validate_max_data_segregation_window_count(const std::map<sstring, sstring>& options, std::map<sstring, sstring>& unchecked_options) {
+    auto window_count = validate_max_data_segregation_window_count(options);
+    unchecked_options.erase(time_window_compaction_strategy_options::MAX_DATA_SEGREGATION_WINDOW_COUNT_KEY);
+    return window_count;
+}
+
 static db_clock::duration validate_expired_sstable_check_frequency_seconds(const std::map<sstring, sstring>& options) {
     db_clock::duration expired_sstable_check_frequency = time_window_compaction_strategy_options::DEFAULT_EXPIRED_SSTABLE_CHECK_FREQUENCY_SECONDS();
 
@@ -121,6 +139,7 @@ time_window_compaction_strategy_options::time_window_compaction_strategy_options
     sstable_window_size = window_size * window_unit;
     expired_sstable_check_frequency = validate_expired_sstable_check_frequency_seconds(options);
     timestamp_resolution = validate_timestamp_resolution(options);
+    max_data_segregation_window_count = validate_max_data_segregation_window_count(options);
 
     auto it = options.find("enable_optimized_twcs_queries");
     if (it != options.end() && it->second == "false") {
@@ -140,6 +159,7 @@ void time_window_compaction_strategy_options::validate(const std::map<sstring, s
     validate_compaction_window_size(options, unchecked_options);
     validate_expired_sstable_check_frequency_seconds(options, unchecked_options);
     validate_timestamp_resolution(options, unchecked_options);
+    validate_max_data_segregation_window_count(options, unchecked_options);
     compaction_strategy_impl::validate_min_max_threshold(options, unchecked_options);
 
     auto it = options.find("enable_optimized_twcs_queries");
@@ -167,7 +187,7 @@ class classify_by_timestamp {
             std::swap(*it, _known_windows.front());
             return window;
         }
-        if (_known_windows.size() < time_window_compaction_strategy::max_data_segregation_window_count) {
+        if (_known_windows.size() < _options.get_max_data_segregation_window_count()) {
             _known_windows.push_back(window);
             return window;
         }
@@ -185,7 +205,7 @@ class classify_by_timestamp {
 
 uint64_t time_window_compaction_strategy::adjust_partition_estimate(const mutation_source_metadata& ms_meta, uint64_t partition_estimate, schema_ptr s) const {
     // If not enough information, we assume the worst
-    auto estimated_window_count = max_data_segregation_window_count;
+    auto estimated_window_count = _options.get_max_data_segregation_window_count();
     auto default_ttl = std::chrono::duration_cast<std::chrono::microseconds>(s->default_time_to_live());
     bool min_and_max_ts_available = ms_meta.min_timestamp && ms_meta.max_timestamp;
     auto estimate_window_count = [this] (timestamp_type min_window, timestamp_type max_window) {
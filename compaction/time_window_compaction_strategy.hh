@@ -28,11 +28,13 @@ class time_window_compaction_strategy_options {
     static constexpr std::chrono::seconds DEFAULT_COMPACTION_WINDOW_UNIT = 86400s;
     static constexpr int DEFAULT_COMPACTION_WINDOW_SIZE = 1;
     static constexpr std::chrono::seconds DEFAULT_EXPIRED_SSTABLE_CHECK_FREQUENCY_SECONDS() { return 600s; }
+    static constexpr uint64_t DEFAULT_MAX_DATA_SEGREGATION_WINDOW_COUNT = 100;
 
     static constexpr auto TIMESTAMP_RESOLUTION_KEY = "timestamp_resolution";
     static constexpr auto COMPACTION_WINDOW_UNIT_KEY = "compaction_window_unit";
     static constexpr auto COMPACTION_WINDOW_SIZE_KEY = "compaction_window_size";
     static constexpr auto EXPIRED_SSTABLE_CHECK_FREQUENCY_SECONDS_KEY = "expired_sstable_check_frequency_seconds";
+    static constexpr auto MAX_DATA_SEGREGATION_WINDOW_COUNT_KEY = "max_data_segregation_window_count";
 
     static const std::unordered_map<sstring, std::chrono::seconds> valid_window_units;
 
@@ -46,6 +48,9 @@ class time_window_compaction_strategy_options {
     db_clock::duration expired_sstable_check_frequency = DEFAULT_EXPIRED_SSTABLE_CHECK_FREQUENCY_SECONDS();
     timestamp_resolutions timestamp_resolution = timestamp_resolutions::microsecond;
     bool enable_optimized_twcs_queries{true};
+    // The maximum amount of windows data written by memtable flushes, streaming
+    // and compaction is segregated into, see time_window_compaction_strategy::max_data_segregation_window_count.
+    uint64_t max_data_segregation_window_count = DEFAULT_MAX_DATA_SEGREGATION_WINDOW_COUNT;
 public:
     time_window_compaction_strategy_options(const time_window_compaction_strategy_options&);
     time_window_compaction_strategy_options(time_window_compaction_strategy_options&&);
@@ -54,6 +59,7 @@ class time_window_compaction_strategy_options {
     static void validate(const std::map<sstring, sstring>& options, std::map<sstring, sstring>& unchecked_options);
 public:
     std::chrono::seconds get_sstable_window_size() const { return sstable_window_size; }
+    uint64_t get_max_data_segregation_window_count() const { return max_data_segregation_window_count; }
 
     friend class time_window_compaction_strategy;
     friend class time_window_backlog_tracker;
@@ -71,10 +77,13 @@ class time_window_compaction_strategy : public compaction_strategy_impl {
     time_window_compaction_strategy_options _options;
     size_tiered_compaction_strategy_options _stcs_options;
 public:
-    // The maximum amount of buckets we segregate data into when writing into sstables.
+    // The default maximum amount of buckets we segregate data into when writing into sstables.
     // To prevent an explosion in the number of sstables we cap it.
     // Better co-locate some windows into the same sstables than OOM.
-    static constexpr uint64_t max_data_segregation_window_count = 100;
+    // Tables receiving writes much older than their newest window can raise it
+    // with the max_data_segregation_window_count option, so that every window
+    // still gets sstables of its own, which expire as a whole.
+    static constexpr uint64_t max_data_segregation_window_count = time_window_compaction_strategy_options::DEFAULT_MAX_DATA_SEGREGATION_WINDOW_COUNT;
     static constexpr float reshape_target_space_overhead = 0.1f;
 
     using bucket_t = std::vector<shared_sstable>;
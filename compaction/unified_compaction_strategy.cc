@@ -0,0 +1,463 @@
+/*
+ * Copyright (C) 2026-present ScyllaDB
+ */
+
+/*
+ * SPDX-License-Identifier: LicenseRef-ScyllaDB-Source-Available-1.0
+ */
+
+#include "sstables/sstables.hh"
+#include "sstables/sstable_set.hh"
+#include "cql3/statements/property_definitions.hh"
+#include "compaction.hh"
+#include "compaction_manager.hh"
+#include "unified_compaction_strategy.hh"
+#include <boost/algorithm/string/trim.hpp>
+#include <cctype>
+#include <charconv>
+#include <ranges>
+
+namespace sstables {
+
+extern logging::logger clogger;
+
+unified_scaling_parameter unified_scaling_parameter::parse(std::string_view value) {
+    auto invalid = [&] {
+        return exceptions::configuration_exception(fmt::format("{} value ({}) must be T<n> or L<n> with n >= 2, N, or an integer",
+            unified_compaction_strategy_options::SCALING_PARAMETERS_KEY, value));
+    };
+    if (value.empty()) {
+        throw invalid();
+    }
+    auto parse_int = [&] (std::string_view s) {
+        int v;
+        auto [ptr, ec] = std::from_chars(s.data(), s.data() + s.size(), v);
+        if (s.empty() || ec != std::errc() || ptr != s.data() + s.size()) {
+            throw invalid();
+        }
+        return v;
+    };
+    switch (std::toupper(value.front())) {
+    case 'N':
+        if (value.size() != 1) {
+            throw invalid();
+        }
+        return unified_scaling_parameter{0};
+    case 'T':
+    case 'L': {
+        auto n = parse_int(value.substr(1));
+        if (n < 2) {
+            throw invalid();
+        }
+        return unified_scaling_parameter{std::toupper(value.front()) == 'T' ? n - 2 : 2 - n};
+    }
+    default:
+        return unified_scaling_parameter{parse_int(value)};
+    }
+}
+
+static std::vector<unified_scaling_parameter> validate_scaling_parameters(const std::map<sstring, sstring>& options) {
+    auto tmp_value = compaction_strategy_impl::get_value(options, unified_compaction_strategy_options::SCALING_PARAMETERS_KEY);
+    std::string_view value = tmp_value ? std::string_view(*tmp_value) : unified_compaction_strategy_options::DEFAULT_SCALING_PARAMETERS;
+    std::vector<unified_scaling_parameter> params;
+    for (auto part : value | std::views::split(',')) {
+        auto s = std::string(std::string_view(part.begin(), part.end()));
+        boost::algorithm::trim(s);
+        params.push_back(unified_scaling_parameter::parse(s));
+    }
+    return params;
+}
+
+static std::vector<unified_scaling_parameter> validate_scaling_parameters(const std::map<sstring, sstring>& options, std::map<sstring, sstring>& unchecked_options) {
+    auto params = validate_scaling_parameters(options);
+    unchecked_options.erase(unified_compaction_strategy_options::SCALING_PARAMETERS_KEY);
+    return params;
+}
+
+static long validate_size_in_mb(const std::map<sstring, sstring>& options, const char* key, long default_value) {
+    auto tmp_value = compaction_strategy_impl::get_value(options, key);
+    auto size_in_mb = cql3::statements::property_definitions::to_long(key, tmp_value, default_value);
+    if (size_in_mb <= 0) {
+        throw exceptions::configuration_exception(fmt::format("{} value ({}) must be positive", key, size_in_mb));
+    }
+    return size_in_mb;
+}
+
+static long validate_size_in_mb(const std::map<sstring, sstring>& options, std::map<sstring, sstring>& unchecked_options, const char* key, long default_value) {
+    auto size_in_mb = validate_size_in_mb(options, key, default_value);
+    unchecked_options.erase(key);
+    return size_in_mb;
+}
+
+static int validate_base_shard_count(const std::map<sstring, sstring>& options) {
+    auto tmp_value = compaction_strategy_impl::get_value(options, unified_compaction_strategy_options::BASE_SHARD_COUNT_KEY);
+    auto base_shard_count = cql3::statements::property_definitions::to_int(unified_compaction_strategy_options::BASE_SHARD_COUNT_KEY,
+        tmp_value, unified_compaction_strategy_options::DEFAULT_BASE_SHARD_COUNT);
+    if (base_shard_count < 1) {
+        throw exceptions::configuration_exception(fmt::format("{} value ({}) must be at least 1",
+            unified_compaction_strategy_options::BASE_SHARD_COUNT_KEY, base_shard_count));
+    }
+    return base_shard_count;
+}
+
+static int validate_base_shard_count(const std::map<sstring, sstring>& options, std::map<sstring, sstring>& unchecked_options) {
+    auto base_shard_count = validate_base_shard_count(options);
+    unchecked_options.erase(unified_compaction_strategy_options::BASE_SHARD_COUNT_KEY);
+    return base_shard_count;
+}
+
+unified_compaction_strategy_options::unified_compaction_strategy_options(const std::map<sstring, sstring>& options) {
+    _scaling_parameters = validate_scaling_parameters(options);
+    _min_sstable_size = validate_size_in_mb(options, MIN_SSTABLE_SIZE_KEY, DEFAULT_MIN_SSTABLE_SIZE_IN_MB) * 1024 * 1024;
+    _base_shard_count = validate_base_shard_count(options);
+    _target_sstable_size = validate_size_in_mb(options, TARGET_SSTABLE_SIZE_KEY, DEFAULT_TARGET_SSTABLE_SIZE_IN_MB) * 1024 * 1024;
+}
+
+// options is a map of compaction strategy options and their values.
+// unchecked_options is an analogical map from which already checked options are deleted.
+// This helps making sure that only allowed options are being set.
+void unified_compaction_strategy_options::validate(const std::map<sstring, sstring>& options, std::map<sstring, sstring>& unchecked_options) {
+    validate_scaling_parameters(options, unchecked_options);
+    validate_size_in_mb(options, unchecked_options, MIN_SSTABLE_SIZE_KEY, DEFAULT_MIN_SSTABLE_SIZE_IN_MB);
+    validate_base_shard_count(options, unchecked_options);
+    validate_size_in_mb(options, unchecked_options, TARGET_SSTABLE_SIZE_KEY, DEFAULT_TARGET_SSTABLE_SIZE_IN_MB);
+    compaction_strategy_impl::validate_min_max_threshold(options, unchecked_options);
+}
+
+unsigned unified_compaction_strategy_options::level_of(uint64_t size) const noexcept {
+    // Level 0 holds runs below min_sstable_size, and the upper bound of each
+    // level above it is the fanout of the level times the bound of the one below.
+    unsigned level = 0;
+    double bound = _min_sstable_size;
+    while (size >= bound) {
+        bound *= scaling_parameter(++level).fanout();
+    }
+    return level;
+}
+
+uint64_t unified_compaction_strategy_options::max_sstable_bytes(uint64_t input_size) const noexcept {
+    if (input_size < _min_sstable_size * _base_shard_count) {
+        return compaction_descriptor::default_max_sstable_bytes;
+    }
+    uint64_t shards = _base_shard_count;
+    double ratio = double(input_size) / (_target_sstable_size * _base_shard_count);
+    if (ratio > 1) {
+        shards <<= std::min(int(std::round(std::log2(ratio))), 32);
+    }
+    return (input_size + shards - 1) / shards;
+}
+
+std::vector<unified_compaction_strategy::level_t>
+unified_compaction_strategy::get_levels(const std::vector<frozen_sstable_run>& runs, const unified_compaction_strategy_options& options) {
+    std::vector<level_t> levels;
+    for (auto& run : runs) {
+        auto level = options.level_of(run->data_size());
+        if (level >= levels.size()) {
+            levels.resize(level + 1);
+        }
+        levels[level].push_back(run);
+    }
+    for (auto& level : levels) {
+        std::ranges::sort(level, std::less<>(), [] (const frozen_sstable_run& r) { return r->data_size(); });
+    }
+    return levels;
+}
+
+compaction_descriptor unified_compaction_strategy::make_descriptor(std::vector<frozen_sstable_run> runs) const {
+    auto input_size = std::ranges::fold_left(runs | std::views::transform([] (const frozen_sstable_run& r) { return r->data_size(); }), uint64_t(0), std::plus{});
+    return compaction_descriptor(runs_to_sstables(std::move(runs)), 0, _options.max_sstable_bytes(input_size));
+}
+
+compaction_descriptor
+unified_compaction_strategy::find_garbage_collection_job(const compaction_group_view& t, const std::vector<level_t>& levels) {
+    auto compaction_time = gc_clock::now();
+    // Start from the top level, as tombstones there are the most likely to be purgeable.
+    for (auto& level : levels | std::views::reverse) {
+        for (auto& run : level) {
+            bool worth = std::ranges::any_of(run->all(), [&] (const shared_sstable& sst) {
+                return worth_dropping_tombstones(sst, compaction_time, t);
+            });
+            if (worth) {
+                clogger.debug("UCS: starting garbage collection on run of {} bytes for {}.{}", run->data_size(), t.schema()->ks_name(), t.schema()->cf_name());
+                return make_descriptor({run});
+            }
+        }
+    }
+    return compaction_descriptor();
+}
+
+future<compaction_descriptor>
+unified_compaction_strategy::get_sstables_for_compaction(compaction_group_view& t, strategy_control& control) {
+    auto candidates = co_await control.candidates_as_runs(t);
+
+    size_t max_threshold = t.schema()->max_compaction_threshold();
+
+    auto levels = get_levels(candidates);
+
+    // Pick the level which is the furthest above its threshold, preferring
+    // lower levels on ties, as they are cheaper to compact and hold the most runs.
+    auto pick = [&] (auto threshold_of) -> std::optional<size_t> {
+        std::optional<size_t> best;
+        double best_ratio = 0;
+        for (size_t i = 0; i < levels.size(); i++) {
+            auto threshold = threshold_of(i);
+            if (levels[i].size() < threshold) {
+                continue;
+            }
+            double ratio = double(levels[i].size()) / threshold;
+            if (!best || ratio > best_ratio) {
+                best = i;
+                best_ratio = ratio;
+            }
+        }
+        return best;
+    };
+
+    auto level = pick([&] (size_t i) -> size_t { return _options.scaling_parameter(i).threshold(); });
+    // If we are not enforcing min_threshold explicitly, try any pair of sstable runs in the same level.
+    if (!level && !t.compaction_enforce_min_threshold()) {
+        level = pick([] (size_t) -> size_t { return 2; });
+    }
+    if (level) {
+        auto& runs = levels[*level];
+        runs.resize(std::min(runs.size(), std::max(max_threshold, size_t(2))));
+        clogger.debug("UCS: compacting {} runs of level {} for {}.{}", runs.size(), *level, t.schema()->ks_name(), t.schema()->cf_name());
+        co_return make_descriptor(std::move(runs));
+    }
+
+    if (control.has_ongoing_compaction(t)) {
+        co_return compaction_descriptor();
+    }
+
+    co_return find_garbage_collection_job(t, levels);
+}
+
+compaction_descriptor
+unified_compaction_strategy::get_major_compaction_job(compaction_group_view& t, std::vector<sstables::shared_sstable> candidates) {
+    if (candidates.empty()) {
+        return compaction_descriptor();
+    }
+    auto input_size = std::ranges::fold_left(candidates | std::views::transform(std::mem_fn(&sstable::data_size)), uint64_t(0), std::plus{});
+    return make_major_compaction_job(std::move(candidates), 0, _options.max_sstable_bytes(input_size));
+}
+
+future<int64_t> unified_compaction_strategy::estimated_pending_compactions(compaction_group_view& t) const {
+    size_t max_threshold = t.schema()->max_compaction_threshold();
+    int64_t n = 0;
+
+    auto main_set = co_await t.main_sstable_set();
+    auto levels = get_levels(main_set->all_sstable_runs());
+    for (size_t i = 0; i < levels.size(); i++) {
+        if (levels[i].size() >= _options.scaling_parameter(i).threshold()) {
+            n += (levels[i].size() + max_threshold - 1) / max_threshold;
+        }
+    }
+    co_return n;
+}
+
+std::vector<shared_sstable>
+unified_compaction_strategy::runs_to_sstables(std::vector<frozen_sstable_run> runs) {
+    return runs
+        | std::views::transform([] (auto& run) -> auto& { return run->all(); })
+        | std::views::join
+        | std::ranges::to<std::vector>();
+}
+
+std::vector<frozen_sstable_run>
+unified_compaction_strategy::sstables_to_runs(std::vector<shared_sstable> sstables) {
+    std::unordered_map<sstables::run_id, sstable_run> runs;
+    for (auto&& sst : sstables) {
+        // okay to ignore duplicates
+        (void)runs[sst->run_identifier()].insert(std::move(sst));
+    }
+    auto freeze = [] (const sstable_run& run) { return make_lw_shared<const sstable_run>(run); };
+    return runs | std::views::values | std::views::transform(freeze) | std::ranges::to<std::vector>();
+}
+
+static void sort_runs_by_first_key(std::vector<frozen_sstable_run>& runs, size_t max_elements, const schema_ptr& schema) {
+    auto first_key = [&schema] (const frozen_sstable_run& r) -> const dht::decorated_key& {
+        return (*std::ranges::min_element(r->all(), [&schema] (const shared_sstable& a, const shared_sstable& b) {
+            return a->get_first_decorated_key().tri_compare(*schema, b->get_first_decorated_key()) < 0;
+        }))->get_first_decorated_key();
+    };
+    std::partial_sort(runs.begin(), runs.begin() + max_elements, runs.end(), [&] (const frozen_sstable_run& a, const frozen_sstable_run& b) {
+        return first_key(a).tri_compare(*schema, first_key(b)) < 0;
+    });
+}
+
+compaction_descriptor
+unified_compaction_strategy::get_reshaping_job(std::vector<shared_sstable> input, schema_ptr schema, reshape_config cfg) const {
+    auto mode = cfg.mode;
+    size_t offstrategy_threshold = std::max(schema->min_compaction_threshold(), 4);
+    size_t max_sstables = std::max(schema->max_compaction_threshold(), int(offstrategy_threshold));
+
+    if (mode == reshape_mode::relaxed) {
+        offstrategy_threshold = max_sstables;
+    }
+
+    auto run_count = std::ranges::size(input | std::views::transform(std::mem_fn(&sstable::run_identifier)) | std::ranges::to<std::unordered_set>());
+    if (run_count >= offstrategy_threshold && mode == reshape_mode::strict) {
+        // All sstables can be reshaped at once if the amount of overlapping will not cause memory usage to be high,
+        // which is possible because partitioned set is able to incrementally open sstables during compaction
+        if (sstable_set_overlapping_count(schema, input) <= max_sstables) {
+            auto desc = make_descriptor(sstables_to_runs(std::move(input)));
+            desc.options = compaction_type_options::make_reshape();
+            return desc;
+        }
+    }
+
+    for (auto& level : get_levels(sstables_to_runs(std::move(input)))) {
+        if (level.size() >= offstrategy_threshold) {
+            // preserve token contiguity by prioritizing runs with the lowest first keys.
+            if (level.size() > max_sstables) {
+                sort_runs_by_first_key(level, max_sstables, schema);
+                level.resize(max_sstables);
+            }
+            auto desc = make_descriptor(std::move(level));
+            desc.options = compaction_type_options::make_reshape();
+            return desc;
+        }
+    }
+
+    return compaction_descriptor();
+}
+
+std::vector<compaction_descriptor>
+unified_compaction_strategy::get_cleanup_compaction_jobs(compaction_group_view& t, std::vector<shared_sstable> candidates) const {
+    std::vector<compaction_descriptor> ret;
+    const auto& schema = t.schema();
+    unsigned max_threshold = schema->max_compaction_threshold();
+
+    for (auto& level : get_levels(sstables_to_runs(std::move(candidates)))) {
+        if (level.size() > max_threshold) {
+            // preserve token contiguity
+            sort_runs_by_first_key(level, level.size(), schema);
+        }
+        auto it = level.begin();
+        while (it != level.end()) {
+            unsigned remaining = std::distance(it, level.end());
+            unsigned needed = std::min(remaining, max_threshold);
+            std::vector<frozen_sstable_run> runs;
+            std::move(it, it + needed, std::back_inserter(runs));
+            ret.push_back(make_descriptor(std::move(runs)));
+            std::advance(it, needed);
+        }
+    }
+    return ret;
+}
+
+unified_compaction_strategy::unified_compaction_strategy(const std::map<sstring, sstring>& options)
+    : compaction_strategy_impl(options)
+    , _options(options)
+{
+}
+
+// options is a map of compaction strategy options and their values.
+// unchecked_options is an analogical map from which already checked options are deleted.
+// This helps making sure that only allowed options are being set.
+void unified_compaction_strategy::validate_options(const std::map<sstring, sstring>& options, std::map<sstring, sstring>& unchecked_options) {
+    unified_compaction_strategy_options::validate(options, unchecked_options);
+}
+
+}
+
+using namespace sstables;
+
+// The backlog of a run is the number of bytes that still have to be written
+// to get its data to the top level, which is where all the data of the table
+// would be if it were fully compacted. A byte in level L will be written
+// write_amplification(l) times in each level l from L up to the top, so the
+// backlog of a run is its size times the sum of those. As with size-tiered,
+// only levels which reached their threshold contribute, so that a table in
+// a steady state, with fewer runs than the threshold in every level, has no
+// backlog.
+class unified_backlog_tracker final : public compaction_backlog_tracker::impl {
+    unified_compaction_strategy_options _options;
+    std::unordered_map<sstables::run_id, sstable_run> _all;
+    uint64_t _total_bytes = 0;
+    double _total_backlog = 0;
+    // Backlog per byte of each contributing run.
+    std::unordered_map<sstables::run_id, double> _contributions;
+
+    struct backlog_calculation_result {
+        double total_backlog = 0;
+        std::unordered_map<sstables::run_id, double> contributions;
+    };
+
+    backlog_calculation_result calculate_backlog(const std::unordered_map<sstables::run_id, sstable_run>& all, uint64_t total_bytes) const {
+        backlog_calculation_result ret;
+        auto freeze = [] (const sstable_run& run) { return make_lw_shared<const sstable_run>(run); };
+        auto levels = unified_compaction_strategy::get_levels(all | std::views::values | std::views::transform(freeze) | std::ranges::to<std::vector>(), _options);
+        unsigned top = _options.level_of(total_bytes);
+        for (unsigned level = 0; level < levels.size(); level++) {
+            if (levels[level].size() < _options.scaling_parameter(level).threshold()) {
+                continue;
+            }
+            // A level which reached its threshold is compacted at least once,
+            // even if it is already the top one.
+            double per_byte = 0;
+            for (unsigned l = level; l < std::max(top, level + 1); l++) {
+                per_byte += _options.scaling_parameter(l).write_amplification();
+            }
+            for (auto& run : levels[level]) {
+                ret.total_backlog += run->data_size() * per_byte;
+                ret.contributions.emplace((*run->all().begin())->run_identifier(), per_byte);
+            }
+        }
+        return ret;
+    }
+public:
+    explicit unified_backlog_tracker(unified_compaction_strategy_options options) : _options(std::move(options)) {}
+
+    virtual double backlog(const compaction_backlog_tracker::ongoing_writes& ow, const compaction_backlog_tracker::ongoing_compactions& oc) const override {
+        double b = _total_backlog;
+        for (auto& [sst, progress] : oc) {
+            if (auto it = _contributions.find(sst->run_identifier()); it != _contributions.end()) {
+                b -= progress->compacted() * it->second;
+            }
+        }
+        return b > 0 ? b : 0;
+    }
+
+    // Removing could be the result of a failure of an in progress write, successful finish of a
+    // compaction, or some one-off operation, like drop
+    virtual void replace_sstables(const std::vector<sstables::shared_sstable>& old_ssts, const std::vector<sstables::shared_sstable>& new_ssts) override {
+        auto all = _all;
+        auto total_bytes = _total_bytes;
+        for (auto&& sst : new_ssts) {
+            if (sst->data_size() > 0) {
+                // note: we don't expect failed insertions since each sstable will be inserted once
+                (void)all[sst->run_identifier()].insert(sst);
+                total_bytes += sst->data_size();
+            }
+        }
+        for (auto&& sst : old_ssts) {
+            if (sst->data_size() > 0) {
+                auto run_identifier = sst->run_identifier();
+                all[run_identifier].erase(sst);
+                if (all[run_identifier].all().empty()) {
+                    all.erase(run_identifier);
+                }
+                total_bytes -= sst->data_size();
+            }
+        }
+        auto result = calculate_backlog(all, total_bytes);
+
+        // commit calculations
+        std::invoke([&] () noexcept {
+            _all = std::move(all);
+            _total_bytes = total_bytes;
+            _total_backlog = result.total_backlog;
+            _contributions = std::move(result.contributions);
+        });
+    }
+};
+
+namespace sstables {
+
+std::unique_ptr<compaction_backlog_tracker::impl>
+unified_compaction_strategy::make_backlog_tracker() const {
+    return std::make_unique<unified_backlog_tracker>(_options);
+}
+
+}
@@ -0,0 +1,132 @@
+/*
+ * Copyright (C) 2026-present ScyllaDB
+ */
+
+/*
+ * SPDX-License-Identifier: LicenseRef-ScyllaDB-Source-Available-1.0
+ */
+
+#pragma once
+
+#include "compaction_strategy_impl.hh"
+#include "sstables/sstable_set.hh"
+
+class unified_backlog_tracker;
+
+namespace sstables {
+
+// The Unified Compaction Strategy (UCS) sorts sstable runs into levels of
+// exponentially growing sizes, and compacts the runs of a level once there
+// are enough of them. How many is decided by the scaling parameter W of the
+// level, which moves the level between tiered and leveled behavior:
+//
+//  - the fanout of the level, i.e. how much larger the next level is, is
+//    F = 2 + |W|;
+//  - the level is compacted when it has T runs, where T = F if W >= 0
+//    (tiered, like STCS with min_threshold=F), and T = 2 if W < 0 (leveled:
+//    each new run is merged into the one already in the level, like LCS with
+//    a fanout of F).
+//
+// W = 0 is the same for both (F = T = 2). Scaling parameters are given as
+// "T<n>" for W = n - 2, "L<n>" for W = 2 - n, "N" for W = 0, or as the
+// integer W itself, and may be different for each level.
+struct unified_scaling_parameter {
+    int w = 2;
+
+    static unified_scaling_parameter parse(std::string_view);
+
+    unsigned fanout() const noexcept {
+        return 2 + std::abs(w);
+    }
+    unsigned threshold() const noexcept {
+        return w >= 0 ? fanout() : 2;
+    }
+    // Number of times a byte is written on its way through the level.
+    double write_amplification() const noexcept {
+        // In a tiered level, data is written once when the level is compacted.
+        // In a leveled one, the run of the level is rewritten every time a
+        // new run arrives, until it reaches the size of the next level.
+        return w >= 0 ? 1.0 : (fanout() + 1) / 2.0;
+    }
+};
+
+class unified_compaction_strategy_options {
+public:
+    static constexpr auto SCALING_PARAMETERS_KEY = "scaling_parameters";
+    static constexpr auto MIN_SSTABLE_SIZE_KEY = "min_sstable_size_in_mb";
+    static constexpr auto BASE_SHARD_COUNT_KEY = "base_shard_count";
+    static constexpr auto TARGET_SSTABLE_SIZE_KEY = "target_sstable_size_in_mb";
+
+    static constexpr auto DEFAULT_SCALING_PARAMETERS = "T4";
+    static constexpr uint64_t DEFAULT_MIN_SSTABLE_SIZE_IN_MB = 100;
+    static constexpr unsigned DEFAULT_BASE_SHARD_COUNT = 4;
+    static constexpr uint64_t DEFAULT_TARGET_SSTABLE_SIZE_IN_MB = 1024;
+private:
+    // The parameter of the last level applies to all levels above it.
+    std::vector<unified_scaling_parameter> _scaling_parameters = {unified_scaling_parameter{}};
+    uint64_t _min_sstable_size = DEFAULT_MIN_SSTABLE_SIZE_IN_MB * 1024 * 1024;
+    unsigned _base_shard_count = DEFAULT_BASE_SHARD_COUNT;
+    uint64_t _target_sstable_size = DEFAULT_TARGET_SSTABLE_SIZE_IN_MB * 1024 * 1024;
+public:
+    unified_compaction_strategy_options() = default;
+    explicit unified_compaction_strategy_options(const std::map<sstring, sstring>& options);
+
+    static void validate(const std::map<sstring, sstring>& options, std::map<sstring, sstring>& unchecked_options);
+
+    const unified_scaling_parameter& scaling_parameter(unsigned level) const noexcept {
+        return _scaling_parameters[std::min<size_t>(level, _scaling_parameters.size() - 1)];
+    }
+
+    // Runs smaller than the upper bound of level 0 belong to it.
+    unsigned level_of(uint64_t size) const noexcept;
+
+    // The size the output of a compaction of input_size bytes is split at.
+    // The output is split into base_shard_count sstables, doubling the count
+    // whenever sstables would exceed the target size, so that outputs at
+    // each level are made of similarly sized sstables.
+    uint64_t max_sstable_bytes(uint64_t input_size) const noexcept;
+};
+
+class unified_compaction_strategy : public compaction_strategy_impl {
+    unified_compaction_strategy_options _options;
+
+    using level_t = std::vector<frozen_sstable_run>;
+
+    static std::vector<level_t> get_levels(const std::vector<frozen_sstable_run>& runs, const unified_compaction_strategy_options& options);
+    std::vector<level_t> get_levels(const std::vector<frozen_sstable_run>& runs) const {
+        return get_levels(runs, _options);
+    }
+
+    compaction_descriptor make_descriptor(std::vector<frozen_sstable_run> runs) const;
+    compaction_descriptor find_garbage_collection_job(const compaction_group_view& t, const std::vector<level_t>& levels);
+
+    static std::vector<shared_sstable> runs_to_sstables(std::vector<frozen_sstable_run> runs);
+    static std::vector<frozen_sstable_run> sstables_to_runs(std::vector<shared_sstable> sstables);
+public:
+    unified_compaction_strategy() = default;
+    explicit unified_compaction_strategy(const std::map<sstring, sstring>& options);
+
+    static void validate_options(const std::map<sstring, sstring>& options, std::map<sstring, sstring>& unchecked_options);
+
+    virtual future<compaction_descriptor> get_sstables_for_compaction(compaction_group_view& t, strategy_control& control) override;
+
+    virtual std::vector<compaction_descriptor> get_cleanup_compaction_jobs(compaction_group_view& t, std::vector<shared_sstable> candidates) const override;
+
+    virtual compaction_descriptor get_major_compaction_job(compaction_group_view& t, std::vector<sstables::shared_sstable> candidates) override;
+
+    virtual future<int64_t> estimated_pending_compactions(compaction_group_view& t) const override;
+
+    virtual compaction_strategy_type type() const override {
+        return compaction_strategy_type::unified;
+    }
+
+    virtual std::unique_ptr<compaction_backlog_tracker::impl> make_backlog_tracker() const override;
+
+    virtual compaction_descriptor get_reshaping_job(std::vector<shared_sstable> input, schema_ptr schema, reshape_config cfg) const override;
+
+    virtual std::unique_ptr<sstable_set_impl> make_sstable_set(const compaction_group_view& ts) const override;
+
+    friend class ::unified_backlog_tracker;
+};
+
+}
@@ -494,6 +494,7 @@ scylla_tests = set([
     'test/boost/file_stream_test',
     'test/boost/flush_queue_test',
     'test/boost/fragmented_temporary_buffer_test',
+    'test/boost/frequency_sketch_test',
     'test/boost/frozen_mutation_test',
     'test/boost/generic_server_test',
     'test/boost/gossiping_property_file_snitch_test',
@@ -596,11 +597,13 @@ scylla_tests = set([
     'test/perf/memory_footprint_test',
     'test/perf/perf_cache_eviction',
     'test/perf/perf_commitlog',
+    'test/perf/perf_compaction_strategy',
     'test/perf/perf_cql_parser',
     'test/perf/perf_hash',
     'test/perf/perf_mutation',
     'test/perf/perf_collection',
     'test/perf/perf_row_cache_reads',
+    'test/perf/perf_secondary_index',
     'test/perf/logalloc',
     'test/perf/perf_s3_client',
     'test/unit/lsa_async_eviction_test',
@@ -619,6 +622,7 @@ perf_tests = set([
     'test/perf/perf_vint',
     'test/perf/perf_big_decimal',
     'test/perf/perf_sort_by_proximity',
+    'test/perf/perf_bloom_filter',
 ])
 
 perf_standalone_tests = set([
@@ -859,6 +863,10 @@ scylla_core = (['message/messaging_service.cc',
                 'sstables/compress.cc',
                 'sstables/compressor.cc',
                 'sstables/checksummed_data_source.cc',
+                'sstables/chunk_cache.cc',
+                'sstables/clustering_filter.cc',
+                'sstables/column_zone_maps.cc',
+                'sstables/attached_index.cc',
                 'sstables/sstable_mutation_reader.cc',
                 'compaction/compaction.cc',
                 'compaction/compaction_strategy.cc',
@@ -869,6 +877,7 @@ scylla_core = (['message/messaging_service.cc',
                 'compaction/compaction_manager.cc',
                 'compaction/incremental_compaction_strategy.cc',
                 'compaction/incremental_backlog_tracker.cc',
+                'compaction/unified_compaction_strategy.cc',
                 'sstables/integrity_checked_file_impl.cc',
                 'sstables/prepended_input_stream.cc',
                 'sstables/m_format_read_helpers.cc',
@@ -1017,6 +1026,7 @@ scylla_core = (['message/messaging_service.cc',
                 'db/extensions.cc',
                 'db/functions/function.cc',
                 'db/heat_load_balance.cc',
+                'db/hot_partitions.cc',
                 'db/hints/host_filter.cc',
                 'db/hints/internal/hint_endpoint_manager.cc',
                 'db/hints/internal/hint_sender.cc',
@@ -1030,6 +1040,8 @@ scylla_core = (['message/messaging_service.cc',
                 'db/per_partition_rate_limit_options.cc',
                 'db/rate_limiter.cc',
                 'db/row_cache.cc',
+                'db/row_cache_compressed_tier.cc',
+                'db/row_cache_warmup.cc',
                 'db/schema_applier.cc',
                 'db/schema_tables.cc',
                 'db/size_estimates_virtual_reader.cc',
@@ -1053,6 +1065,7 @@ scylla_core = (['message/messaging_service.cc',
                 'index/secondary_index_manager.cc',
                 'index/secondary_index.cc',
                 'index/vector_index.cc',
+                'index/sstable_index.cc',
                 'utils/UUID_gen.cc',
                 'utils/i_filter.cc',
                 'utils/bloom_filter.cc',
@@ -1410,7 +1423,8 @@ scylla_tools = ['tools/scylla-local-file-key-generator.cc',
                 'tools/schema_loader.cc',
                 'tools/load_system_tablets.cc',
                 'tools/utils.cc',
-                'tools/lua_sstable_consumer.cc']
+                'tools/lua_sstable_consumer.cc',
+                'tools/compaction_simulator.cc']
 scylla_perfs = ['test/perf/perf_alternator.cc',
                 'test/perf/perf_fast_forward.cc',
                 'test/perf/perf_row_cache_update.cc',
@@ -1451,6 +1465,7 @@ pure_boost_tests = set([
     'test/boost/dynamic_bitset_test',
     'test/boost/enum_option_test',
     'test/boost/enum_set_test',
+    'test/boost/frequency_sketch_test',
     'test/boost/idl_test',
     'test/boost/json_test',
     'test/boost/keys_test',
@@ -1478,10 +1493,12 @@ tests_not_using_seastar_test_framework = set([
     'test/manual/message',
     'test/perf/memory_footprint_test',
     'test/perf/perf_cache_eviction',
+    'test/perf/perf_compaction_strategy',
     'test/perf/perf_cql_parser',
     'test/perf/perf_hash',
     'test/perf/perf_mutation',
     'test/perf/perf_collection',
+    'test/perf/perf_secondary_index',
     'test/perf/logalloc',
     'test/unit/lsa_async_eviction_test',
     'test/unit/lsa_sync_eviction_test',
@@ -1165,6 +1165,11 @@ statement_restrictions::statement_restrictions(data_dictionary::database db,
             throw exceptions::invalid_request_exception("Cannot execute this query as it might involve data filtering and "
                 "thus may have unpredictable performance. If you want to execute "
                 "this query despite the performance unpredictability, use ALLOW FILTERING");
+        } else if (_check_indexes && type.is_select() && _is_key_range && has_sstable_index_for_restrictions()) {
+            // The index only narrows down the scan when it can be used, which
+            // depends on the consistency level and on the data of the replica,
+            // so the query still needs ALLOW FILTERING.
+            _uses_sstable_index = true;
         }
         _index_restrictions.push_back(_nonprimary_key_restrictions);
     }
@@ -2590,6 +2595,37 @@ std::vector<query::clustering_range> statement_restrictions::get_clustering_boun
     }
 }
 
+query::column_value_ranges statement_restrictions::get_regular_column_value_ranges(const query_options& options) const {
+    query::column_value_ranges ret;
+    for (const auto& [cdef, e] : _single_column_nonprimary_key_restrictions) {
+        if (!cdef->is_regular() || !cdef->is_atomic() || cdef->is_counter()) {
+            continue;
+        }
+        const bool has_clear_bounds = !find_binop(e, [] (const binary_operator& bo) {
+            return !expr::is<column_value>(bo.lhs) || needs_filtering(bo.op);
+        });
+        if (!has_clear_bounds) {
+            continue;
+        }
+        auto range = std::visit(overloaded_functor{
+            [] (const value_list& vals) -> std::optional<interval<bytes>> {
+                if (vals.empty()) {
+                    return std::nullopt;
+                }
+                // The list is sorted, so its hull is between its first and last value.
+                return interval<bytes>::make(interval_bound(to_bytes(vals.front()), inclusive), interval_bound(to_bytes(vals.back()), inclusive));
+            },
+            [] (const interval<managed_bytes>& r) -> std::optional<interval<bytes>> {
+                return r.transform([] (const managed_bytes& v) { return to_bytes(v); });
+            },
+        }, possible_column_values(cdef, e, options));
+        if (range) {
+            ret.push_back(query::column_value_range{.id = cdef->id, .range = std::move(*range)});
+        }
+    }
+    return ret;
+}
+
 namespace {
 
 /// True iff get_partition_slice_for_global_index_posting_list() will be able to calculate the token value from the
@@ -2600,6 +2636,20 @@ bool token_known(const statement_restrictions& r) {
 
 } // anonymous namespace
 
+bool statement_restrictions::has_sstable_index_for_restrictions() const {
+    if (_single_column_nonprimary_key_restrictions.size() != 1) {
+        return false;
+    }
+    const auto& [cdef, e] = *_single_column_nonprimary_key_restrictions.begin();
+    if (!cdef->is_regular() || !std::ranges::contains(_schema->sstable_indexed_columns(), cdef->id, &column_definition::id)) {
+        return false;
+    }
+    // Only restrictions bounding the values of the column, see get_regular_column_value_ranges().
+    return !find_binop(e, [] (const binary_operator& bo) {
+        return !expr::is<column_value>(bo.lhs) || needs_filtering(bo.op);
+    });
+}
+
 bool statement_restrictions::need_filtering() const {
     using namespace expr;
 
@@ -73,6 +73,12 @@ class statement_restrictions {
      */
     bool _uses_secondary_indexing = false;
 
+    /**
+     * <code>true</code> if the restricted regular column has an sstable-attached index, which narrows down
+     * the scan of the base table, see secondary_index::sstable_index.
+     */
+    bool _uses_sstable_index = false;
+
     /**
      * Specify if the query will return a range of partition keys.
      */
@@ -193,6 +199,14 @@ class statement_restrictions {
         return _uses_secondary_indexing;
     }
 
+    /**
+     * Checks if the scan may be narrowed down by an sstable-attached index of the restricted regular column.
+     * The rows are still filtered, and the query requires ALLOW FILTERING.
+     */
+    bool uses_sstable_index() const {
+        return _uses_sstable_index;
+    }
+
     const expr::expression& get_partition_key_restrictions() const {
         return _partition_key_restrictions;
     }
@@ -312,6 +326,8 @@ class statement_restrictions {
 
     unsigned int num_clustering_prefix_columns_that_need_not_be_filtered() const;
     void calculate_column_defs_for_filtering_and_erase_restrictions_used_for_index(data_dictionary::database db);
+    /// True iff the only restricted regular column has an sstable-attached index serving its restrictions.
+    bool has_sstable_index_for_restrictions() const;
 public:
     /**
      * Returns the specified range of the partition key.
@@ -327,6 +343,13 @@ class statement_restrictions {
 public:
     std::vector<query::clustering_range> get_clustering_bounds(const query_options& options) const;
 
+    /**
+     * Returns the ranges the values of the atomic regular columns restricted by
+     * the query must be in, for replicas to skip data which can't match the
+     * filter. Restrictions which don't define a range of values are ignored.
+     */
+    query::column_value_ranges get_regular_column_value_ranges(const query_options& options) const;
+
     /**
      * Checks if the query need to use filtering.
      * @return <code>true</code> if the query need to use filtering, <code>false</code> otherwise.
@@ -190,6 +190,43 @@ contains_ttl(const expr::expression& e) {
     return contains_column_mutation_attribute(expr::column_mutation_attribute::attribute_kind::ttl, e);
 }
 
+// Returns the partition key column selected by \p e, either directly or
+// through the first() function GROUP BY wraps non-aggregates in.
+static
+const column_definition*
+selected_partition_key_column(const expr::expression& e) {
+    auto cv = expr::as_if<expr::column_value>(&e);
+    if (auto fc = expr::as_if<expr::function_call>(&e)) {
+        auto& func = std::get<shared_ptr<functions::function>>(fc->func);
+        if (func->name() == functions::aggregate_fcts::first_function_name() && fc->args.size() == 1) {
+            cv = expr::as_if<expr::column_value>(&fc->args[0]);
+        }
+    }
+    return cv && cv->col->is_partition_key() ? cv->col : nullptr;
+}
+
+static
+bool
+is_reducible_aggregate(const expr::expression& e) {
+    auto fc = expr::as_if<expr::function_call>(&e);
+    if (!fc) {
+        return false;
+    }
+    auto func = std::get<shared_ptr<cql3::functions::function>>(fc->func);
+    if (!func->is_aggregate() || func->name() == functions::aggregate_fcts::first_function_name()) {
+        return false;
+    }
+    auto agg_func = dynamic_pointer_cast<functions::aggregate_function>(std::move(func));
+    if (!agg_func->get_aggregate().state_reduction_function) {
+        return false;
+    }
+    // We only support transforming columns directly for parallel queries
+    if (!std::ranges::all_of(fc->args, expr::is<expr::column_value>)) {
+        return false;
+    }
+    return true;
+}
+
 class selection_with_processing : public selection {
 private:
     std::vector<expr::expression> _selectors;
@@ -254,28 +291,18 @@ class selection_with_processing : public selection {
     }
 
     virtual bool is_reducible() const override {
-        return std::ranges::all_of(
-                _selectors,
-               [] (const expr::expression& e) {
-                    auto fc = expr::as_if<expr::function_call>(&e);
-                    if (!fc) {
-                        return false;
-                    }
-                    auto func = std::get<shared_ptr<cql3::functions::function>>(fc->func);
-                    if (!func->is_aggregate()) {
-                        return false;
-                    }
-                    auto agg_func = dynamic_pointer_cast<functions::aggregate_function>(std::move(func));
-                    if (!agg_func->get_aggregate().state_reduction_function) {
-                        return false;
-                    }
-                    // We only support transforming columns directly for parallel queries
-                    if (!std::ranges::all_of(fc->args, expr::is<expr::column_value>)) {
-                        return false;
-                    }
-                    return true;
-                }
-        );
+        return std::ranges::all_of(_selectors, is_reducible_aggregate);
+    }
+
+    virtual bool is_reducible_by_partition_key() const override {
+        return std::ranges::any_of(_selectors, is_reducible_aggregate)
+            && std::ranges::all_of(_selectors, [] (const expr::expression& e) {
+                return selected_partition_key_column(e) || is_reducible_aggregate(e);
+            });
+    }
+
+    virtual std::vector<const column_definition*> get_partition_key_selectors() const override {
+        return _selectors | std::views::transform(selected_partition_key_column) | std::ranges::to<std::vector>();
     }
 
     virtual query::mapreduce_request::reductions_info get_reductions() const override {
@@ -285,6 +312,11 @@ class selection_with_processing : public selection {
             throw std::runtime_error("Selection doesn't have a reduction");
         };
         for (const auto& e : _selectors) {
+            if (selected_partition_key_column(e)) {
+                // Partition key columns are the groups of the reductions,
+                // see get_partition_key_selectors().
+                continue;
+            }
             auto fc = expr::as_if<expr::function_call>(&e);
             if (!fc) {
                 bad();
@@ -157,6 +157,19 @@ class selection {
 
     virtual bool is_reducible() const {return false;}
 
+    /**
+     * Returns true if, once rows are grouped by partition key, the selection
+     * can be computed from partial aggregates, i.e. every selector is either
+     * a reducible aggregate or a partition key column.
+     */
+    virtual bool is_reducible_by_partition_key() const {return false;}
+
+    /**
+     * Returns, for each selector, the partition key column it selects, or
+     * nullptr if it is an aggregate.
+     */
+    virtual std::vector<const column_definition*> get_partition_key_selectors() const {return {};}
+
     virtual query::mapreduce_request::reductions_info get_reductions() const {return {{}, {}};}
 
     /**
@@ -146,6 +146,11 @@ void cf_prop_defs::validate(const data_dictionary::database db, sstring ks_name,
         throw exceptions::configuration_exception("Per-partition rate limit is not supported yet by the whole cluster");
     }
 
+    auto caching = get_caching_options();
+    if (caching && caching->has_memory_bounds() && !db.features().row_cache_memory_bounds) {
+        throw exceptions::configuration_exception("Row cache memory options cannot be used until all nodes in the cluster enable this feature");
+    }
+
     auto tombstone_gc_options = get_tombstone_gc_options(schema_extensions);
     validate_tombstone_gc_options(tombstone_gc_options, db, ks_name);
 
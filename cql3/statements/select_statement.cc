@@ -21,6 +21,7 @@
 #include "exceptions/exceptions.hh"
 #include <seastar/core/future.hh>
 #include <seastar/coroutine/exception.hh>
+#include <seastar/coroutine/as_future.hh>
 #include "service/broadcast_tables/experimental/lang.hh"
 #include "service/qos/qos_common.hh"
 #include "service/vector_store_client.hh"
@@ -33,6 +34,7 @@
 #include "types/vector.hh"
 #include "validation.hh"
 #include "exceptions/unrecognized_entity_exception.hh"
+#include <deque>
 #include <optional>
 #include <ranges>
 #include <variant>
@@ -315,8 +317,18 @@ select_statement::make_partition_slice(const query_options& options) const
 
     const uint64_t per_partition_limit = get_inner_loop_limit(get_limit(options, _per_partition_limit, true),
         _selection->is_aggregate());
-    return query::partition_slice(std::move(bounds),
+    auto slice = query::partition_slice(std::move(bounds),
         std::move(static_columns), std::move(regular_columns), _opts, nullptr, per_partition_limit);
+    // Replicas skip sstables whose column zone maps show they have no rows
+    // matching the filter, and partitions their sstable-attached indexes
+    // don't find. With several replicas, the skipped data could shadow rows
+    // returned by another replica, so only do it when one replica is queried.
+    const auto cl = options.get_consistency();
+    if ((_schema->column_zone_maps() || _restrictions->uses_sstable_index()) && _restrictions->need_filtering()
+            && (cl == db::consistency_level::ONE || cl == db::consistency_level::LOCAL_ONE)) {
+        slice.set_value_ranges(_restrictions->get_regular_column_value_ranges(options));
+    }
+    return slice;
 }
 
 uint64_t select_statement::get_limit(const query_options& options, const std::optional<expr::expression>& limit, bool is_per_partition_limit) const
@@ -769,59 +781,114 @@ indexed_table_select_statement::do_execute_base_query(
         gc_clock::time_point now,
         lw_shared_ptr<const service::pager::paging_state> paging_state) const {
     using value_type = std::tuple<foreign_ptr<lw_shared_ptr<query::result>>, lw_shared_ptr<query::read_command>>;
+    using read_result_type = coordinator_result<foreign_ptr<lw_shared_ptr<query::result>>>;
     auto cmd = prepare_command_for_base_query(qp, options, state, now, bool(paging_state));
     auto timeout = db::timeout_clock::now() + get_timeout(state.get_client_state(), options);
 
-    query::result_merger merger(cmd->get_row_limit(), query::max_partitions);
-    std::vector<primary_key> keys = std::move(primary_keys);
-    std::vector<primary_key>::iterator key_it(keys.begin());
-    size_t previous_result_size = 0;
-    size_t next_iteration_size = 0;
-
-    const bool is_paged = bool(paging_state);
-    while (key_it != keys.end()) {
-        // Starting with 1 key, we check if the result was a short read, and if not,
-        // we continue exponentially, asking for 2x more key than before
-        auto already_done = std::distance(keys.begin(), key_it);
-        // If the previous result already provided 1MB worth of data,
-        // stop increasing the number of fetched partitions
-        if (previous_result_size < query::result_memory_limiter::maximum_result_size) {
-            next_iteration_size = already_done + 1;
-        }
-        next_iteration_size = std::min<size_t>({next_iteration_size, keys.size() - already_done, max_base_table_query_concurrency});
-        auto key_it_end = key_it + next_iteration_size;
-
-        query::result_merger oneshot_merger(cmd->get_row_limit(), query::max_partitions);
-        coordinator_result<foreign_ptr<lw_shared_ptr<query::result>>> rresult = co_await utils::result_map_reduce(key_it, key_it_end, coroutine::lambda([&] (auto& key)
-                -> future<coordinator_result<foreign_ptr<lw_shared_ptr<query::result>>>> {
-            auto command = ::make_lw_shared<query::read_command>(*cmd);
-            // for each partition, read just one clustering row (TODO: can
-            // get all needed rows of one partition at once.)
-            command->slice._row_ranges.clear();
-            if (key.clustering) {
-                command->slice._row_ranges.push_back(query::clustering_range::make_singular(key.clustering));
+    // Rows are fetched with as few reads as possible without changing their
+    // order, which is not necessarily the clustering order (keys of an ANN
+    // query are ordered by distance):
+    //  - consecutive rows of a partition, in clustering order, are read together;
+    //  - consecutive partitions with the same rows are read together, so that
+    //    the coordinator can send a single request to each of their replicas.
+    struct base_read {
+        dht::partition_range_vector partitions;
+        std::vector<clustering_key_prefix> rows;
+    };
+    const auto ck_less = clustering_key_prefix::less_compare(*_schema);
+    const auto ck_equal = clustering_key_prefix::equality(*_schema);
+    const bool group_rows = !cmd->slice.is_reversed();
+    std::vector<base_read> reads;
+    const primary_key* previous_key = nullptr;
+    for (const auto& key : primary_keys) {
+        if (group_rows && previous_key && reads.back().partitions.size() == 1 && previous_key->partition.equal(*_schema, key.partition)
+                && !previous_key->clustering.is_empty() && ck_less(previous_key->clustering, key.clustering)) {
+            reads.back().rows.push_back(key.clustering);
+        } else {
+            auto& read = reads.emplace_back(base_read{.partitions = {dht::partition_range::make_singular(key.partition)}});
+            if (!key.clustering.is_empty()) {
+                read.rows.push_back(key.clustering);
             }
-            coordinator_result<service::storage_proxy::coordinator_query_result> rqr
-                    = co_await qp.proxy().query_result(_schema, command, {dht::partition_range::make_singular(key.partition)}, options.get_consistency(), {timeout, state.get_permit(), state.get_client_state(), state.get_trace_state()});
-            if (!rqr.has_value()) {
-                co_return std::move(rqr).as_failure();
+        }
+        previous_key = &key;
+    }
+    std::vector<base_read> merged_reads;
+    for (auto& read : reads) {
+        if (!merged_reads.empty()) {
+            auto& last = merged_reads.back();
+            if (last.partitions.size() < max_partitions_per_base_table_query && std::ranges::equal(last.rows, read.rows, ck_equal)) {
+                last.partitions.push_back(std::move(read.partitions.front()));
+                continue;
             }
-            co_return std::move(rqr.value().query_result);
-        }), std::move(oneshot_merger));
+        }
+        merged_reads.push_back(std::move(read));
+    }
+    reads = std::move(merged_reads);
+    tracing::trace(state.get_trace_state(), "Fetching {} base rows with {} reads", primary_keys.size(), reads.size());
+
+    auto fetch = [&] (const base_read& read) -> future<read_result_type> {
+        auto command = ::make_lw_shared<query::read_command>(*cmd);
+        command->slice._row_ranges.clear();
+        for (const auto& ck : read.rows) {
+            command->slice._row_ranges.push_back(query::clustering_range::make_singular(ck));
+        }
+        coordinator_result<service::storage_proxy::coordinator_query_result> rqr
+                = co_await qp.proxy().query_result(_schema, command, dht::partition_range_vector(read.partitions), options.get_consistency(), {timeout, state.get_permit(), state.get_client_state(), state.get_trace_state()});
+        if (!rqr.has_value()) {
+            co_return std::move(rqr).as_failure();
+        }
+        co_return std::move(rqr.value().query_result);
+    };
+
+    // The reads are pipelined: up to `concurrency` of them are in flight, and
+    // a new one is started as soon as the oldest one is consumed. Starting
+    // with 1, the concurrency grows with each consumed result, unless the
+    // result already provided 1MB worth of data.
+    query::result_merger merger(cmd->get_row_limit(), query::max_partitions);
+    std::deque<future<read_result_type>> in_flight;
+    auto drain = [&] () -> future<> {
+        // The reads reference the state of this function, wait for them
+        // even if their results are no longer needed.
+        while (!in_flight.empty()) {
+            auto f = co_await coroutine::as_future(std::move(in_flight.front()));
+            in_flight.pop_front();
+            f.ignore_ready_future();
+        }
+    };
+    auto next_read = reads.begin();
+    size_t concurrency = 1;
+    size_t page_size = 0;
+    const bool is_paged = bool(paging_state);
+    while (next_read != reads.end() || !in_flight.empty()) {
+        while (next_read != reads.end() && in_flight.size() < concurrency) {
+            in_flight.push_back(fetch(*next_read++));
+        }
+        auto f = co_await coroutine::as_future(std::move(in_flight.front()));
+        in_flight.pop_front();
+        if (f.failed()) {
+            co_await drain();
+            co_await coroutine::return_exception_ptr(f.get_exception());
+        }
+        auto rresult = f.get();
         if (!rresult.has_value()) {
+            co_await drain();
             co_return std::move(rresult).as_failure();
         }
         auto& result = rresult.value();
         auto is_short_read = result->is_short_read();
-        // Results larger than 1MB should be shipped to the client immediately
-        const bool page_limit_reached = is_paged && result->buf().size() >= query::result_memory_limiter::maximum_result_size;
-        previous_result_size = result->buf().size();
+        if (result->buf().size() < query::result_memory_limiter::maximum_result_size) {
+            concurrency = std::min(concurrency + 1, max_base_table_query_concurrency);
+        }
+        page_size += result->buf().size();
         merger(std::move(result));
-        key_it = key_it_end;
+        // Results larger than 1MB should be shipped to the client immediately
+        const bool page_limit_reached = is_paged && page_size >= query::result_memory_limiter::maximum_result_size;
         if (is_short_read || page_limit_reached) {
             break;
         }
     }
+    co_await drain();
+    tracing::trace(state.get_trace_state(), "Fetched base rows with {} reads", std::distance(reads.begin(), next_read));
     co_return value_type(merger.get(), std::move(cmd));
 }
 
@@ -1278,54 +1345,93 @@ indexed_table_select_statement::do_execute(query_processor& qp,
     if (aggregate) {
         cql3::selection::result_set_builder builder(*_selection, now, &options, *_group_by_cell_indices);
         std::unique_ptr<cql3::query_options> internal_options = std::make_unique<cql3::query_options>(cql3::query_options(options));
-        stop_iteration stop;
         // page size is set to the internal count page size, regardless of the user-provided value
         internal_options.reset(new cql3::query_options(std::move(internal_options), options.get_paging_state(), internal_paging_size));
-        do {
-            auto consume_results = [this, &builder, &options, &internal_options, &state] (foreign_ptr<lw_shared_ptr<query::result>> results, lw_shared_ptr<query::read_command> cmd, lw_shared_ptr<const service::pager::paging_state> paging_state) -> stop_iteration {
-                if (paging_state) {
-                    paging_state = generate_view_paging_state_from_base_query_results(paging_state, results, state, options);
+        auto consume_results = [this, &builder, &options, &internal_options] (foreign_ptr<lw_shared_ptr<query::result>> results, lw_shared_ptr<query::read_command> cmd, lw_shared_ptr<const service::pager::paging_state> paging_state) -> stop_iteration {
+            internal_options.reset(new cql3::query_options(std::move(internal_options), paging_state ? make_lw_shared<service::pager::paging_state>(*paging_state) : nullptr));
+            if (_restrictions_need_filtering) {
+                _stats.filtered_rows_read_total += *results->row_count();
+                query::result_view::consume(*results, cmd->slice, cql3::selection::result_set_builder::visitor(builder, *_schema, *_selection,
+                        cql3::selection::result_set_builder::restrictions_filter(_restrictions, options, cmd->get_row_limit(), _schema, cmd->slice.partition_row_limit())));
+            } else {
+                query::result_view::consume(*results, cmd->slice, cql3::selection::result_set_builder::visitor(builder, *_schema, *_selection));
+            }
+            bool has_more_pages = paging_state && paging_state->get_remaining() > 0;
+            return stop_iteration(!has_more_pages);
+        };
+
+        // Index pages are pipelined with base reads: while the base rows of
+        // a page are read, the next page of the index is already fetched,
+        // assuming the base read won't stop early. The prefetched page is
+        // only used if the assumption holds, i.e. if the paging state built
+        // from the base results is the one the index returned.
+        auto aggregate_pages = [&] (auto find_index_keys) -> future<coordinator_result<>> {
+            auto page = co_await find_index_keys(*internal_options);
+            while (true) {
+                if (page.has_error()) {
+                    co_return std::move(page).as_failure();
                 }
-                internal_options.reset(new cql3::query_options(std::move(internal_options), paging_state ? make_lw_shared<service::pager::paging_state>(*paging_state) : nullptr));
-                if (_restrictions_need_filtering) {
-                    _stats.filtered_rows_read_total += *results->row_count();
-                    query::result_view::consume(*results, cmd->slice, cql3::selection::result_set_builder::visitor(builder, *_schema, *_selection,
-                            cql3::selection::result_set_builder::restrictions_filter(_restrictions, options, cmd->get_row_limit(), _schema, cmd->slice.partition_row_limit())));
-                } else {
-                    query::result_view::consume(*results, cmd->slice, cql3::selection::result_set_builder::visitor(builder, *_schema, *_selection));
+                auto&& [keys, index_paging_state] = page.assume_value();
+                std::unique_ptr<cql3::query_options> prefetch_options;
+                std::optional<decltype(find_index_keys(*internal_options))> prefetch;
+                if (index_paging_state && index_paging_state->get_remaining() > 0) {
+                    tracing::trace(state.get_trace_state(), "Prefetching the next page of index {}", _index.metadata().name());
+                    prefetch_options = std::make_unique<cql3::query_options>(cql3::query_options(*internal_options));
+                    prefetch_options.reset(new cql3::query_options(std::move(prefetch_options), make_lw_shared<service::pager::paging_state>(*index_paging_state)));
+                    prefetch = find_index_keys(*prefetch_options);
                 }
-                bool has_more_pages = paging_state && paging_state->get_remaining() > 0;
-                return stop_iteration(!has_more_pages);
-            };
+                auto discard_prefetch = [&] () -> future<> {
+                    if (prefetch) {
+                        auto f = co_await coroutine::as_future(std::move(*prefetch));
+                        prefetch.reset();
+                        f.ignore_ready_future();
+                    }
+                };
 
-            if (whole_partitions || partition_slices) {
-                tracing::trace(state.get_trace_state(), "Consulting index {} for a single slice of keys, aggregation query", _index.metadata().name());
-                auto result_partition_ranges_and_paging_state = co_await find_index_partition_ranges(qp, state, *internal_options);
-                if (result_partition_ranges_and_paging_state.has_error()) {
-                    co_return failed_result_to_result_message(std::move(result_partition_ranges_and_paging_state));
+                auto f = co_await coroutine::as_future(do_execute_base_query(qp, std::move(keys), state, *internal_options, now, index_paging_state));
+                if (f.failed()) {
+                    co_await discard_prefetch();
+                    co_await coroutine::return_exception_ptr(f.get_exception());
                 }
-                auto&& [partition_ranges, paging_state] = result_partition_ranges_and_paging_state.assume_value();
-                auto result_results_and_cmd = co_await do_execute_base_query(qp, std::move(partition_ranges), state, *internal_options, now, paging_state);
+                auto result_results_and_cmd = f.get();
                 if (result_results_and_cmd.has_error()) {
-                    co_return failed_result_to_result_message(std::move(result_results_and_cmd));
+                    co_await discard_prefetch();
+                    co_return std::move(result_results_and_cmd).as_failure();
                 }
                 auto&& [results, cmd] = result_results_and_cmd.assume_value();
-                stop = consume_results(std::move(results), std::move(cmd), std::move(paging_state));
-            } else {
-                tracing::trace(state.get_trace_state(), "Consulting index {} for a list of rows containing keys, aggregation query", _index.metadata().name());
-                auto result_primary_keys_paging_state = co_await find_index_clustering_rows(qp, state, *internal_options);
-                if (result_primary_keys_paging_state.has_error()) {
-                    co_return failed_result_to_result_message(std::move(result_primary_keys_paging_state));
+                auto paging_state = index_paging_state;
+                if (paging_state) {
+                    paging_state = generate_view_paging_state_from_base_query_results(paging_state, results, state, options);
+                }
+                const bool prefetch_valid = paging_state == index_paging_state;
+                if (consume_results(std::move(results), std::move(cmd), std::move(paging_state))) {
+                    co_await discard_prefetch();
+                    co_return bo::success();
                 }
-                auto&& [primary_keys, paging_state] = result_primary_keys_paging_state.assume_value();
-                auto result_results_cmd = co_await this->do_execute_base_query(qp, std::move(primary_keys), state, *internal_options, now, paging_state);
-                if (result_results_cmd.has_error()) {
-                    co_return failed_result_to_result_message(std::move(result_results_cmd));
+                if (prefetch_valid) {
+                    page = co_await std::move(*prefetch);
+                } else {
+                    co_await discard_prefetch();
+                    page = co_await find_index_keys(*internal_options);
                 }
-                auto&& [results, cmd] = result_results_cmd.assume_value();
-                stop = consume_results(std::move(results), std::move(cmd), std::move(paging_state));
             }
-        } while (!stop);
+        };
+
+        coordinator_result<> result_void = bo::success();
+        if (whole_partitions || partition_slices) {
+            result_void = co_await aggregate_pages([&] (const query_options& o) {
+                tracing::trace(state.get_trace_state(), "Consulting index {} for a single slice of keys, aggregation query", _index.metadata().name());
+                return find_index_partition_ranges(qp, state, o);
+            });
+        } else {
+            result_void = co_await aggregate_pages([&] (const query_options& o) {
+                tracing::trace(state.get_trace_state(), "Consulting index {} for a list of rows containing keys, aggregation query", _index.metadata().name());
+                return find_index_clustering_rows(qp, state, o);
+            });
+        }
+        if (!result_void) {
+            co_return failed_result_to_result_message(std::move(result_void));
+        }
 
         auto rs = builder.build();
         update_stats_rows_read(rs->size());
@@ -1723,6 +1829,17 @@ parallelized_select_statement::do_execute(
     service::query_state& state,
     const query_options& options
 ) const {
+    const auto paging_state = options.get_paging_state();
+    // Pages of grouped results end after the last group, so a paging state
+    // ending inside a partition comes from the regular, non-parallelized, path.
+    if (has_group_by() && paging_state && paging_state->get_partition_region() == partition_region::clustered) {
+        return select_statement::do_execute(qp, state, options);
+    }
+    const auto limit = paging_state ? paging_state->get_remaining() : get_limit(options, _limit);
+    // A page holds up to page size groups.
+    const auto page_size = options.get_page_size();
+    const uint64_t group_limit = page_size > 0 ? std::min<uint64_t>(limit, page_size) : limit;
+
     tracing::add_table_name(state.get_trace_state(), keyspace(), column_family());
 
     auto cl = options.get_consistency();
@@ -1756,6 +1873,18 @@ parallelized_select_statement::do_execute(
         options.get_timestamp(state)
     );
     auto key_ranges = _restrictions->get_partition_key_ranges(options);
+    if (has_group_by() && paging_state) {
+        // Continue after the last group of the previous page.
+        const auto last = dht::ring_position(dht::decorate_key(*_schema, paging_state->get_partition_key()));
+        const auto cmp = dht::ring_position_comparator(*_schema);
+        dht::partition_range_vector remaining_ranges;
+        for (const auto& range : key_ranges) {
+            if (auto trimmed = range.trim_front(dht::partition_range::bound(last, false), cmp)) {
+                remaining_ranges.push_back(std::move(*trimmed));
+            }
+        }
+        key_ranges = std::move(remaining_ranges);
+    }
 
     if (db::is_serial_consistency(options.get_consistency())) {
         throw exceptions::invalid_request_exception(
@@ -1776,12 +1905,48 @@ parallelized_select_statement::do_execute(
         .timeout = timeout,
         .aggregation_infos = reductions.infos,
     };
+    if (has_group_by()) {
+        req.group_by_column_names = *_group_by_cell_indices
+                | std::views::transform([this] (size_t index) { return _selection->get_columns()[index]->name_as_text(); })
+                | std::ranges::to<std::vector>();
+        // Groups are partitions, so no more than the groups of the page are
+        // needed from any replica.
+        req.cmd.partition_limit = std::min<uint64_t>(group_limit, query::max_partitions);
+    }
 
     // dispatch execution of this statement to other nodes
-    return qp.mapreduce(req, state.get_trace_state()).then([this] (query::mapreduce_result res) {
+    return qp.mapreduce(req, state.get_trace_state()).then([this, limit, group_limit] (query::mapreduce_result res) {
         auto meta = _selection->get_result_metadata();
         auto rs = std::make_unique<result_set>(std::move(meta));
-        rs->add_row(res.query_results);
+        if (res.grouped_query_results) {
+            auto& groups = *res.grouped_query_results;
+            // Groups are in token order. A full page may be followed by more
+            // groups, which the next page starts after the last one of this page.
+            if (groups.size() >= group_limit && group_limit < limit) {
+                auto last_key = partition_key::from_exploded(*_schema, groups[group_limit - 1]
+                        | std::views::take(_schema->partition_key_size())
+                        | std::views::transform([] (const bytes_opt& v) { return v.value_or(bytes()); })
+                        | std::ranges::to<std::vector<bytes>>());
+                rs->get_metadata().set_paging_state(make_lw_shared<const service::pager::paging_state>(std::move(last_key),
+                        position_in_partition_view::for_partition_start(), limit - group_limit, query_id::create_null_id(),
+                        service::pager::paging_state::replicas_per_token_range{}, std::nullopt, 0));
+            }
+            // Each group holds the partition key followed by the reductions,
+            // lay them out in the order of the selectors.
+            auto pk_selectors = _selection->get_partition_key_selectors();
+            for (auto& group : *res.grouped_query_results) {
+                std::vector<bytes_opt> row;
+                row.reserve(pk_selectors.size());
+                size_t reduction = _schema->partition_key_size();
+                for (auto col : pk_selectors) {
+                    row.push_back(col ? group[col->component_index()] : std::move(group[reduction++]));
+                }
+                rs->add_row(std::move(row));
+            }
+            rs->trim(group_limit);
+        } else {
+            rs->add_row(res.query_results);
+        }
         update_stats_rows_read(rs->size());
         return shared_ptr<cql_transport::messages::result_message>(
             make_shared<cql_transport::messages::result_message::rows>(result(std::move(rs)))
@@ -2192,17 +2357,35 @@ std::unique_ptr<prepared_statement> select_statement::prepare(data_dictionary::d
         return underlying_schema->table().get_effective_replication_map()->get_replication_strategy().is_local();
     };
 
+    // GROUP BY the partition key can be parallelized too: a group never spans
+    // partitions, so each shard can aggregate the groups it owns.
+    auto is_grouped_by_partition_key = [&] {
+        return group_by_cell_indices->size() == schema->partition_key_size()
+            && std::ranges::all_of(*group_by_cell_indices, [&] (size_t index) {
+                return selection->get_columns()[index]->is_partition_key();
+            });
+    };
+
     // Used to determine if an execution of this statement can be parallelized
     // using `mapreduce_service`.
     auto can_be_mapreduced = [&] {
-        return all_aggregates(prepared_selectors)   // Note: before we levellized aggregation depth
-            && ( // SUPPORTED PARALLELIZATION
-                 // All potential intermediate coordinators must support mapreduceing
-                (db.features().parallelized_aggregation && selection->is_count())
-                || (db.features().uda_native_parallelized_aggregation && selection->is_reducible())
-            )
+        return ((
+                    all_aggregates(prepared_selectors)   // Note: before we levellized aggregation depth
+                    && ( // SUPPORTED PARALLELIZATION
+                         // All potential intermediate coordinators must support mapreduceing
+                        (db.features().parallelized_aggregation && selection->is_count())
+                        || (db.features().uda_native_parallelized_aggregation && selection->is_reducible())
+                    )
+                    && group_by_cell_indices->empty()   // No GROUP BY
+                ) || (
+                    db.features().parallelized_group_by
+                    && is_grouped_by_partition_key()
+                    && selection->is_reducible_by_partition_key()
+                    && !_per_partition_limit
+                    && !_parameters->is_distinct()
+                    && !ordering_comparator
+                ))
             && !restrictions->need_filtering()  // No filtering
-            && group_by_cell_indices->empty()   // No GROUP BY
             && db.get_config().enable_parallelized_aggregation()
             && !is_local_table()
             && !( // Do not parallelize the request if it's single partition read
@@ -193,6 +193,7 @@ class indexed_table_select_statement : public select_statement {
     noncopyable_function<query::partition_slice(const query_options&)> _get_partition_slice_for_posting_list;
 public:
     static constexpr size_t max_base_table_query_concurrency = 4096;
+    static constexpr size_t max_partitions_per_base_table_query = 128;
     static constexpr size_t max_ann_query_limit = 1000;
     static constexpr std::string_view ann_custom_index_option = "vector_index";
 
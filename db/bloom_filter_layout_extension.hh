@@ -0,0 +1,84 @@
+/*
+ * Copyright (C) 2026-present ScyllaDB
+ */
+
+/*
+ * SPDX-License-Identifier: LicenseRef-ScyllaDB-Source-Available-1.0
+ */
+
+#pragma once
+
+#include <seastar/core/on_internal_error.hh>
+
+#include "exceptions/exceptions.hh"
+#include "serializer.hh"
+#include "schema/schema.hh"
+#include "utils/i_filter.hh"
+#include "utils/log.hh"
+
+extern logging::logger dblog;
+
+namespace db {
+
+/**
+ * \brief Schema extension which represents `bloom_filter_layout` per-table option.
+ *
+ * Selects the layout of the bloom filters of sstables written for the table:
+ * 'classic' (the default) or 'split_block', which probes a single cache line
+ * per key at the cost of somewhat more memory for the same false positive rate.
+ *
+ * Only affects newly written sstables. Each sstable records the layout of its
+ * filter, so existing sstables remain readable after the option changes.
+ */
+class bloom_filter_layout_extension : public schema_extension {
+    utils::filter_layout _layout = utils::filter_layout::classic;
+
+    static utils::filter_layout parse(const sstring& s) {
+        if (s == "classic") {
+            return utils::filter_layout::classic;
+        }
+        if (s == "split_block") {
+            return utils::filter_layout::split_block;
+        }
+        throw exceptions::configuration_exception(format("Invalid bloom_filter_layout '{}': must be 'classic' or 'split_block'", s));
+    }
+public:
+    static constexpr auto NAME = "bloom_filter_layout";
+
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wdeprecated-declarations"
+    bloom_filter_layout_extension() = default;
+
+    explicit bloom_filter_layout_extension(utils::filter_layout layout)
+        : _layout(layout)
+    {}
+
+    explicit bloom_filter_layout_extension(const std::map<sstring, sstring>& map) {
+        on_internal_error(dblog, "Cannot create bloom_filter_layout_extension from map");
+    }
+
+    explicit bloom_filter_layout_extension(bytes b) : _layout(parse(deserialize(b)))
+    {}
+
+    explicit bloom_filter_layout_extension(const sstring& s) : _layout(parse(s))
+    {}
+#pragma clang diagnostic pop
+
+    bytes serialize() const override {
+        return ser::serialize_to_buffer<bytes>(sstring(options_to_string()));
+    }
+
+    std::string options_to_string() const override {
+        return _layout == utils::filter_layout::split_block ? "split_block" : "classic";
+    }
+
+    static sstring deserialize(const bytes_view& buffer) {
+        return ser::deserialize_from_buffer(buffer, std::type_identity<sstring>());
+    }
+
+    utils::filter_layout get_layout() const {
+        return _layout;
+    }
+};
+
+} // namespace db
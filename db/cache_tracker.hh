@@ -14,9 +14,13 @@
 #include "mutation/partition_version.hh"
 #include "mutation/mutation_cleaner.hh"
 #include "utils/cached_file_stats.hh"
+#include "utils/frequency_sketch.hh"
+#include "db/row_cache_compressed_tier.hh"
 #include "sstables/partition_index_cache_stats.hh"
+#include "sstables/chunk_cache_stats.hh"
 
 #include <seastar/core/metrics_registration.hh>
+#include <seastar/core/timer.hh>
 
 #include <stdint.h>
 
@@ -73,6 +77,9 @@ class cache_tracker final {
         uint64_t row_tombstone_reads;
         uint64_t rows_compacted;
         uint64_t rows_compacted_away;
+        uint64_t scan_admissions;
+        uint64_t scan_admission_rejects;
+        uint64_t reclaimer_evictions;
 
         uint64_t active_reads() const {
             return reads - reads_done;
@@ -82,6 +89,7 @@ class cache_tracker final {
     stats _stats{};
     cached_file_stats _index_cached_file_stats{};
     partition_index_cache_stats _partition_index_cache_stats{};
+    chunk_cache_stats _chunk_cache_stats{};
     seastar::metrics::metric_groups _metrics;
     logalloc::region _region;
     lru _lru;
@@ -89,8 +97,41 @@ class cache_tracker final {
     mutation_cleaner _memtable_cleaner;
     mutation_application_stats& _app_stats;
     utils::updateable_value<double> _index_cache_fraction;
+    // Scan resistance (TinyLFU-style admission).
+    //
+    // Single-partition reads record accesses in _frequency_sketch. When a range scan
+    // is done with a partition, the partition is admitted to its regular LRU position
+    // only if its estimated access frequency is at least _scan_admission_threshold.
+    // Otherwise it is moved to the cold end of the LRU, so that one-shot scans
+    // evict each other rather than the frequently read working set.
+    utils::frequency_sketch _frequency_sketch;
+    utils::updateable_value<uint32_t> _scan_admission_threshold;
+    // Memory bounds, see set_memory_bounds().
+    size_t _memory_reservation = 0;
+    size_t _memory_limit = 0;
+    seastar::timer<seastar::lowres_clock> _memory_limit_timer;
+    // Compressed tier.
+    //
+    // When the reclaimer has been evicting, a periodic sweep moves partitions
+    // which weren't read recently out of the LRU into _compressed_tier, which
+    // keeps them LZ4-compressed in standard memory, up to _compressed_tier_fraction
+    // of shard memory, and gives it back under memory pressure. Cache misses
+    // look there before going to sstables.
+    cache::compressed_tier _compressed_tier;
+    utils::updateable_value<double> _compressed_tier_fraction;
+    std::optional<utils::observer<double>> _compressed_tier_fraction_observer;
+    seastar::timer<seastar::lowres_clock> _compression_timer;
+    uint64_t _reclaimer_evictions_at_last_sweep = 0;
 private:
     void setup_metrics();
+    void enforce_memory_limit() noexcept;
+    // Runs the compression sweep only while the compressed tier is enabled.
+    void update_compression_timer() noexcept;
+    void compress_cold_partitions() noexcept;
+    // Moves rows of the partition, up to max_demoted_rows of them, to the
+    // least recently used end of the LRU.
+    void demote(cache_entry&) noexcept;
+    static constexpr size_t max_demoted_rows = 128;
 public:
     using register_metrics = bool_class<class register_metrics_tag>;
     cache_tracker(utils::updateable_value<double> index_cache_fraction, mutation_application_stats&, register_metrics);
@@ -126,6 +167,34 @@ class cache_tracker final {
     void on_row_tombstone_read() noexcept { ++_stats.row_tombstone_reads; }
     void on_row_compacted() noexcept { ++_stats.rows_compacted; }
     void on_row_compacted_away() noexcept { ++_stats.rows_compacted_away; }
+    bool scan_resistant() const noexcept { return _scan_admission_threshold.get() != 0; }
+    // Records a single-partition read of a partition with given key hash.
+    void on_partition_access(uint64_t key_hash) noexcept {
+        if (scan_resistant()) {
+            _frequency_sketch.increment(key_hash);
+        }
+    }
+    // Estimated number of recent single-partition reads of a partition with given key hash.
+    unsigned estimate_frequency(uint64_t key_hash) const noexcept {
+        return _frequency_sketch.estimate(key_hash);
+    }
+    // Called when a range scan is done reading given partition.
+    void on_partition_scanned(cache_entry&, uint64_t key_hash) noexcept;
+    void set_scan_admission_threshold(utils::updateable_value<uint32_t>);
+    // Bounds the amount of memory used by this tracker's region.
+    // The reclaimer doesn't evict while the region uses no more than `reservation` bytes.
+    // When the region grows above `limit` bytes (0 means no limit), entries are evicted
+    // in the background until it fits again, regardless of memory pressure.
+    // Meant for trackers dedicated to tables with memory bounds in their caching options.
+    void set_memory_bounds(size_t reservation, size_t limit);
+    // Registers the metrics of a tracker dedicated to a single table, labeled with it.
+    void setup_table_metrics(const sstring& ks_name, const sstring& cf_name);
+    size_t memory_reservation() const noexcept { return _memory_reservation; }
+    size_t memory_limit() const noexcept { return _memory_limit; }
+    // Enables the compressed tier, with a memory budget of given fraction of shard memory.
+    void set_compressed_tier_fraction(utils::updateable_value<double>);
+    size_t compressed_tier_budget() const noexcept;
+    cache::compressed_tier& compressed_tier() noexcept { return _compressed_tier; }
     void pinned_dirty_memory_overload(uint64_t bytes) noexcept;
     allocation_strategy& allocator() noexcept;
     logalloc::region& region() noexcept;
@@ -139,6 +208,7 @@ class cache_tracker final {
     lru& get_lru() { return _lru; }
     cached_file_stats& get_index_cached_file_stats() { return _index_cached_file_stats; }
     partition_index_cache_stats& get_partition_index_cache_stats() { return _partition_index_cache_stats; }
+    chunk_cache_stats& get_chunk_cache_stats() { return _chunk_cache_stats; }
     seastar::memory::reclaiming_result evict_from_lru_shallow() noexcept;
 };
 
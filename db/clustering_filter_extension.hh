@@ -0,0 +1,88 @@
+/*
+ * Copyright (C) 2026-present ScyllaDB
+ */
+
+/*
+ * SPDX-License-Identifier: LicenseRef-ScyllaDB-Source-Available-1.0
+ */
+
+#pragma once
+
+#include <seastar/core/on_internal_error.hh>
+
+#include "exceptions/exceptions.hh"
+#include "serializer.hh"
+#include "schema/schema.hh"
+#include "utils/log.hh"
+
+extern logging::logger dblog;
+
+namespace db {
+
+/**
+ * \brief Schema extension which represents `clustering_filter_bucket_width` per-table option.
+ *
+ * When set, sstables written for the table carry a filter of the
+ * (partition key, bucket of the first clustering column) pairs they have
+ * rows for, which lets single-partition reads restricted to a clustering
+ * range skip sstables without opening their index.
+ *
+ * The width is in the units of the first clustering column: milliseconds for
+ * timestamp and timeuuid, days for date, nanoseconds for time, and the value
+ * itself for integer types. Columns of other types are not supported; no
+ * filter is written for them.
+ */
+class clustering_filter_extension : public schema_extension {
+    int64_t _bucket_width;
+
+    static int64_t validate(int64_t width) {
+        if (width <= 0) {
+            throw exceptions::configuration_exception(format("clustering_filter_bucket_width must be positive, got {}", width));
+        }
+        return width;
+    }
+public:
+    static constexpr auto NAME = "clustering_filter_bucket_width";
+
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wdeprecated-declarations"
+    clustering_filter_extension() = default;
+
+    explicit clustering_filter_extension(int64_t bucket_width)
+        : _bucket_width(validate(bucket_width))
+    {}
+
+    explicit clustering_filter_extension(const std::map<sstring, sstring>& map) {
+        on_internal_error(dblog, "Cannot create clustering_filter_extension from map");
+    }
+
+    explicit clustering_filter_extension(bytes b) : _bucket_width(deserialize(b))
+    {}
+
+    explicit clustering_filter_extension(const sstring& s) {
+        try {
+            _bucket_width = validate(std::stoll(s));
+        } catch (std::logic_error&) {
+            throw exceptions::configuration_exception(format("Invalid clustering_filter_bucket_width '{}'", s));
+        }
+    }
+#pragma clang diagnostic pop
+
+    bytes serialize() const override {
+        return ser::serialize_to_buffer<bytes>(_bucket_width);
+    }
+
+    std::string options_to_string() const override {
+        return std::to_string(_bucket_width);
+    }
+
+    static int64_t deserialize(const bytes_view& buffer) {
+        return ser::deserialize_from_buffer(buffer, std::type_identity<int64_t>());
+    }
+
+    int64_t get_bucket_width() const {
+        return _bucket_width;
+    }
+};
+
+} // namespace db
@@ -0,0 +1,81 @@
+/*
+ * Copyright (C) 2026-present ScyllaDB
+ */
+
+/*
+ * SPDX-License-Identifier: LicenseRef-ScyllaDB-Source-Available-1.0
+ */
+
+#pragma once
+
+#include <seastar/core/on_internal_error.hh>
+
+#include "exceptions/exceptions.hh"
+#include "serializer.hh"
+#include "schema/schema.hh"
+#include "utils/log.hh"
+
+extern logging::logger dblog;
+
+namespace db {
+
+/**
+ * \brief Schema extension which represents `column_zone_maps` per-table option.
+ *
+ * When enabled, sstables written for the table carry the minimum and maximum
+ * value of each of its atomic regular columns (see sstables::column_zone_maps),
+ * which lets filtering reads of a partition skip sstables none of whose
+ * values can match the query restrictions.
+ */
+class column_zone_maps_extension : public schema_extension {
+    bool _enabled = false;
+
+    static bool parse(const sstring& s) {
+        if (s == "true") {
+            return true;
+        }
+        if (s == "false") {
+            return false;
+        }
+        throw exceptions::configuration_exception(format("Invalid column_zone_maps '{}', expected 'true' or 'false'", s));
+    }
+public:
+    static constexpr auto NAME = "column_zone_maps";
+
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wdeprecated-declarations"
+    column_zone_maps_extension() = default;
+
+    explicit column_zone_maps_extension(bool enabled)
+        : _enabled(enabled)
+    {}
+
+    explicit column_zone_maps_extension(const std::map<sstring, sstring>& map) {
+        on_internal_error(dblog, "Cannot create column_zone_maps_extension from map");
+    }
+
+    explicit column_zone_maps_extension(bytes b) : _enabled(deserialize(b))
+    {}
+
+    explicit column_zone_maps_extension(const sstring& s) : _enabled(parse(s))
+    {}
+#pragma clang diagnostic pop
+
+    bytes serialize() const override {
+        return ser::serialize_to_buffer<bytes>(_enabled);
+    }
+
+    std::string options_to_string() const override {
+        return _enabled ? "true" : "false";
+    }
+
+    static bool deserialize(const bytes_view& buffer) {
+        return ser::deserialize_from_buffer(buffer, std::type_identity<bool>());
+    }
+
+    bool is_enabled() const {
+        return _enabled;
+    }
+};
+
+} // namespace db
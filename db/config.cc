@@ -29,6 +29,9 @@
 #include "tombstone_gc_extension.hh"
 #include "db/per_partition_rate_limit_extension.hh"
 #include "db/paxos_grace_seconds_extension.hh"
+#include "db/bloom_filter_layout_extension.hh"
+#include "db/clustering_filter_extension.hh"
+#include "db/column_zone_maps_extension.hh"
 #include "db/tags/extension.hh"
 #include "config.hh"
 #include "extensions.hh"
@@ -630,8 +633,8 @@ db::config::config(std::shared_ptr<db::extensions> exts)
         "The directory where hints files are stored if hinted handoff is enabled.")
     , view_hints_directory(this, "view_hints_directory", value_status::Used, "",
         "The directory where materialized-view updates are stored while a view replica is unreachable.")
-    , saved_caches_directory(this, "saved_caches_directory", value_status::Unused, "",
-        "The directory location where table key and row caches are stored.")
+    , saved_caches_directory(this, "saved_caches_directory", value_status::Used, "",
+        "The directory location where table key and row caches are stored. Keys of partitions cached in the row cache are saved there on drain when ``row_cache_keys_to_save`` is non-zero.")
     /**
     * @Group Commonly used properties
     * @GroupDescription Properties most frequently used when configuring Scylla.
@@ -699,6 +702,14 @@ db::config::config(std::shared_ptr<db::extensions> exts)
         "Throttles compaction to the specified total throughput across the entire system. The faster you insert data, the faster you need to compact in order to keep the SSTable count down. The recommended Value is 16 to 32 times the rate of write throughput (in MBs/second). Setting the value to 0 disables compaction throttling.\n"
         "\n"
         "Related information: Configuring compaction")
+    , compaction_sub_range_parallelism(this, "compaction_sub_range_parallelism", liveness::LiveUpdate, value_status::Used, 1,
+        "Splits each major and cleanup compaction into this many token sub-ranges, which are compacted concurrently into a single SSTable run. Higher values let a shard overlap the I/O and CPU of a large compaction. Setting the value to 1 compacts the whole range serially.")
+    , background_io_read_latency_target_us(this, "background_io_read_latency_target_us", liveness::LiveUpdate, value_status::Used, 0,
+        "Target average latency, in microseconds, of disk reads issued by user queries. When set, the I/O bandwidth of compaction and streaming is adjusted every second: it is reduced while reads are slower than the target, and increased while they are well below it, between background_io_min_throughput_mb_per_sec and background_io_max_throughput_mb_per_sec. compaction_throughput_mb_per_sec and stream_io_throughput_mb_per_sec still cap the bandwidth. Setting the value to 0 disables the controller.")
+    , background_io_min_throughput_mb_per_sec(this, "background_io_min_throughput_mb_per_sec", liveness::LiveUpdate, value_status::Used, 16,
+        "The lowest I/O bandwidth, in MB/s, the read latency controller (see background_io_read_latency_target_us) lowers compaction and streaming to.")
+    , background_io_max_throughput_mb_per_sec(this, "background_io_max_throughput_mb_per_sec", liveness::LiveUpdate, value_status::Used, 1024,
+        "The highest I/O bandwidth, in MB/s, the read latency controller (see background_io_read_latency_target_us) raises compaction and streaming to.")
     , compaction_large_partition_warning_threshold_mb(this, "compaction_large_partition_warning_threshold_mb", liveness::LiveUpdate, value_status::Used, 1000,
         "Log a warning when writing partitions larger than this value.")
     , compaction_large_row_warning_threshold_mb(this, "compaction_large_row_warning_threshold_mb", liveness::LiveUpdate, value_status::Used, 10,
@@ -908,8 +919,10 @@ db::config::config(std::shared_ptr<db::extensions> exts)
     , key_cache_size_in_mb(this, "key_cache_size_in_mb", value_status::Unused, 100,
         "A global cache setting for tables. It is the maximum size of the key cache in memory. To disable set to 0.\n"
         "Related information: nodetool setcachecapacity.")
-    , row_cache_keys_to_save(this, "row_cache_keys_to_save", value_status::Unused, 0,
-        "Number of keys from the row cache to save.")
+    , row_cache_keys_to_save(this, "row_cache_keys_to_save", value_status::Used, 0,
+        "Number of keys from the row cache to save per table and shard when the node is drained. On the next start, the saved partitions are read back into the row cache in the background. Set to 0 to disable saving and warming up the row cache.")
+    , row_cache_warmup_bandwidth_mb_per_sec(this, "row_cache_warmup_bandwidth_mb_per_sec", liveness::LiveUpdate, value_status::Used, 64,
+        "Throttles the row cache warm-up on startup to the specified amount of data read per second, per shard. Set to 0 to disable throttling.")
     , row_cache_size_in_mb(this, "row_cache_size_in_mb", value_status::Unused, 0,
         "Maximum size of the row cache in memory. Row cache can save more time than key_cache_size_in_mb, but is space-intensive because it contains the entire row. Use the row cache only for hot rows or static rows. If you reduce the size, you may not get you hottest keys loaded on start up.")
     , row_cache_save_period(this, "row_cache_save_period", value_status::Unused, 0,
@@ -956,6 +969,12 @@ db::config::config(std::shared_ptr<db::extensions> exts)
         "The time in milliseconds that the coordinator waits for sequential or index scans to complete.")
     , read_request_timeout_in_ms(this, "read_request_timeout_in_ms", liveness::LiveUpdate, value_status::Used, 5000,
         "The time that the coordinator waits for read operations to complete")
+    , adaptive_speculative_retry(this, "adaptive_speculative_retry", liveness::LiveUpdate, value_status::Used, false,
+        "For tables with a percentile speculative_retry, send the speculative read once the replicas read from take longer than the percentile of their own recent latencies, rather than of the latencies of the table. "
+        "The number of such reads is limited by speculative_retry_budget.")
+    , speculative_retry_budget(this, "speculative_retry_budget", liveness::LiveUpdate, value_status::Used, 0.1,
+        "The maximum number of speculative reads sent by adaptive_speculative_retry, as a fraction of the reads which may speculate. "
+        "Each coordinator keeps to it, which bounds the extra load on the replicas of the cluster.")
     , counter_write_request_timeout_in_ms(this, "counter_write_request_timeout_in_ms", liveness::LiveUpdate, value_status::Used, 5000,
         "The time that the coordinator waits for counter writes to complete.")
     , cas_contention_timeout_in_ms(this, "cas_contention_timeout_in_ms", liveness::LiveUpdate, value_status::Used, 1000,
@@ -1251,6 +1270,7 @@ db::config::config(std::shared_ptr<db::extensions> exts)
     , force_gossip_generation(this, "force_gossip_generation", liveness::LiveUpdate, value_status::Used, -1 , "Force gossip to use the generation number provided by user.")
     , experimental_features(this, "experimental_features", value_status::Used, {}, experimental_features_help_string())
     , lsa_reclamation_step(this, "lsa_reclamation_step", value_status::Used, 1, "Minimum number of segments to reclaim in a single step.")
+    , lsa_huge_page_segments(this, "lsa_huge_page_segments", value_status::Used, false, "Allocate LSA memory (used by the row cache and memtables) in 2 MiB chunks, aligned so that they can be mapped with huge pages. Reduces TLB misses on large caches, at the cost of releasing memory to the rest of the system in coarser units.")
     , prometheus_port(this, "prometheus_port", value_status::Used, 9180, "Prometheus port, set to zero to disable.")
     , prometheus_address(this, "prometheus_address", value_status::Used, {/* listen_address */}, "Prometheus listening address, defaulting to listen_address if not explicitly set.")
     , prometheus_prefix(this, "prometheus_prefix", value_status::Used, "scylla", "Set the prefix of the exported Prometheus metrics. Changing this will break Scylla's dashboard compatibility, do not change unless you know what you are doing.")
@@ -1261,6 +1281,7 @@ db::config::config(std::shared_ptr<db::extensions> exts)
     , sstable_summary_ratio(this, "sstable_summary_ratio", value_status::Used, 0.0005, "Enforces that 1 byte of summary is written for every N (2000 by default)"
         "bytes written to data file. Value must be between 0 and 1.")
     , components_memory_reclaim_threshold(this, "components_memory_reclaim_threshold", liveness::LiveUpdate, value_status::Used, .2, "Ratio of available memory for all in-memory components of SSTables in a shard beyond which the memory will be reclaimed from components until it falls back under the threshold. Currently, this limit is only enforced for bloom filters.")
+    , defer_sstable_bloom_filter_load(this, "defer_sstable_bloom_filter_load", liveness::LiveUpdate, value_status::Used, false, "Do not read the bloom filters of SSTables when populating tables at startup. Filters are loaded in the background, those of SSTables being read from first, as long as they fit under components_memory_reclaim_threshold. Until its filter is loaded, an SSTable is consulted on every single-partition read it may cover.")
     , large_memory_allocation_warning_threshold(this, "large_memory_allocation_warning_threshold", value_status::Used, (size_t(128) << 10) + 1, "Warn about memory allocations above this size; set to zero to disable.")
     , enable_deprecated_partitioners(this, "enable_deprecated_partitioners", value_status::Used, false, "Enable the byteordered and random partitioners. These partitioners are deprecated and will be removed in a future version.")
     , enable_keyspace_column_family_metrics(this, "enable_keyspace_column_family_metrics", value_status::Used, false, "Enable per keyspace and per column family metrics reporting.")
@@ -1415,8 +1436,18 @@ db::config::config(std::shared_ptr<db::extensions> exts)
     , nodeops_heartbeat_interval_seconds(this, "nodeops_heartbeat_interval_seconds", liveness::LiveUpdate, value_status::Used, 10, "Period of heartbeat ticks in node operations.")
     , cache_index_pages(this, "cache_index_pages", liveness::LiveUpdate, value_status::Used, true,
         "Keep SSTable index pages in the global cache after a SSTable read. Expected to improve performance for workloads with big partitions, but may degrade performance for workloads with small partitions. The amount of memory usable by index cache is limited with ``index_cache_fraction``.")
+    , cache_data_chunks(this, "cache_data_chunks", liveness::LiveUpdate, value_status::Used, false,
+        "Keep decompressed chunks of compressed SSTable data files in the global cache after a single-partition SSTable read, so that later reads of the same chunk don't have to read and decompress it again. Shares its capacity with the row cache. Expected to improve performance for read workloads which bypass the row cache or don't fit in it.")
     , index_cache_fraction(this, "index_cache_fraction", liveness::LiveUpdate, value_status::Used, 0.2,
         "The maximum fraction of cache memory permitted for use by index cache. Clamped to the [0.0; 1.0] range. Must be small enough to not deprive the row cache of memory, but should be big enough to fit a large fraction of the index. The default value 0.2 means that at least 80\% of cache memory is reserved for the row cache, while at most 20\% is usable by the index cache.")
+    , cache_scan_admission_threshold(this, "cache_scan_admission_threshold", liveness::LiveUpdate, value_status::Used, 0,
+        "Makes the row cache resistant to large range scans. Partitions read by range scans are kept at the cold end of the cache LRU, so that they are evicted first, unless they were recently read by single-partition reads at least this many times (estimated with a frequency sketch). Valid values are 0 (disabled) to 15.")
+    , in_memory_row_cache_fraction(this, "in_memory_row_cache_fraction", value_status::Used, 0.3,
+        "The fraction of memory which tables with ``memory_reservation_mb`` or ``in_memory`` in their caching options may reserve in the row cache, all together. Reservations above that are capped, and an in-memory table without ``memory_limit_mb`` reserves what is left of it. Above their reservation, partitions of these tables are evicted on memory pressure like those of other tables.")
+    , cache_compressed_tier_fraction(this, "cache_compressed_tier_fraction", liveness::LiveUpdate, value_status::Used, 0,
+        "The fraction of memory used for keeping partitions which are evicted from the row cache in compressed form, so that re-reading them doesn't have to go to disk. 0 disables the compressed tier.")
+    , hot_partitions_sample_rate(this, "hot_partitions_sample_rate", liveness::LiveUpdate, value_status::Used, 32,
+        "Track the most read and written partitions of each shard by sampling one in this many reads and writes. The results are available in the ``system.hot_partitions`` virtual table and through the REST API. 0 disables tracking.")
     , consistent_cluster_management(this, "consistent_cluster_management", value_status::Deprecated, true, "Use RAFT for cluster management and DDL.")
     , force_gossip_topology_changes(this, "force_gossip_topology_changes", value_status::Used, false, "Force gossip-based topology operations in a fresh cluster. Only the first node in the cluster must use it. The rest will fall back to gossip-based operations anyway. This option should be used only for testing.  Note: gossip topology changes are incompatible with tablets.")
     , recovery_leader(this, "recovery_leader", liveness::LiveUpdate, value_status::Used, utils::null_uuid(), "Host ID of the node restarted first while performing the Manual Raft-based Recovery Procedure. Warning: this option disables some guardrails for the needs of the Manual Raft-based Recovery Procedure. Make sure you unset it at the end of the procedure.")
@@ -1528,12 +1559,27 @@ void db::config::add_paxos_grace_seconds_extension() {
     _extensions->add_schema_extension<db::paxos_grace_seconds_extension>(db::paxos_grace_seconds_extension::NAME);
 }
 
+void db::config::add_bloom_filter_layout_extension() {
+    _extensions->add_schema_extension<db::bloom_filter_layout_extension>(db::bloom_filter_layout_extension::NAME);
+}
+
+void db::config::add_clustering_filter_extension() {
+    _extensions->add_schema_extension<db::clustering_filter_extension>(db::clustering_filter_extension::NAME);
+}
+
+void db::config::add_column_zone_maps_extension() {
+    _extensions->add_schema_extension<db::column_zone_maps_extension>(db::column_zone_maps_extension::NAME);
+}
+
 void db::config::add_all_default_extensions() {
     add_cdc_extension();
     add_per_partition_rate_limit_extension();
     add_tags_extension();
     add_tombstone_gc_extension();
     add_paxos_grace_seconds_extension();
+    add_bloom_filter_layout_extension();
+    add_clustering_filter_extension();
+    add_column_zone_maps_extension();
 }
 
 void db::config::setup_directories() {
@@ -174,6 +174,9 @@ class config final : public utils::config_file {
     void add_tags_extension();
     void add_tombstone_gc_extension();
     void add_paxos_grace_seconds_extension();
+    void add_bloom_filter_layout_extension();
+    void add_clustering_filter_extension();
+    void add_column_zone_maps_extension();
 
     void add_all_default_extensions();
 
@@ -231,6 +234,10 @@ class config final : public utils::config_file {
     named_value<bool> rpc_interface_prefer_ipv6;
     named_value<seed_provider_type> seed_provider;
     named_value<uint32_t> compaction_throughput_mb_per_sec;
+    named_value<uint32_t> compaction_sub_range_parallelism;
+    named_value<uint32_t> background_io_read_latency_target_us;
+    named_value<uint32_t> background_io_min_throughput_mb_per_sec;
+    named_value<uint32_t> background_io_max_throughput_mb_per_sec;
     named_value<uint32_t> compaction_large_partition_warning_threshold_mb;
     named_value<uint32_t> compaction_large_row_warning_threshold_mb;
     named_value<uint32_t> compaction_large_cell_warning_threshold_mb;
@@ -297,6 +304,7 @@ class config final : public utils::config_file {
     named_value<uint32_t> key_cache_save_period;
     named_value<uint32_t> key_cache_size_in_mb;
     named_value<uint32_t> row_cache_keys_to_save;
+    named_value<uint32_t> row_cache_warmup_bandwidth_mb_per_sec;
     named_value<uint32_t> row_cache_size_in_mb;
     named_value<uint32_t> row_cache_save_period;
     named_value<sstring> memory_allocator;
@@ -310,6 +318,8 @@ class config final : public utils::config_file {
     named_value<uint32_t> group0_tombstone_gc_refresh_interval_in_ms;
     named_value<uint32_t> range_request_timeout_in_ms;
     named_value<uint32_t> read_request_timeout_in_ms;
+    named_value<bool> adaptive_speculative_retry;
+    named_value<double> speculative_retry_budget;
     named_value<uint32_t> counter_write_request_timeout_in_ms;
     named_value<uint32_t> cas_contention_timeout_in_ms;
     named_value<uint32_t> truncate_request_timeout_in_ms;
@@ -411,6 +421,7 @@ class config final : public utils::config_file {
     named_value<int32_t> force_gossip_generation;
     named_value<std::vector<enum_option<experimental_features_t>>> experimental_features;
     named_value<size_t> lsa_reclamation_step;
+    named_value<bool> lsa_huge_page_segments;
     named_value<uint16_t> prometheus_port;
     named_value<sstring> prometheus_address;
     named_value<sstring> prometheus_prefix;
@@ -420,6 +431,7 @@ class config final : public utils::config_file {
     named_value<double> unspooled_dirty_soft_limit;
     named_value<double> sstable_summary_ratio;
     named_value<double> components_memory_reclaim_threshold;
+    named_value<bool> defer_sstable_bloom_filter_load;
     named_value<size_t> large_memory_allocation_warning_threshold;
     named_value<bool> enable_deprecated_partitioners;
     named_value<bool> enable_keyspace_column_family_metrics;
@@ -508,7 +520,12 @@ class config final : public utils::config_file {
     named_value<uint32_t> nodeops_heartbeat_interval_seconds;
 
     named_value<bool> cache_index_pages;
+    named_value<bool> cache_data_chunks;
     named_value<double> index_cache_fraction;
+    named_value<uint32_t> cache_scan_admission_threshold;
+    named_value<double> in_memory_row_cache_fraction;
+    named_value<double> cache_compressed_tier_fraction;
+    named_value<uint32_t> hot_partitions_sample_rate;
 
     named_value<bool> consistent_cluster_management;
     named_value<bool> force_gossip_topology_changes;
@@ -0,0 +1,145 @@
+/*
+ * Copyright (C) 2026-present ScyllaDB
+ */
+
+/*
+ * SPDX-License-Identifier: LicenseRef-ScyllaDB-Source-Available-1.0
+ */
+
+#include <seastar/core/coroutine.hh>
+
+#include "db/hot_partitions.hh"
+#include "mutation/frozen_mutation.hh"
+#include "readers/filtering.hh"
+#include "replica/database.hh"
+
+namespace db {
+
+std::string_view to_string(hot_partitions_tracker::kind k) {
+    switch (k) {
+    case hot_partitions_tracker::kind::reads: return "reads";
+    case hot_partitions_tracker::kind::writes: return "writes";
+    case hot_partitions_tracker::kind::write_kib: return "write_kib";
+    }
+    std::abort();
+}
+
+const hot_partitions_tracker::top_k& hot_partitions_tracker::window::get(kind k) const {
+    switch (k) {
+    case kind::reads: return reads;
+    case kind::writes: return writes;
+    case kind::write_kib: return write_kib;
+    }
+    std::abort();
+}
+
+hot_partitions_tracker::hot_partitions_tracker(data_listeners& listeners, utils::updateable_value<uint32_t> sample_rate)
+    : _listeners(listeners)
+    , _sample_rate(std::move(sample_rate))
+    , _rotate_timer([this] { rotate(); })
+{
+    _listeners.install(this);
+    _rotate_timer.arm_periodic(window_duration);
+}
+
+hot_partitions_tracker::~hot_partitions_tracker() {
+    _listeners.uninstall(this);
+}
+
+unsigned hot_partitions_tracker::sample(uint32_t& until_sample) noexcept {
+    auto rate = _sample_rate();
+    if (!rate) {
+        return 0;
+    }
+    if (until_sample) {
+        // The rate may have been lowered since the countdown started.
+        until_sample = std::min(until_sample, rate) - 1;
+        return 0;
+    }
+    until_sample = rate - 1;
+    return rate;
+}
+
+void hot_partitions_tracker::rotate() {
+    _previous = std::exchange(_current, window{});
+}
+
+mutation_reader hot_partitions_tracker::on_read(const schema_ptr& s, const dht::partition_range& range,
+        const query::partition_slice& slice, mutation_reader&& rd) {
+    auto weight = sample(_reads_until_sample);
+    if (!weight) {
+        return std::move(rd);
+    }
+    return make_filtering_reader(std::move(rd), [zis = weak_from_this(), s, weight] (const dht::decorated_key& dk) {
+        // The read may outlive the tracker.
+        if (zis) {
+            zis->_current.reads.append(toppartitions_item_key{s, dk}, weight);
+        }
+        return true;
+    });
+}
+
+void hot_partitions_tracker::on_write(const schema_ptr& s, const frozen_mutation& m) {
+    auto weight = sample(_writes_until_sample);
+    if (!weight) {
+        return;
+    }
+    auto key = toppartitions_item_key{s, m.decorated_key(*s)};
+    auto kib = unsigned(std::max<size_t>(m.representation().size() / 1024, 1));
+    _current.writes.append(key, weight);
+    _current.write_kib.append(std::move(key), kib * weight);
+}
+
+hot_partitions_tracker::top_k::results hot_partitions_tracker::top(kind k, unsigned n) const {
+    top_k merged(capacity);
+    merged.append(_previous.get(k).top(capacity));
+    merged.append(_current.get(k).top(capacity));
+    return merged.top(n);
+}
+
+future<hot_partitions> get_hot_partitions(sharded<replica::database>& db, unsigned k) {
+    using global_results = toppartitions_data_listener::global_top_k::results;
+    using shard_results = std::array<global_results, hot_partitions_tracker::all_kinds.size()>;
+
+    using merged_results = std::array<hot_partitions_tracker::top_k, hot_partitions_tracker::all_kinds.size()>;
+
+    auto map = [] (replica::database& db) {
+        auto res = std::make_unique<shard_results>();
+        for (size_t i = 0; i < res->size(); ++i) {
+            (*res)[i] = toppartitions_data_listener::globalize(db.hot_partitions().top(hot_partitions_tracker::all_kinds[i], hot_partitions_tracker::capacity));
+        }
+        return make_foreign(std::move(res));
+    };
+    auto reduce = [] (merged_results merged, foreign_ptr<std::unique_ptr<shard_results>> res) {
+        for (size_t i = 0; i < res->size(); ++i) {
+            merged[i].append(toppartitions_data_listener::localize((*res)[i]));
+        }
+        return merged;
+    };
+    auto merged = co_await db.map_reduce0(map, merged_results{
+        hot_partitions_tracker::top_k(hot_partitions_tracker::capacity),
+        hot_partitions_tracker::top_k(hot_partitions_tracker::capacity),
+        hot_partitions_tracker::top_k(hot_partitions_tracker::capacity),
+    }, reduce);
+
+    auto to_vector = [k] (const hot_partitions_tracker::top_k& top) {
+        std::vector<hot_partition> ret;
+        for (auto&& e : top.top(k)) {
+            ret.push_back(hot_partition{
+                .keyspace = e.item.schema->ks_name(),
+                .table = e.item.schema->cf_name(),
+                .partition_key = sstring(e.item),
+                .count = e.count,
+                .error = e.error,
+            });
+        }
+        return ret;
+    };
+    co_return hot_partitions{
+        .reads = to_vector(merged[0]),
+        .writes = to_vector(merged[1]),
+        .write_kib = to_vector(merged[2]),
+    };
+}
+
+} // namespace db
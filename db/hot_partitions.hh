@@ -0,0 +1,103 @@
+/*
+ * Copyright (C) 2026-present ScyllaDB
+ */
+
+/*
+ * SPDX-License-Identifier: LicenseRef-ScyllaDB-Source-Available-1.0
+ */
+
+#pragma once
+
+#include <array>
+
+#include <seastar/core/lowres_clock.hh>
+#include <seastar/core/sharded.hh>
+#include <seastar/core/timer.hh>
+#include <seastar/core/weak_ptr.hh>
+
+#include "db/data_listeners.hh"
+#include "utils/updateable_value.hh"
+
+namespace replica {
+class database;
+}
+
+namespace db {
+
+// Always-on tracking of the partitions which receive the most reads and writes.
+//
+// Unlike toppartitions_query, which installs a listener for the duration of
+// a single nodetool invocation, this listener is installed for the lifetime of
+// the database. To keep its cost low, only one in hot_partitions_sample_rate
+// reads and writes is recorded, with the weight of the sample rate.
+//
+// Counts are kept over two consecutive windows of hot_partitions_tracker::window_duration:
+// the current one and the one before it, so results cover between one and two
+// windows' worth of traffic.
+class hot_partitions_tracker : public data_listener, public weakly_referencable<hot_partitions_tracker> {
+public:
+    using top_k = toppartitions_data_listener::top_k;
+
+    enum class kind {
+        reads,
+        writes,
+        // Size of written mutations, in KiB.
+        write_kib,
+    };
+    static constexpr std::array<kind, 3> all_kinds = { kind::reads, kind::writes, kind::write_kib };
+
+    static constexpr size_t capacity = 256;
+    static constexpr auto window_duration = std::chrono::seconds(60);
+private:
+    struct window {
+        top_k reads{capacity};
+        top_k writes{capacity};
+        top_k write_kib{capacity};
+
+        const top_k& get(kind) const;
+    };
+
+    data_listeners& _listeners;
+    utils::updateable_value<uint32_t> _sample_rate;
+    uint32_t _reads_until_sample = 0;
+    uint32_t _writes_until_sample = 0;
+    window _current;
+    window _previous;
+    timer<lowres_clock> _rotate_timer;
+
+    // Returns the weight of the sample, or 0 if the operation is not sampled.
+    unsigned sample(uint32_t& until_sample) noexcept;
+    void rotate();
+public:
+    hot_partitions_tracker(data_listeners&, utils::updateable_value<uint32_t> sample_rate);
+    ~hot_partitions_tracker();
+
+    virtual mutation_reader on_read(const schema_ptr& s, const dht::partition_range& range,
+            const query::partition_slice& slice, mutation_reader&& rd) override;
+
+    virtual void on_write(const schema_ptr& s, const frozen_mutation& m) override;
+
+    // The k hottest partitions on this shard.
+    top_k::results top(kind, unsigned k) const;
+};
+
+struct hot_partition {
+    sstring keyspace;
+    sstring table;
+    sstring partition_key;
+    uint64_t count;
+    uint64_t error;
+};
+
+struct hot_partitions {
+    std::vector<hot_partition> reads;
+    std::vector<hot_partition> writes;
+    std::vector<hot_partition> write_kib;
+};
+
+// The k hottest partitions on this node, merged across all shards.
+future<hot_partitions> get_hot_partitions(sharded<replica::database>&, unsigned k);
+
+std::string_view to_string(hot_partitions_tracker::kind);
+
+} // namespace db
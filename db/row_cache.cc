@@ -14,6 +14,7 @@
 #include <seastar/core/thread.hh>
 #include <seastar/core/coroutine.hh>
 #include <seastar/coroutine/as_future.hh>
+#include <seastar/coroutine/maybe_yield.hh>
 #include <seastar/util/defer.hh>
 #include "replica/memtable.hh"
 #include <boost/version.hpp>
@@ -67,11 +68,18 @@ cache_tracker::cache_tracker(utils::updateable_value<double> index_cache_fractio
 
 static thread_local cache_tracker* current_tracker;
 
+// 2^18 4-bit counters, 128 KiB per shard. Good for a few hundred thousand
+// distinct hot partitions before collisions start to inflate estimates.
+static constexpr size_t frequency_sketch_counters = 256 * 1024;
+
 cache_tracker::cache_tracker(utils::updateable_value<double> index_cache_fraction, mutation_application_stats& app_stats, register_metrics with_metrics)
     : _garbage(_region, this, app_stats)
     , _memtable_cleaner(_region, nullptr, app_stats)
     , _app_stats(app_stats)
     , _index_cache_fraction(std::move(index_cache_fraction))
+    , _frequency_sketch(frequency_sketch_counters)
+    , _memory_limit_timer([this] { enforce_memory_limit(); })
+    , _compression_timer([this] { compress_cold_partitions(); })
 {
     if (with_metrics) {
         setup_metrics();
@@ -87,6 +95,9 @@ cache_tracker::cache_tracker(utils::updateable_value<double> index_cache_fractio
                 _memtable_cleaner.clear_some();
                 return memory::reclaiming_result::reclaimed_something;
             }
+            if (_memory_reservation && _region.occupancy().used_space() <= _memory_reservation) {
+                return memory::reclaiming_result::reclaimed_nothing;
+            }
             current_tracker = this;
 
             // Cache replacement algorithm:
@@ -116,6 +127,7 @@ cache_tracker::cache_tracker(utils::updateable_value<double> index_cache_fractio
             size_t index_cache_space = _partition_index_cache_stats.used_bytes + _index_cached_file_stats.cached_bytes;
             bool should_evict_index = index_cache_space > total_cache_space * _index_cache_fraction.get();
 
+            ++_stats.reclaimer_evictions;
             return _lru.evict(should_evict_index);
         });
     });
@@ -137,9 +149,123 @@ void cache_tracker::set_compaction_scheduling_group(seastar::scheduling_group sg
     _garbage.set_scheduling_group(sg);
 }
 
+void cache_tracker::set_memory_bounds(size_t reservation, size_t limit) {
+    _memory_reservation = reservation;
+    _memory_limit = limit;
+    if (_memory_limit && _region.occupancy().used_space() > _memory_limit && !_memory_limit_timer.armed()) {
+        _memory_limit_timer.arm(lowres_clock::duration::zero());
+    }
+}
+
+void cache_tracker::enforce_memory_limit() noexcept {
+    // Evict in batches so that we don't stall the reactor, and continue from the timer.
+    static constexpr unsigned batch = 256;
+    with_allocator(_region.allocator(), [this] () noexcept {
+        current_tracker = this;
+        for (unsigned i = 0; i < batch; ++i) {
+            if (!_memory_limit || _region.occupancy().used_space() <= _memory_limit) {
+                return;
+            }
+            if (_lru.evict() == memory::reclaiming_result::reclaimed_nothing) {
+                return;
+            }
+        }
+        _memory_limit_timer.arm(lowres_clock::duration::zero());
+    });
+}
+
+// The sweep runs every compression_sweep_period and compresses at most
+// compression_sweep_bytes of serialized partitions per run, so that it
+// doesn't stall the reactor.
+static constexpr auto compression_sweep_period = std::chrono::milliseconds(10);
+static constexpr size_t compression_sweep_bytes = 256 * 1024;
+// Bigger partitions are not worth the stall of (de)compressing them in one go.
+static constexpr size_t compressible_partition_max_rows = 1024;
+static constexpr size_t compressible_partition_max_bytes = 1024 * 1024;
+
+void cache_tracker::set_compressed_tier_fraction(utils::updateable_value<double> fraction) {
+    _compressed_tier_fraction = std::move(fraction);
+    _compressed_tier_fraction_observer.emplace(_compressed_tier_fraction.observe([this] (const double&) {
+        update_compression_timer();
+    }));
+    update_compression_timer();
+}
+
+void cache_tracker::update_compression_timer() noexcept {
+    // Don't wake up every sweep period for nothing when the tier is disabled.
+    if (_compressed_tier_fraction.get() > 0) {
+        if (!_compression_timer.armed()) {
+            _compression_timer.arm_periodic(compression_sweep_period);
+        }
+    } else {
+        _compression_timer.cancel();
+        _compressed_tier.evict_to(0);
+    }
+}
+
+size_t cache_tracker::compressed_tier_budget() const noexcept {
+    return _compressed_tier_fraction.get() * memory::stats().total_memory();
+}
+
+void cache_tracker::compress_cold_partitions() noexcept {
+    auto budget = compressed_tier_budget();
+    _compressed_tier.evict_to(budget);
+    // Only compress when the reclaimer evicts, i.e. when cache is under memory pressure.
+    if (!budget || _stats.reclaimer_evictions == _reclaimer_evictions_at_last_sweep) {
+        return;
+    }
+    _reclaimer_evictions_at_last_sweep = _stats.reclaimer_evictions;
+    _compressed_tier.for_each_cache(compression_sweep_bytes, [] (row_cache& cache, size_t max_bytes) {
+        return cache.compress_cold_partitions(max_bytes);
+    });
+    _compressed_tier.evict_to(budget);
+}
+
+void cache_tracker::set_scan_admission_threshold(utils::updateable_value<uint32_t> threshold) {
+    _scan_admission_threshold = std::move(threshold);
+}
+
+void cache_tracker::on_partition_scanned(cache_entry& ce, uint64_t key_hash) noexcept {
+    auto threshold = _scan_admission_threshold.get();
+    if (!threshold) {
+        return;
+    }
+    if (_frequency_sketch.estimate(key_hash) >= std::min<uint32_t>(threshold, utils::frequency_sketch::max_frequency)) {
+        ++_stats.scan_admissions;
+        return;
+    }
+    ++_stats.scan_admission_rejects;
+    demote(ce);
+}
+
+void cache_tracker::demote(cache_entry& ce) noexcept {
+    partition_version& v = *ce.partition().version();
+    // Older versions must be evicted before newer ones, so we can only reorder
+    // the LRU when the latest version is the only one.
+    if (v.next()) {
+        return;
+    }
+    auto& rows = v.partition().mutable_clustered_rows();
+    // This runs without preemption, so bound the work for wide partitions by
+    // demoting only their first rows. The others age in the LRU as usual.
+    auto end = rows.begin();
+    for (size_t n = 0; n < max_demoted_rows && end != rows.end(); ++n) {
+        ++end;
+    }
+    // Iterate backwards so that the relative order of rows is preserved at the front.
+    while (end != rows.begin()) {
+        --end;
+        if (end->is_linked()) {
+            _lru.remove(*end);
+            _lru.add_front(*end);
+        }
+    }
+}
+
 namespace sstables {
 void register_index_page_cache_metrics(seastar::metrics::metric_groups&, cached_file_stats&);
 void register_index_page_metrics(seastar::metrics::metric_groups&, partition_index_cache_stats&);
+void register_data_chunk_cache_metrics(seastar::metrics::metric_groups&, chunk_cache_stats&);
 };
 
 void
@@ -188,9 +314,43 @@ cache_tracker::setup_metrics() {
             sm::description("total amount of attempts to compact expired rows during read")),
         sm::make_counter("rows_compacted_away", _stats.rows_compacted_away,
             sm::description("total amount of compacted and removed rows during read")),
+        sm::make_counter("scan_admissions", _stats.scan_admissions,
+            sm::description("total number of partitions read by range scans which were frequent enough to keep their position in the cache LRU")),
+        sm::make_counter("scan_admission_rejects", _stats.scan_admission_rejects,
+            sm::description("total number of partitions read by range scans which were moved to the cold end of the cache LRU because they are not read frequently")),
+        sm::make_counter("reclaimer_evictions", _stats.reclaimer_evictions,
+            sm::description("total number of evictions done to satisfy memory pressure")),
+        sm::make_gauge("compressed_partitions", sm::description("number of partitions in the compressed tier"), [this] { return _compressed_tier.get_stats().partitions; }),
+        sm::make_gauge("compressed_bytes", sm::description("memory used by the compressed tier"), [this] { return _compressed_tier.get_stats().memory; }),
+        sm::make_gauge("compressed_bytes_uncompressed", sm::description("size of partitions in the compressed tier before compression"), [this] { return _compressed_tier.get_stats().uncompressed_memory; }),
+        sm::make_counter("compressed_partition_insertions", sm::description("total number of partitions moved from cache to the compressed tier"), [this] { return _compressed_tier.get_stats().compressions; }),
+        sm::make_counter("compressed_partition_hits", sm::description("total number of partitions moved from the compressed tier back to cache by reads"), [this] { return _compressed_tier.get_stats().hits; }),
+        sm::make_counter("compressed_partition_evictions", sm::description("total number of partitions evicted from the compressed tier"), [this] { return _compressed_tier.get_stats().evictions; }),
+        sm::make_gauge("partition_hit_ratio", sm::description("ratio of partition hits to all partition lookups since startup"), [this] {
+            auto lookups = _stats.partition_hits + _stats.partition_misses;
+            return lookups ? double(_stats.partition_hits) / lookups : 0.0;
+        }),
     });
     sstables::register_index_page_cache_metrics(_metrics, _index_cached_file_stats);
     sstables::register_index_page_metrics(_metrics, _partition_index_cache_stats);
+    sstables::register_data_chunk_cache_metrics(_metrics, _chunk_cache_stats);
+}
+
+void cache_tracker::setup_table_metrics(const sstring& ks_name, const sstring& cf_name) {
+    namespace sm = seastar::metrics;
+    auto ks = sm::label("ks")(ks_name);
+    auto cf = sm::label("cf")(cf_name);
+    _metrics.add_group("cache", {
+        sm::make_gauge("table_bytes_used", sm::description("current bytes used by the dedicated cache of a table with memory bounds"), [this] { return _region.occupancy().used_space(); })(ks)(cf),
+        sm::make_gauge("table_memory_reservation", sm::description("bytes of memory reserved for the dedicated cache of a table"), [this] { return _memory_reservation; })(ks)(cf),
+        sm::make_gauge("table_memory_limit", sm::description("maximum bytes of memory used by the dedicated cache of a table, 0 if not limited"), [this] { return _memory_limit; })(ks)(cf),
+        sm::make_gauge("table_partitions", sm::description("total number of partitions in the dedicated cache of a table"), _stats.partitions)(ks)(cf),
+        sm::make_gauge("table_rows", sm::description("total number of rows in the dedicated cache of a table"), _stats.rows)(ks)(cf),
+        sm::make_counter("table_partition_hits", sm::description("number of partitions needed by reads and found in the dedicated cache of a table"), _stats.partition_hits)(ks)(cf),
+        sm::make_counter("table_partition_misses", sm::description("number of partitions needed by reads and missing in the dedicated cache of a table"), _stats.partition_misses)(ks)(cf),
+        sm::make_counter("table_partition_evictions", sm::description("total number of partitions evicted from the dedicated cache of a table"), _stats.partition_evictions)(ks)(cf),
+        sm::make_counter("table_row_evictions", sm::description("total number of rows evicted from the dedicated cache of a table"), _stats.row_evictions)(ks)(cf),
+    });
 }
 
 void cache_tracker::clear() {
@@ -224,6 +384,9 @@ void cache_tracker::insert(cache_entry& entry) {
     insert(entry.partition());
     ++_stats.partition_insertions;
     ++_stats.partitions;
+    if (_memory_limit && !_memory_limit_timer.armed() && _region.occupancy().used_space() > _memory_limit) [[unlikely]] {
+        _memory_limit_timer.arm(lowres_clock::duration::zero());
+    }
     // partition_range_cursor depends on this to detect invalidation of _end
     _region.allocator().invalidate_references();
 }
@@ -521,6 +684,12 @@ void row_cache::on_static_row_insert() {
     ++_tracker._stats.static_row_insertions;
 }
 
+uint64_t row_cache::access_hash(const dht::decorated_key& dk) const noexcept {
+    // Tokens are already well distributed, mix in the table so that tables
+    // sharing the tracker don't share counters for equal keys.
+    return uint64_t(dk.token().raw()) ^ _schema->id().uuid().get_least_significant_bits();
+}
+
 class range_populating_reader {
     row_cache& _cache;
     autoupdating_underlying_reader& _reader;
@@ -604,6 +773,10 @@ class range_populating_reader {
 
         return _reader.fast_forward_to(std::move(pr));
     }
+    // Key of the partition returned by the last call to operator(), if any.
+    std::optional<dht::decorated_key> last_key() const {
+        return _last_key ? _last_key->_key : std::nullopt;
+    }
     future<> close() noexcept {
         return _reader.close();
     }
@@ -621,13 +794,34 @@ class scanning_and_populating_reader final : public mutation_reader::impl {
     std::optional<dht::partition_range::bound> _lower_bound;
     dht::partition_range _secondary_range;
     mutation_reader_opt _reader;
+    // Key of the partition read by _reader, for scan admission in the cache tracker.
+    std::optional<dht::decorated_key> _current_key;
 private:
     mutation_reader read_from_entry(cache_entry& ce) {
         _cache.upgrade_entry(ce);
         _cache.on_partition_hit();
+        if (_cache._tracker.scan_resistant()) {
+            _current_key = ce.key();
+        }
         return ce.read(_cache, *_read_context);
     }
 
+    // Lets the tracker decide whether the partition we are done with stays in its
+    // current LRU position or goes to the cold end. Must be called after _reader is closed,
+    // so that its snapshot no longer pins the entry's version.
+    // Doesn't allocate, so doesn't need to run in an allocating section.
+    void on_partition_done() noexcept {
+        if (!_current_key) {
+            return;
+        }
+        auto key = std::exchange(_current_key, std::nullopt);
+        dht::ring_position_comparator cmp(*_cache._schema);
+        auto it = _cache._partitions.find(*key, cmp);
+        if (it != _cache._partitions.end()) {
+            _cache._tracker.on_partition_scanned(*it, _cache.access_hash(*key));
+        }
+    }
+
     static dht::ring_position_view as_ring_position_view(const std::optional<dht::partition_range::bound>& lower_bound) {
         return lower_bound ? dht::ring_position_view(lower_bound->value(), dht::ring_position_view::after_key(!lower_bound->is_inclusive()))
                            : dht::ring_position_view::min();
@@ -692,6 +886,9 @@ class scanning_and_populating_reader final : public mutation_reader::impl {
     future<mutation_reader_opt> read_from_secondary() {
         return _secondary_reader().then([this] (mutation_reader_opt&& fropt) {
             if (fropt) {
+                if (_cache._tracker.scan_resistant()) {
+                    _current_key = _secondary_reader.last_key();
+                }
                 return make_ready_future<mutation_reader_opt>(std::move(fropt));
             } else {
                 _secondary_in_progress = false;
@@ -702,6 +899,7 @@ class scanning_and_populating_reader final : public mutation_reader::impl {
     future<> read_next_partition() {
       auto close_reader = _reader ? _reader->close() : make_ready_future<>();
       return close_reader.then([this] {
+        on_partition_done();
         _read_next_partition = false;
         return (_secondary_in_progress ? read_from_secondary() : read_from_primary()).then([this] (auto&& fropt) {
             if (bool(fropt)) {
@@ -761,7 +959,9 @@ class scanning_and_populating_reader final : public mutation_reader::impl {
         auto close_reader = _reader ? _reader->close() : make_ready_future<>();
         auto close_secondary_reader = _secondary_reader.close();
         auto close_read_context = _read_context->close();
-        return when_all_succeed(std::move(close_reader), std::move(close_secondary_reader), std::move(close_read_context)).discard_result();
+        return when_all_succeed(std::move(close_reader), std::move(close_secondary_reader), std::move(close_read_context)).discard_result().finally([this] {
+            on_partition_done();
+        });
     }
 };
 
@@ -788,15 +988,20 @@ row_cache::make_reader_opt(schema_ptr s,
     if (query::is_single_partition(range) && !fwd_mr) {
         tracing::trace(trace_state, "Querying cache for range {} and slice {}",
                 range, seastar::value_of([&slice] { return slice.get_all_ranges(); }));
+        if (!_compressed.empty()) {
+            populate_from_compressed_tier(range.start()->value().as_decorated_key());
+        }
         auto mr = _read_section(_tracker.region(), [&] () -> mutation_reader_opt {
             dht::ring_position_comparator cmp(*_schema);
             auto&& pos = range.start()->value();
             partitions_type::bound_hint hint;
             auto i = _partitions.lower_bound(pos, cmp, hint);
+            _tracker.on_partition_access(access_hash(pos.as_decorated_key()));
             if (hint.match) {
                 cache_entry& e = *i;
                 upgrade_entry(e);
                 on_partition_hit();
+                e.set_referenced(true);
                 return e.read(*this, make_context());
             } else if (i->continuous()) {
                 return {};
@@ -879,6 +1084,7 @@ row_cache::~row_cache() {
 }
 
 void row_cache::clear_now() noexcept {
+    _compressed.clear();
     with_allocator(_tracker.allocator(), [this] {
         auto it = _partitions.erase_and_dispose(_partitions.begin(), partitions_end(), [this] (cache_entry* p) noexcept {
             _tracker.on_partition_erase();
@@ -1067,6 +1273,7 @@ future<> row_cache::do_update(external_updater eu, replica::memtable& m, Updater
                                 _update_section(_tracker.region(), [&] {
                                     replica::memtable_entry& mem_e = *m.partitions.begin();
                                     size_entry = mem_e.size_in_allocator_without_rows(_tracker.allocator());
+                                    _compressed.erase(mem_e.key());
                                     partitions_type::bound_hint hint;
                                     auto cache_i = _partitions.lower_bound(mem_e.key(), cmp, hint);
                                     update = updater(_update_section, cache_i, mem_e, is_present, real_dirty_acc, hint, preempt_src);
@@ -1167,6 +1374,142 @@ void row_cache::refresh_snapshot() {
     _underlying = _snapshot_source();
 }
 
+future<std::vector<dht::decorated_key>> row_cache::cached_keys(size_t max) {
+    std::vector<dht::decorated_key> keys;
+    if (!max) {
+        co_return keys;
+    }
+    // Look at more candidates than we return so that frequency can decide which ones to keep.
+    const size_t max_candidates = _tracker.scan_resistant() ? max * 4 : max;
+    std::optional<dht::decorated_key> last;
+    bool done = false;
+    while (!done && keys.size() < max_candidates) {
+        done = _read_section(_tracker.region(), [&] {
+            dht::ring_position_comparator cmp(*_schema);
+            auto it = last ? _partitions.upper_bound(*last, cmp) : _partitions.begin();
+            for (size_t n = 0; n < 128 && keys.size() < max_candidates; ++n, ++it) {
+                if (it->is_dummy_entry()) {
+                    return true;
+                }
+                keys.push_back(it->key());
+            }
+            return false;
+        });
+        if (!keys.empty()) {
+            last = keys.back();
+        }
+        co_await coroutine::maybe_yield();
+    }
+    if (keys.size() > max) {
+        std::vector<std::pair<unsigned, size_t>> order;
+        order.reserve(keys.size());
+        for (size_t i = 0; i < keys.size(); ++i) {
+            order.emplace_back(_tracker.estimate_frequency(access_hash(keys[i])), i);
+        }
+        std::ranges::stable_sort(order, std::greater<>(), [] (const auto& p) { return p.first; });
+        std::vector<dht::decorated_key> hottest;
+        hottest.reserve(max);
+        for (size_t i = 0; i < max; ++i) {
+            hottest.push_back(std::move(keys[order[i].second]));
+        }
+        keys = std::move(hottest);
+    }
+    co_return keys;
+}
+
+size_t row_cache::compress_cold_partitions(size_t max_bytes) noexcept {
+    // A partition compressed during an update could miss invalidation, see invalidate().
+    if (!_update_sem.available_units()) {
+        return 0;
+    }
+    // Bounds the work done per call when most entries were read recently.
+    static constexpr unsigned max_visits = 1024;
+    unsigned visits = 0;
+    size_t compressed = 0;
+    try {
+        while (compressed < max_bytes && visits < max_visits) {
+            std::optional<dht::decorated_key> key;
+            std::optional<canonical_mutation> cm;
+            bool wrapped = _read_section(_tracker.region(), [&] {
+                dht::ring_position_comparator cmp(*_schema);
+                auto it = _compression_sweep_pos ? _partitions.lower_bound(*_compression_sweep_pos, cmp) : _partitions.begin();
+                for (; !it->is_dummy_entry() && visits < max_visits; ++it) {
+                    cache_entry& e = *it;
+                    ++visits;
+                    // Second chance for entries read since the sweep passed them.
+                    if (e.referenced()) {
+                        e.set_referenced(false);
+                        continue;
+                    }
+                    if (e.is_compressible(compressible_partition_max_rows)) {
+                        key = e.key();
+                        const schema_ptr& s = e.schema();
+                        cm = canonical_mutation(mutation(s, e.key(), e.partition().version()->partition().as_mutation_partition(*s)));
+                        ++it;
+                        break;
+                    }
+                }
+                if (it->is_dummy_entry()) {
+                    _compression_sweep_pos.reset();
+                    return true;
+                }
+                _compression_sweep_pos = it->key();
+                return false;
+            });
+            if (cm && cm->representation().size() <= compressible_partition_max_bytes) {
+                auto size = cm->representation().size();
+                auto cp = std::make_unique<cache::compressed_partition>(std::move(*key), std::move(*cm));
+                // Allocations above may have caused eviction, so look the entry up again.
+                bool removed = _update_section(_tracker.region(), [&] {
+                    auto i = _partitions.find(cp->key(), dht::ring_position_comparator(*_schema));
+                    if (i == _partitions.end() || !i->is_compressible(compressible_partition_max_rows)) {
+                        return false;
+                    }
+                    with_allocator(_tracker.allocator(), [&] {
+                        i->on_evicted(_tracker);
+                    });
+                    return true;
+                });
+                if (removed) {
+                    _compressed.insert(std::move(cp));
+                    compressed += size;
+                }
+            }
+            if (wrapped) {
+                break;
+            }
+        }
+    } catch (...) {
+        clogger.debug("Failed to compress cold partitions: {}", std::current_exception());
+    }
+    return compressed;
+}
+
+void row_cache::populate_from_compressed_tier(const dht::decorated_key& dk) {
+    auto cp = _compressed.take(dk);
+    if (!cp) {
+        return;
+    }
+    try {
+        mutation m = cp->decompress().to_mutation(_schema);
+        _populate_section(_tracker.region(), [&] {
+            do_find_or_create_entry(dk, nullptr, [&] (auto i, const partitions_type::bound_hint& hint) {
+                partitions_type::iterator entry = _partitions.emplace_before(i, dk.token().raw(), hint,
+                        m.schema(), m.decorated_key(), m.partition());
+                _tracker.insert(*entry);
+                entry->set_continuous(i->continuous());
+                return entry;
+            }, [&] (auto i) {
+                // Populated from the underlying source in the meantime.
+            });
+        });
+        _tracker.compressed_tier().on_hit();
+    } catch (...) {
+        // The read will go to the underlying source instead.
+        clogger.debug("Failed to populate {} from the compressed tier: {}", dk, std::current_exception());
+    }
+}
+
 void row_cache::touch(const dht::decorated_key& dk) {
  _read_section(_tracker.region(), [&] {
     auto i = _partitions.find(dk, dht::ring_position_comparator(*_schema));
@@ -1197,6 +1540,7 @@ void row_cache::unlink_from_lru(const dht::decorated_key& dk) {
 }
 
 void row_cache::invalidate_locked(const dht::decorated_key& dk) {
+    _compressed.erase(dk);
     auto pos = _partitions.lower_bound(dk, dht::ring_position_comparator(*_schema));
     if (pos == partitions_end() || !pos->key().equal(*_schema, dk)) {
         _tracker.clear_continuity(*pos);
@@ -1220,6 +1564,11 @@ future<> row_cache::invalidate(external_updater eu, const dht::partition_range&
 
 future<> row_cache::invalidate(external_updater eu, dht::partition_range_vector&& ranges, cache_invalidation_filter filter) {
     return do_update(std::move(eu), [this, ranges = std::move(ranges), filter = std::move(filter)] mutable {
+        // compress_cold_partitions() doesn't run during updates, so no compressed partitions
+        // can appear in the ranges until we're done. Dropping them upfront is enough.
+        for (auto&& range : ranges) {
+            _compressed.erase(range);
+        }
         return seastar::async([this, ranges = std::move(ranges), filter = std::move(filter)] {
             auto on_failure = defer([this] () noexcept {
                 this->clear_now();
@@ -1277,6 +1626,7 @@ future<> row_cache::invalidate(external_updater eu, dht::partition_range_vector&
 }
 
 void row_cache::evict() {
+    _compressed.clear();
     while (_tracker.region().evict_some() == memory::reclaiming_result::reclaimed_something) {}
 }
 
@@ -1286,6 +1636,7 @@ row_cache::row_cache(schema_ptr s, snapshot_source src, cache_tracker& tracker,
     , _partitions(dht::raw_token_less_comparator{})
     , _underlying(src())
     , _snapshot_source(std::move(src))
+    , _compressed(tracker.compressed_tier(), *this, _schema)
 {
   try {
     with_allocator(_tracker.allocator(), [this, cont] {
@@ -1321,6 +1672,23 @@ void row_cache::set_schema(schema_ptr new_schema) noexcept {
     _schema = std::move(new_schema);
 }
 
+bool cache_entry::is_compressible(size_t max_rows) noexcept {
+    if (is_dummy_entry() || _pe._snapshot) {
+        return false;
+    }
+    partition_version& v = *_pe.version();
+    if (v.next() || !v.partition().static_row_continuous()) {
+        return false;
+    }
+    size_t rows = 0;
+    for (const rows_entry& e : v.partition().clustered_rows()) {
+        if (!e.continuous() || ++rows > max_rows) {
+            return false;
+        }
+    }
+    return true;
+}
+
 void cache_entry::on_evicted(cache_tracker& tracker) noexcept {
     row_cache::partitions_type::iterator it(this);
     std::next(it)->set_continuous(false);
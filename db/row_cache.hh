@@ -18,6 +18,7 @@
 #include "mutation/partition_version.hh"
 #include "utils/double-decker.hh"
 #include "db/cache_tracker.hh"
+#include "db/row_cache_compressed_tier.hh"
 #include "readers/empty.hh"
 #include "readers/mutation_source.hh"
 #include "compaction/compaction_garbage_collector.hh"
@@ -54,6 +55,8 @@ class cache_entry {
         bool _head : 1;
         bool _tail : 1;
         bool _train : 1;
+        // Set by reads, cleared by the sweep which compresses cold partitions.
+        bool _referenced : 1;
     } _flags{};
     friend class size_calculator;
 
@@ -129,6 +132,11 @@ class cache_entry {
     mutation_reader read(row_cache&, std::unique_ptr<cache::read_context>, utils::phased_barrier::phase_type);
     bool continuous() const noexcept { return _flags._continuous; }
     void set_continuous(bool value) noexcept { _flags._continuous = value; }
+    bool referenced() const noexcept { return _flags._referenced; }
+    void set_referenced(bool value) noexcept { _flags._referenced = value; }
+    // True iff the entry holds a complete partition, with at most max_rows rows,
+    // which can be moved to the compressed tier.
+    bool is_compressible(size_t max_rows) noexcept;
 
     bool is_dummy_entry() const noexcept { return _flags._dummy_entry; }
 };
@@ -258,6 +266,12 @@ class row_cache final {
     logalloc::allocating_section _update_section;
     logalloc::allocating_section _populate_section;
     logalloc::allocating_section _read_section;
+
+    // Partitions moved out of _partitions in compressed form, see compress_cold_partitions().
+    cache::compressed_partition_set _compressed;
+    // Where the next compression sweep starts, disengaged to start from the beginning.
+    std::optional<dht::decorated_key> _compression_sweep_pos;
+
     mutation_reader create_underlying_reader(cache::read_context&, mutation_source&, const dht::partition_range&);
     mutation_reader make_scanning_reader(const dht::partition_range&, std::unique_ptr<cache::read_context>);
     void on_partition_hit();
@@ -266,10 +280,14 @@ class row_cache final {
     void on_row_miss();
     void on_static_row_insert();
     void on_mispopulate();
+    // Hash of the key used for access frequency estimation by the tracker.
+    uint64_t access_hash(const dht::decorated_key&) const noexcept;
     void upgrade_entry(cache_entry&);
     void invalidate_locked(const dht::decorated_key&);
     void clear_now() noexcept;
     void clear_on_destruction() noexcept;
+    // Moves the partition from the compressed tier back to _partitions, if it's there.
+    void populate_from_compressed_tier(const dht::decorated_key&);
 
     struct previous_entry_pointer {
         std::optional<dht::decorated_key> _key;
@@ -435,6 +453,17 @@ class row_cache final {
     // source hasn't changed.
     void refresh_snapshot();
 
+    // Returns keys of up to max partitions present in cache, the most frequently
+    // read ones first if the tracker collects access frequency information,
+    // otherwise in ring order. Meant for persisting the hot set, see db/row_cache_warmup.hh.
+    future<std::vector<dht::decorated_key>> cached_keys(size_t max);
+
+    // Moves partitions which weren't read since the previous sweep passed them
+    // to the compressed tier, resuming where the previous sweep left off.
+    // Stops after compressing max_bytes worth of serialized partitions.
+    // Returns the amount compressed. Called by cache_tracker under memory pressure.
+    size_t compress_cold_partitions(size_t max_bytes) noexcept;
+
     // Moves given partition to the front of LRU if present in cache.
     void touch(const dht::decorated_key&);
 
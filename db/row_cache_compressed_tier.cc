@@ -0,0 +1,158 @@
+/*
+ * Copyright (C) 2026-present ScyllaDB
+ */
+
+/*
+ * SPDX-License-Identifier: LicenseRef-ScyllaDB-Source-Available-1.0
+ */
+
+#include <lz4.h>
+
+#include "db/row_cache_compressed_tier.hh"
+#include "utils/allocation_strategy.hh"
+
+namespace cache {
+
+compressed_partition::compressed_partition(dht::decorated_key key, canonical_mutation cm)
+    : _key(std::move(key))
+{
+    auto in = cm.representation().linearize();
+    _uncompressed_size = in.size();
+    bytes out(bytes::initialized_later(), LZ4_compressBound(in.size()));
+    auto len = LZ4_compress_default(reinterpret_cast<const char*>(in.data()), reinterpret_cast<char*>(out.data()), in.size(), out.size());
+    if (len <= 0) {
+        throw std::runtime_error("LZ4 compression of a cached partition failed");
+    }
+    _data = bytes(out.data(), len);
+}
+
+size_t compressed_partition::memory_usage() const noexcept {
+    return sizeof(*this) + _key.key().external_memory_usage() + _data.size();
+}
+
+canonical_mutation compressed_partition::decompress() const {
+    bytes out(bytes::initialized_later(), _uncompressed_size);
+    auto len = LZ4_decompress_safe(reinterpret_cast<const char*>(_data.data()), reinterpret_cast<char*>(out.data()), _data.size(), out.size());
+    if (len < 0 || uint32_t(len) != _uncompressed_size) {
+        throw std::runtime_error(fmt::format("LZ4 decompression of cached partition {} failed", _key));
+    }
+    bytes_ostream repr;
+    repr.write(out);
+    return canonical_mutation(std::move(repr));
+}
+
+bool compressed_partition_set::key_less::operator()(const compressed_partition& a, const compressed_partition& b) const {
+    return dht::ring_position_tri_compare(*s, a.key(), b.key()) < 0;
+}
+
+bool compressed_partition_set::key_less::operator()(const compressed_partition& a, dht::ring_position_view b) const {
+    return dht::ring_position_tri_compare(*s, a.key(), b) < 0;
+}
+
+bool compressed_partition_set::key_less::operator()(dht::ring_position_view a, const compressed_partition& b) const {
+    return dht::ring_position_tri_compare(*s, a, b.key()) < 0;
+}
+
+compressed_partition_set::compressed_partition_set(compressed_tier& tier, row_cache& cache, schema_ptr s)
+    : _tier(tier)
+    , _cache(cache)
+    , _partitions(key_less{std::move(s)})
+{
+    _tier._sets.push_back(*this);
+}
+
+compressed_partition_set::~compressed_partition_set() {
+    clear();
+}
+
+void compressed_partition_set::insert(std::unique_ptr<compressed_partition> p) noexcept {
+    erase(p->key());
+    _partitions.insert(*p);
+    _tier.add(*p.release());
+}
+
+std::unique_ptr<compressed_partition> compressed_partition_set::take(const dht::decorated_key& key) noexcept {
+    auto it = _partitions.find(dht::ring_position_view(key), _partitions.key_comp());
+    if (it == _partitions.end()) {
+        return nullptr;
+    }
+    std::unique_ptr<compressed_partition> p(&*it);
+    _partitions.erase(it);
+    _tier.remove(*p);
+    return p;
+}
+
+void compressed_partition_set::erase(const dht::decorated_key& key) noexcept {
+    if (_partitions.empty()) {
+        return;
+    }
+    auto it = _partitions.find(dht::ring_position_view(key), _partitions.key_comp());
+    if (it != _partitions.end()) {
+        _tier.destroy(&*it);
+    }
+}
+
+void compressed_partition_set::erase(const dht::partition_range& range) noexcept {
+    if (_partitions.empty()) {
+        return;
+    }
+    auto it = _partitions.lower_bound(dht::ring_position_view::for_range_start(range), _partitions.key_comp());
+    auto end = _partitions.lower_bound(dht::ring_position_view::for_range_end(range), _partitions.key_comp());
+    while (it != end) {
+        _tier.destroy(&*it++);
+    }
+}
+
+void compressed_partition_set::clear() noexcept {
+    while (!_partitions.empty()) {
+        _tier.destroy(&*_partitions.begin());
+    }
+}
+
+compressed_tier::compressed_tier()
+    : _reclaimer([this] (seastar::memory::reclaimer::request r) { return reclaim(r); }, seastar::memory::reclaimer_scope::sync)
+{ }
+
+compressed_tier::~compressed_tier() {
+    evict_to(0);
+}
+
+void compressed_tier::add(compressed_partition& p) noexcept {
+    _lru.push_back(p);
+    ++_stats.partitions;
+    ++_stats.compressions;
+    _stats.memory += p.memory_usage();
+    _stats.uncompressed_memory += p.uncompressed_size();
+}
+
+void compressed_tier::remove(compressed_partition& p) noexcept {
+    p._lru_link.unlink();
+    --_stats.partitions;
+    _stats.memory -= p.memory_usage();
+    _stats.uncompressed_memory -= p.uncompressed_size();
+}
+
+void compressed_tier::destroy(compressed_partition* p) noexcept {
+    remove(*p);
+    // May be called from within an LSA allocator context, but entries live in standard memory.
+    with_allocator(standard_allocator(), [p] {
+        delete p;
+    });
+}
+
+seastar::memory::reclaiming_result compressed_tier::reclaim(seastar::memory::reclaimer::request r) noexcept {
+    if (_lru.empty()) {
+        return seastar::memory::reclaiming_result::reclaimed_nothing;
+    }
+    evict_to(_stats.memory - std::min<size_t>(_stats.memory, r.bytes_to_reclaim));
+    return seastar::memory::reclaiming_result::reclaimed_something;
+}
+
+void compressed_tier::evict_to(size_t budget) noexcept {
+    while (_stats.memory > budget && !_lru.empty()) {
+        destroy(&_lru.front());
+        ++_stats.evictions;
+    }
+}
+
+} // namespace cache
@@ -0,0 +1,164 @@
+/*
+ * Copyright (C) 2026-present ScyllaDB
+ */
+
+/*
+ * SPDX-License-Identifier: LicenseRef-ScyllaDB-Source-Available-1.0
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <memory>
+
+#include <boost/intrusive/list.hpp>
+#include <boost/intrusive/set.hpp>
+
+#include <seastar/core/memory.hh>
+
+#include "bytes.hh"
+#include "mutation/canonical_mutation.hh"
+#include "dht/decorated_key.hh"
+#include "dht/i_partitioner_fwd.hh"
+#include "dht/ring_position.hh"
+#include "schema/schema_fwd.hh"
+
+namespace bi = boost::intrusive;
+
+class row_cache;
+
+namespace cache {
+
+class compressed_tier;
+class compressed_partition_set;
+
+// A partition moved out of the row cache and kept compressed.
+//
+// Lives in standard memory, outside of the cache's LSA region. Represents
+// the same writes the cache entry did when it was compressed, i.e. it is
+// subject to the same invalidation rules as a cache entry.
+class compressed_partition {
+    using lru_link_type = bi::list_member_hook<bi::link_mode<bi::auto_unlink>>;
+    using set_link_type = bi::set_member_hook<bi::link_mode<bi::auto_unlink>>;
+
+    lru_link_type _lru_link;
+    set_link_type _set_link;
+    dht::decorated_key _key;
+    // LZ4 block holding the representation of a canonical_mutation.
+    bytes _data;
+    uint32_t _uncompressed_size;
+
+    friend class compressed_tier;
+    friend class compressed_partition_set;
+public:
+    // Must be called with the standard allocator.
+    compressed_partition(dht::decorated_key, canonical_mutation);
+
+    const dht::decorated_key& key() const noexcept { return _key; }
+    size_t uncompressed_size() const noexcept { return _uncompressed_size; }
+    size_t compressed_size() const noexcept { return _data.size(); }
+    size_t memory_usage() const noexcept;
+
+    canonical_mutation decompress() const;
+};
+
+// Compressed partitions of a single row_cache, ordered by ring position.
+//
+// All methods can be called with any allocator.
+class compressed_partition_set {
+    struct key_less {
+        schema_ptr s;
+        bool operator()(const compressed_partition&, const compressed_partition&) const;
+        bool operator()(const compressed_partition&, dht::ring_position_view) const;
+        bool operator()(dht::ring_position_view, const compressed_partition&) const;
+    };
+    using set_type = bi::set<compressed_partition,
+        bi::member_hook<compressed_partition, compressed_partition::set_link_type, &compressed_partition::_set_link>,
+        bi::constant_time_size<false>,
+        bi::compare<key_less>>;
+    using tier_link_type = bi::list_member_hook<bi::link_mode<bi::auto_unlink>>;
+
+    compressed_tier& _tier;
+    row_cache& _cache;
+    tier_link_type _tier_link;
+    set_type _partitions;
+
+    friend class compressed_tier;
+public:
+    compressed_partition_set(compressed_tier&, row_cache&, schema_ptr);
+    ~compressed_partition_set();
+    compressed_partition_set(const compressed_partition_set&) = delete;
+
+    bool empty() const noexcept { return _partitions.empty(); }
+    row_cache& cache() noexcept { return _cache; }
+
+    // Replaces the entry with the same key, if there is one.
+    void insert(std::unique_ptr<compressed_partition>) noexcept;
+    // Unlinks the entry for given key and hands it over to the caller.
+    std::unique_ptr<compressed_partition> take(const dht::decorated_key&) noexcept;
+    void erase(const dht::decorated_key&) noexcept;
+    void erase(const dht::partition_range&) noexcept;
+    void clear() noexcept;
+};
+
+// The compressed tier of a cache_tracker: compressed partitions of all its
+// row caches, evicted in the order they were compressed in when the tier
+// exceeds its memory budget.
+//
+// The partitions live in standard memory, so LSA eviction can't free them.
+// Instead, the tier registers a memory reclaimer, which evicts them when
+// the shard runs low on memory, before the sweep gets to trim the tier.
+class compressed_tier {
+public:
+    struct stats {
+        uint64_t partitions;
+        uint64_t memory;
+        uint64_t uncompressed_memory;
+        uint64_t compressions;
+        uint64_t hits;
+        uint64_t evictions;
+    };
+private:
+    using lru_type = bi::list<compressed_partition,
+        bi::member_hook<compressed_partition, compressed_partition::lru_link_type, &compressed_partition::_lru_link>,
+        bi::constant_time_size<false>>;
+    using sets_type = bi::list<compressed_partition_set,
+        bi::member_hook<compressed_partition_set, compressed_partition_set::tier_link_type, &compressed_partition_set::_tier_link>,
+        bi::constant_time_size<false>>;
+
+    lru_type _lru;
+    sets_type _sets;
+    stats _stats{};
+    seastar::memory::reclaimer _reclaimer;
+
+    friend class compressed_partition_set;
+    void add(compressed_partition&) noexcept;
+    void remove(compressed_partition&) noexcept;
+    void destroy(compressed_partition*) noexcept;
+    seastar::memory::reclaiming_result reclaim(seastar::memory::reclaimer::request) noexcept;
+public:
+    compressed_tier();
+    ~compressed_tier();
+
+    const stats& get_stats() const noexcept { return _stats; }
+    void on_hit() noexcept { ++_stats.hits; }
+
+    // Evicts least recently compressed partitions until the tier uses no more than `budget` bytes.
+    void evict_to(size_t budget) noexcept;
+
+    // Calls func(row_cache&, budget) at most once for each row cache attached to this tier,
+    // starting where the previous call left off. func returns the part of the budget it used.
+    template <typename Func>
+    requires std::is_invocable_r_v<size_t, Func, row_cache&, size_t>
+    void for_each_cache(size_t budget, Func&& func) {
+        for (size_t n = std::distance(_sets.begin(), _sets.end()); n && budget; --n) {
+            auto& set = _sets.front();
+            // Rotate, so that the next call starts with the following cache.
+            set._tier_link.unlink();
+            _sets.push_back(set);
+            budget -= std::min(budget, func(set.cache(), budget));
+        }
+    }
+};
+
+} // namespace cache
@@ -0,0 +1,282 @@
+/*
+ * Copyright (C) 2026-present ScyllaDB
+ */
+
+/*
+ * SPDX-License-Identifier: LicenseRef-ScyllaDB-Source-Available-1.0
+ */
+
+#include <charconv>
+
+#include <seastar/core/coroutine.hh>
+#include <seastar/core/fstream.hh>
+#include <seastar/core/seastar.hh>
+#include <seastar/core/sleep.hh>
+#include <seastar/core/smp.hh>
+#include <seastar/coroutine/maybe_yield.hh>
+#include <seastar/util/file.hh>
+
+#include "db/row_cache_warmup.hh"
+#include "db/config.hh"
+#include "db/extensions.hh"
+#include "db/system_keyspace.hh"
+#include "replica/database.hh"
+#include "bytes_ostream.hh"
+#include "utils/disk-error-handler.hh"
+#include "utils/lister.hh"
+#include "utils/log.hh"
+
+namespace db {
+
+static logging::logger wlogger("cache_warmup");
+
+// File layout: header, then for each key its length and the partition key representation.
+// All integers are little endian.
+static constexpr uint32_t keys_file_magic = 0x57434352; // "RCCW"
+static constexpr uint32_t keys_file_version = 1;
+static constexpr std::string_view keys_file_suffix = ".keys";
+
+static bool is_user_table(const replica::database& db, const replica::table& t) {
+    auto& ks = t.schema()->ks_name();
+    return !is_system_keyspace(ks) && !db.get_config().extensions().is_extension_internal_keyspace(ks);
+}
+
+std::filesystem::path row_cache_warmup::directory(const replica::database& db) {
+    return std::filesystem::path(db.get_config().saved_caches_directory()) / "row_cache";
+}
+
+static sstring keys_file_name(table_id id, shard_id shard) {
+    return fmt::format("{}.{}{}", id, shard, keys_file_suffix);
+}
+
+// Parses the table id out of a name produced by keys_file_name().
+static std::optional<table_id> table_of(std::string_view name) {
+    if (!name.ends_with(keys_file_suffix)) {
+        return std::nullopt;
+    }
+    auto dot = name.find('.');
+    try {
+        return table_id(utils::UUID(name.substr(0, dot)));
+    } catch (...) {
+        return std::nullopt;
+    }
+}
+
+// Parses the shard out of a name produced by keys_file_name().
+static std::optional<shard_id> shard_of(std::string_view name) {
+    if (!name.ends_with(keys_file_suffix)) {
+        return std::nullopt;
+    }
+    name.remove_suffix(keys_file_suffix.size());
+    auto dot = name.rfind('.');
+    if (dot == std::string_view::npos) {
+        return std::nullopt;
+    }
+    shard_id shard;
+    auto digits = name.substr(dot + 1);
+    auto res = std::from_chars(digits.data(), digits.data() + digits.size(), shard);
+    if (res.ec != std::errc() || res.ptr != digits.data() + digits.size()) {
+        return std::nullopt;
+    }
+    return shard;
+}
+
+// Removes keys saved by this shard in the past, so that they don't outlive
+// the tables or partitions they belong to. Keys saved by shards which no
+// longer exist are removed by shard 0.
+static future<> remove_stale_keys(std::filesystem::path dir) {
+    co_await lister::scan_dir(dir, lister::dir_entry_types::of<directory_entry_type::regular>(), [] (std::filesystem::path dir, directory_entry de) {
+        auto shard = shard_of(de.name);
+        if (!shard || (*shard != this_shard_id() && (this_shard_id() != 0 || *shard < smp::count))) {
+            return make_ready_future<>();
+        }
+        return remove_file((dir / de.name.c_str()).native());
+    });
+}
+
+template <typename T>
+static void append_le(bytes_ostream& out, T v) {
+    auto le = cpu_to_le(v);
+    out.write(bytes_view(reinterpret_cast<const int8_t*>(&le), sizeof(le)));
+}
+
+static future<> write_keys(std::filesystem::path dir, sstring name, const std::vector<dht::decorated_key>& keys) {
+    bytes_ostream buf;
+    append_le(buf, keys_file_magic);
+    append_le(buf, keys_file_version);
+    for (auto& dk : keys) {
+        auto repr = to_bytes(dk.key().representation());
+        append_le(buf, uint32_t(repr.size()));
+        buf.write(repr);
+        co_await coroutine::maybe_yield();
+    }
+
+    auto path = (dir / name).native();
+    auto tmp_path = path + ".tmp";
+    auto f = co_await open_checked_file_dma(general_disk_error_handler, tmp_path, open_flags::wo | open_flags::create | open_flags::truncate);
+    auto out = co_await make_file_output_stream(std::move(f));
+    std::exception_ptr ex;
+    try {
+        for (auto&& fragment : buf) {
+            co_await out.write(reinterpret_cast<const char*>(fragment.data()), fragment.size());
+        }
+        co_await out.flush();
+    } catch (...) {
+        ex = std::current_exception();
+    }
+    co_await out.close();
+    if (ex) {
+        co_await coroutine::return_exception_ptr(std::move(ex));
+    }
+    co_await rename_file(tmp_path, path);
+}
+
+future<> row_cache_warmup::save(replica::database& db) {
+    auto max_keys = db.get_config().row_cache_keys_to_save();
+    if (!max_keys) {
+        co_return;
+    }
+    auto dir = directory(db);
+    co_await io_check([dir] { return recursive_touch_directory(dir.native()); });
+    co_await remove_stale_keys(dir);
+
+    std::vector<lw_shared_ptr<replica::table>> tables;
+    db.get_tables_metadata().for_each_table([&] (table_id, lw_shared_ptr<replica::table> t) {
+        if (is_user_table(db, *t) && t->cache_enabled()) {
+            tables.push_back(std::move(t));
+        }
+    });
+
+    size_t total = 0;
+    for (auto& t : tables) {
+        try {
+            auto keys = co_await t->get_row_cache().cached_keys(max_keys);
+            if (keys.empty()) {
+                continue;
+            }
+            co_await write_keys(dir, keys_file_name(t->schema()->id(), this_shard_id()), keys);
+            total += keys.size();
+        } catch (...) {
+            wlogger.warn("Failed to save cached keys of {}.{}: {}", t->schema()->ks_name(), t->schema()->cf_name(), std::current_exception());
+        }
+    }
+    co_await io_check(sync_directory, dir.native());
+    wlogger.info("Saved {} cached partition keys of {} tables", total, tables.size());
+}
+
+static std::vector<partition_key> parse_keys(const temporary_buffer<char>& buf, const sstring& name) {
+    std::vector<partition_key> keys;
+    auto data = buf.get();
+    auto end = data + buf.size();
+    auto read_u32 = [&] () -> std::optional<uint32_t> {
+        if (end - data < ptrdiff_t(sizeof(uint32_t))) {
+            return std::nullopt;
+        }
+        uint32_t v;
+        std::memcpy(&v, data, sizeof(v));
+        data += sizeof(v);
+        return le_to_cpu(v);
+    };
+    if (read_u32() != keys_file_magic || read_u32() != keys_file_version) {
+        wlogger.warn("Ignoring {}: unrecognized format", name);
+        return keys;
+    }
+    while (data != end) {
+        auto len = read_u32();
+        if (!len || end - data < ptrdiff_t(*len)) {
+            wlogger.warn("Ignoring truncated {} after {} keys", name, keys.size());
+            break;
+        }
+        keys.push_back(partition_key::from_bytes(managed_bytes_view(bytes_view(reinterpret_cast<const int8_t*>(data), *len))));
+        data += *len;
+    }
+    return keys;
+}
+
+// Reads the partition through the cache, which populates it. Returns the amount of memory read.
+static future<uint64_t> populate(replica::table& t, schema_ptr s, const dht::decorated_key& dk) {
+    auto permit = co_await t.streaming_read_concurrency_semaphore().obtain_permit(s, "cache-warmup", t.estimate_read_memory_cost(), db::no_timeout, {});
+    auto pr = dht::partition_range::make_singular(dk);
+    auto rd = t.make_mutation_reader(s, std::move(permit), pr, s->full_slice());
+    uint64_t bytes = 0;
+    std::exception_ptr ex;
+    try {
+        while (auto mf = co_await rd()) {
+            bytes += mf->memory_usage(*s);
+        }
+    } catch (...) {
+        ex = std::current_exception();
+    }
+    co_await rd.close();
+    if (ex) {
+        co_await coroutine::return_exception_ptr(std::move(ex));
+    }
+    co_return bytes;
+}
+
+future<> row_cache_warmup::load(replica::database& db, abort_source& as) {
+    auto dir = directory(db);
+    if (!db.get_config().row_cache_keys_to_save() || !co_await file_exists(dir.native())) {
+        co_return;
+    }
+
+    std::vector<std::pair<sstring, table_id>> files;
+    co_await lister::scan_dir(dir, lister::dir_entry_types::of<directory_entry_type::regular>(), [&files] (std::filesystem::path, directory_entry de) {
+        if (auto id = table_of(de.name)) {
+            files.emplace_back(de.name, *id);
+        }
+        return make_ready_future<>();
+    });
+
+    const double bytes_per_second = double(db.get_config().row_cache_warmup_bandwidth_mb_per_sec()) * 1024 * 1024;
+    const auto start = lowres_clock::now();
+    uint64_t bytes = 0;
+    uint64_t partitions = 0;
+
+    for (auto& [name, id] : files) {
+        auto t = db.get_tables_metadata().get_table_if_exists(id);
+        if (!t || !t->cache_enabled()) {
+            continue;
+        }
+        auto buf = co_await seastar::util::read_entire_file_contiguous(dir / name);
+        auto s = t->schema();
+        for (auto& pk : parse_keys(buf, name)) {
+            if (as.abort_requested()) {
+                co_return;
+            }
+            auto dk = dht::decorate_key(*s, pk);
+            if (t->shard_for_reads(dk.token()) != this_shard_id()) {
+                continue;
+            }
+            try {
+                bytes += co_await populate(*t, s, dk);
+                ++partitions;
+            } catch (...) {
+                wlogger.warn("Failed to warm up {}.{}: {}", s->ks_name(), s->cf_name(), std::current_exception());
+                break;
+            }
+            if (bytes_per_second > 0) {
+                auto due = start + std::chrono::duration_cast<lowres_clock::duration>(std::chrono::duration<double>(bytes / bytes_per_second));
+                if (due > lowres_clock::now()) {
+                    try {
+                        co_await sleep_abortable<lowres_clock>(due - lowres_clock::now(), as);
+                    } catch (const sleep_aborted&) {
+                        co_return;
+                    }
+                }
+            }
+        }
+    }
+    wlogger.info("Warmed up row cache with {} partitions ({} bytes) in {}s", partitions, bytes,
+            std::chrono::duration_cast<std::chrono::seconds>(lowres_clock::now() - start).count());
+}
+
+future<> row_cache_warmup::remove(const replica::database& db) {
+    auto dir = directory(db);
+    if (!co_await file_exists(dir.native())) {
+        co_return;
+    }
+    co_await lister::rmdir(dir);
+}
+
+} // namespace db
@@ -0,0 +1,52 @@
+/*
+ * Copyright (C) 2026-present ScyllaDB
+ */
+
+/*
+ * SPDX-License-Identifier: LicenseRef-ScyllaDB-Source-Available-1.0
+ */
+
+#pragma once
+
+#include <filesystem>
+
+#include <seastar/core/abort_source.hh>
+#include <seastar/core/future.hh>
+
+#include "seastarx.hh"
+
+namespace replica {
+class database;
+}
+
+namespace db {
+
+// Persists the set of partitions held in the row cache across restarts.
+//
+// On drain, each shard writes the keys of the partitions its row cache holds
+// for every user table to <saved_caches_directory>/row_cache, capped at
+// row_cache_keys_to_save keys per table.
+// On startup, each shard reads back all saved keys of the tables it knows,
+// keeps the ones it owns (the shard count may have changed in the meantime)
+// and reads those partitions through the cache to populate it.
+// Saved keys are removed once warm-up completes, so that a crash doesn't
+// warm up a stale set on the next start.
+//
+// The warm-up runs in the background in the streaming scheduling group,
+// with reads throttled to row_cache_warmup_bandwidth_mb_per_sec.
+class row_cache_warmup {
+public:
+    static std::filesystem::path directory(const replica::database&);
+
+    // Saves the keys of partitions cached on this shard.
+    static future<> save(replica::database&);
+
+    // Populates the cache on this shard with the partitions saved by save().
+    // Resolves when done or when `as` is triggered.
+    static future<> load(replica::database&, abort_source& as);
+
+    // Removes the saved keys. Call on one shard, after load() completed on all shards.
+    static future<> remove(const replica::database&);
+};
+
+} // namespace db
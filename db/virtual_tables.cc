@@ -16,6 +16,7 @@
 #include <seastar/core/reactor.hh>
 
 #include "db/config.hh"
+#include "db/hot_partitions.hh"
 #include "db/system_keyspace.hh"
 #include "db/virtual_table.hh"
 #include "partition_slice_builder.hh"
@@ -624,6 +625,65 @@ class versions_table : public memtable_filling_virtual_table {
     }
 };
 
+class hot_partitions_table : public memtable_filling_virtual_table {
+private:
+    distributed<replica::database>& _db;
+
+    // Number of partitions listed for each kind.
+    static constexpr unsigned list_size = 100;
+public:
+    explicit hot_partitions_table(distributed<replica::database>& db)
+        : memtable_filling_virtual_table(build_schema())
+        , _db(db) {
+        _shard_aware = true;
+    }
+
+    static schema_ptr build_schema() {
+        auto id = generate_legacy_id(system_keyspace::NAME, "hot_partitions");
+        return schema_builder(system_keyspace::NAME, "hot_partitions", std::make_optional(id))
+            .with_column("kind", utf8_type, column_kind::partition_key)
+            .with_column("rank", int32_type, column_kind::clustering_key)
+            .with_column("keyspace_name", utf8_type)
+            .with_column("table_name", utf8_type)
+            .with_column("partition_key", utf8_type)
+            .with_column("count", long_type)
+            .with_column("error", long_type)
+            .set_comment("The most read and written partitions on this node, sampled over the last one to two minutes.")
+            .with_hash_version()
+            .build();
+    }
+
+    future<> execute(std::function<void(mutation)> mutation_sink) override {
+        std::vector<std::pair<db::hot_partitions_tracker::kind, dht::decorated_key>> owned;
+        for (auto kind : db::hot_partitions_tracker::all_kinds) {
+            auto dk = dht::decorate_key(*_s, partition_key::from_single_value(*schema(), data_value(sstring(db::to_string(kind))).serialize_nonnull()));
+            if (this_shard_owns(dk)) {
+                owned.emplace_back(kind, std::move(dk));
+            }
+        }
+        if (owned.empty()) {
+            co_return;
+        }
+        auto hot = co_await db::get_hot_partitions(_db, list_size);
+        for (auto& [kind, dk] : owned) {
+            const auto& list = kind == db::hot_partitions_tracker::kind::reads ? hot.reads
+                    : kind == db::hot_partitions_tracker::kind::writes ? hot.writes
+                    : hot.write_kib;
+            mutation m(schema(), std::move(dk));
+            int32_t rank = 0;
+            for (auto& p : list) {
+                row& cr = m.partition().clustered_row(*schema(), clustering_key::from_single_value(*schema(), data_value(++rank).serialize_nonnull())).cells();
+                set_cell(cr, "keyspace_name", p.keyspace);
+                set_cell(cr, "table_name", p.table);
+                set_cell(cr, "partition_key", p.partition_key);
+                set_cell(cr, "count", int64_t(p.count));
+                set_cell(cr, "error", int64_t(p.error));
+            }
+            mutation_sink(std::move(m));
+        }
+    }
+};
+
 class db_config_table final : public streaming_virtual_table {
     db::config& _cfg;
 
@@ -1187,6 +1247,7 @@ future<> initialize_virtual_tables(
     co_await add_table(std::make_unique<protocol_servers_table>(ss));
     co_await add_table(std::make_unique<runtime_info_table>(dist_db, ss));
     co_await add_table(std::make_unique<versions_table>());
+    co_await add_table(std::make_unique<hot_partitions_table>(dist_db));
     co_await add_table(std::make_unique<db_config_table>(cfg));
     co_await add_table(std::make_unique<clients_table>(ss));
     co_await add_table(std::make_unique<raft_state_table>(dist_raft_gr));
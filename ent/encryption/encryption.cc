@@ -659,6 +659,7 @@ class encryption_file_io_extension : public sstables::file_io_extension {
                             sstables::component_type::Filter,
                             sstables::component_type::Statistics,
                             sstables::component_type::TemporaryStatistics,
+                            sstables::component_type::AttachedIndex,
             }) {
                 if (mask & (1 << int(c))) {
                     ccs.emplace_back(c);
@@ -703,6 +704,7 @@ class encryption_file_io_extension : public sstables::file_io_extension {
     future<file> wrap_file(const sstables::sstable& sst, sstables::component_type type, file f, open_flags flags) override {
         switch (type) {
         case sstables::component_type::Scylla:
+        case sstables::component_type::TemporaryScylla:
         case sstables::component_type::TemporaryTOC:
         case sstables::component_type::TOC:
             co_return file{};
@@ -813,6 +815,7 @@ class encryption_file_io_extension : public sstables::file_io_extension {
     future<data_sink> wrap_sink(const sstables::sstable& sst, sstables::component_type type, data_sink sink) override {
         switch (type) {
         case sstables::component_type::Scylla:
+        case sstables::component_type::TemporaryScylla:
         case sstables::component_type::TemporaryTOC:
         case sstables::component_type::TOC:
             co_return sink;
@@ -825,6 +828,7 @@ class encryption_file_io_extension : public sstables::file_io_extension {
         case sstables::component_type::Filter:
         case sstables::component_type::Statistics:
         case sstables::component_type::TemporaryStatistics:
+        case sstables::component_type::AttachedIndex:
         case sstables::component_type::Unknown:
             break;
         }
@@ -841,6 +845,7 @@ class encryption_file_io_extension : public sstables::file_io_extension {
                                                          uint64_t len) override {
         switch (type) {
         case sstables::component_type::Scylla:
+        case sstables::component_type::TemporaryScylla:
         case sstables::component_type::TemporaryTOC:
         case sstables::component_type::TOC:
             co_return data_source_creator(offset, len);
@@ -853,6 +858,7 @@ class encryption_file_io_extension : public sstables::file_io_extension {
         case sstables::component_type::Statistics:
         case sstables::component_type::Summary:
         case sstables::component_type::TemporaryStatistics:
+        case sstables::component_type::AttachedIndex:
         case sstables::component_type::Unknown:
             auto [id, esx] = get_encryption_schema_extension(sst, type);
             if (esx) {
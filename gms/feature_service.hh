@@ -170,6 +170,10 @@ class feature_service final : public peering_sharded_service<feature_service> {
     gms::feature lwt_with_tablets { *this, "LWT_WITH_TABLETS"sv };
     gms::feature repair_msg_split { *this, "REPAIR_MSG_SPLIT"sv };
     gms::feature view_building_coordinator { *this, "VIEW_BUILDING_COORDINATOR"sv };
+    gms::feature parallelized_group_by { *this, "PARALLELIZED_GROUP_BY"sv };
+    gms::feature replica_batched_reads { *this, "REPLICA_BATCHED_READS"sv };
+    gms::feature sstable_attached_index { *this, "SSTABLE_ATTACHED_INDEX"sv };
+    gms::feature row_cache_memory_bounds { *this, "ROW_CACHE_MEMORY_BOUNDS"sv };
 public:
 
     const std::unordered_map<sstring, std::reference_wrapper<feature>>& registered_features() const;
@@ -40,10 +40,12 @@ struct mapreduce_request {
 
     std::optional<std::vector<query::mapreduce_request::aggregation_info>> aggregation_infos [[version 5.1]];
     std::optional<shard_id> shard_id_hint [[version 2025.3]];
+    std::optional<std::vector<sstring>> group_by_column_names [[version 2026.1]];
 };
 
 struct mapreduce_result {
     std::vector<bytes_opt> query_results;
+    std::optional<std::vector<std::vector<bytes_opt>>> grouped_query_results [[version 2026.1]];
 };
 
 verb [[cancellable]] mapreduce_request(query::mapreduce_request req [[ref]], std::optional<tracing::trace_info> trace_info [[ref]]) -> query::mapreduce_result;
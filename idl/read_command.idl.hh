@@ -18,6 +18,11 @@ class cql_serialization_format final {
 
 namespace query {
 
+struct column_value_range {
+    uint32_t id;
+    interval<bytes> range;
+};
+
 class specific_ranges {
     partition_key pk();
     std::vector<interval<clustering_key_prefix>> ranges();
@@ -38,6 +43,7 @@ class partition_slice {
     cql_serialization_format cql_format();
     uint32_t partition_row_limit_low_bits() [[version 1.3]] = std::numeric_limits<uint32_t>::max();
     uint32_t partition_row_limit_high_bits() [[version 4.3]] = 0;
+    std::vector<query::column_value_range> value_ranges() [[version 2026.1]];
 };
 
 struct max_result_size {
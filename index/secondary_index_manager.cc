@@ -18,6 +18,7 @@
 #include "index/secondary_index_manager.hh"
 #include "index/secondary_index.hh"
 #include "index/vector_index.hh"
+#include "index/sstable_index.hh"
 
 #include "cql3/expr/expression.hh"
 #include "index/target_parser.hh"
@@ -42,7 +43,9 @@ bool index::depends_on(const column_definition& cdef) const {
 index::supports_expression_v index::supports_expression(const column_definition& cdef, const cql3::expr::oper_t op) const {
     using target_type = cql3::statements::index_target::target_type;
     auto collection_yes = supports_expression_v::from_bool_collection(true);
-    if (cdef.name_as_text() != _target_column) {
+    // SSTable-attached indexes have no view to read matching keys from; they
+    // only narrow down filtering scans, see statement_restrictions::uses_sstable_index().
+    if (cdef.name_as_text() != _target_column || sstable_index::is_sstable_index(_im)) {
         return supports_expression_v::from_bool(false);
     }
 
@@ -72,7 +75,7 @@ index::supports_expression_v index::supports_expression(const column_definition&
 
 index::supports_expression_v index::supports_subscript_expression(const column_definition& cdef, const cql3::expr::oper_t op) const {
     using target_type = cql3::statements::index_target::target_type;
-    if (cdef.name_as_text() != _target_column) {
+    if (cdef.name_as_text() != _target_column || sstable_index::is_sstable_index(_im)) {
         return supports_expression_v::from_bool(false);
     }
 
@@ -367,6 +370,7 @@ std::optional<std::function<std::unique_ptr<custom_index>()>> secondary_index_ma
 
     const static std::unordered_map<std::string_view, std::function<std::unique_ptr<custom_index>()>> classes = {
         {"vector_index", vector_index_factory},
+        {"sstable_index", sstable_index_factory},
     };
 
     if (auto class_it = classes.find(lower_class_name); class_it != classes.end()) {
@@ -0,0 +1,79 @@
+/*
+ * Copyright (C) 2026-present ScyllaDB
+ */
+
+/*
+ * SPDX-License-Identifier: LicenseRef-ScyllaDB-Source-Available-1.0
+ */
+
+#include "cql3/statements/index_target.hh"
+#include "cql3/util.hh"
+#include "exceptions/exceptions.hh"
+#include "gms/feature_service.hh"
+#include "schema/schema.hh"
+#include "index/sstable_index.hh"
+#include "index/secondary_index.hh"
+#include "utils/managed_string.hh"
+
+namespace secondary_index {
+
+bool sstable_index::view_should_exist() const {
+    return false;
+}
+
+std::optional<cql3::description> sstable_index::describe(const index_metadata& im, const schema& base_schema) const {
+    fragmented_ostringstream os;
+    os << "CREATE CUSTOM INDEX " << cql3::util::maybe_quote(im.name()) << " ON "
+       << cql3::util::maybe_quote(base_schema.ks_name()) << "." << cql3::util::maybe_quote(base_schema.cf_name())
+       << "(" << cql3::util::maybe_quote(im.options().at(cql3::statements::index_target::target_option_name)) << ")"
+       << " USING '" << class_name << "'";
+
+    return cql3::description{
+        .keyspace = base_schema.ks_name(),
+        .type = "index",
+        .name = im.name(),
+        .create_statement = std::move(os).to_managed_string(),
+    };
+}
+
+void sstable_index::validate(const schema &schema, cql3::statements::index_prop_defs &properties, const std::vector<::shared_ptr<cql3::statements::index_target>> &targets, const gms::feature_service& fs) {
+    if (!fs.sstable_attached_index) {
+        throw exceptions::invalid_request_exception("SSTable-attached indexes are not supported by all nodes in the cluster");
+    }
+    if (targets.size() != 1 || !std::holds_alternative<cql3::statements::index_target::single_column>(targets[0]->value)) {
+        throw exceptions::invalid_request_exception("SSTable-attached indexes can only be created on a single column");
+    }
+    auto target = targets[0];
+    auto c_def = schema.get_column_definition(to_bytes(target->column_name()));
+    if (!c_def) {
+        throw exceptions::invalid_request_exception(format("Column {} not found in schema", target->column_name()));
+    }
+    if (!c_def->is_regular()) {
+        throw exceptions::invalid_request_exception(format("SSTable-attached indexes are only supported on regular columns, {} is not one", target->column_name()));
+    }
+    // Durations have no total order to sort the index by.
+    if (!c_def->is_atomic() || c_def->is_counter() || c_def->type->references_duration()
+            || target->type != cql3::statements::index_target::target_type::regular_values) {
+        throw exceptions::invalid_request_exception(format("SSTable-attached indexes are not supported on column {} of type {}",
+                target->column_name(), c_def->type->as_cql3_type()));
+    }
+    if (!properties.get_raw_options().empty()) {
+        throw exceptions::invalid_request_exception("SSTable-attached indexes have no options");
+    }
+}
+
+/// Returns the schema version of the base table at which the index was created.
+table_schema_version sstable_index::index_version(const schema& schema) {
+    return schema.version();
+}
+
+bool sstable_index::is_sstable_index(const index_metadata& im) {
+    auto it = im.options().find(db::index::secondary_index::custom_class_option_name);
+    return it != im.options().end() && std::ranges::equal(it->second, class_name, [] (char a, char b) { return ::tolower(a) == b; });
+}
+
+std::unique_ptr<secondary_index::custom_index> sstable_index_factory() {
+    return std::make_unique<sstable_index>();
+}
+
+}
@@ -0,0 +1,44 @@
+/*
+ * Copyright (C) 2026-present ScyllaDB
+ */
+
+/*
+ * SPDX-License-Identifier: LicenseRef-ScyllaDB-Source-Available-1.0
+ */
+
+#pragma once
+
+#include "schema/schema.hh"
+
+#include "cql3/statements/index_target.hh"
+#include "index/secondary_index_manager.hh"
+
+#include <string_view>
+#include <vector>
+
+namespace secondary_index {
+
+/// An index stored in a component of each sstable of the base table instead
+/// of in a materialized view, see sstables/attached_index.hh. It is written
+/// along with the sstables, so it costs no view updates, and is only read by
+/// the replica it is on, to narrow down range scans filtering on the indexed
+/// column to the partitions which may match.
+///
+/// Sstables written before the index was created have no index until they
+/// are rewritten, e.g. by compaction or upgradesstables; scans of token
+/// ranges they cover read them in full in the meantime.
+class sstable_index: public custom_index {
+public:
+    static constexpr std::string_view class_name = "sstable_index";
+
+    sstable_index() = default;
+    ~sstable_index() override = default;
+    std::optional<cql3::description> describe(const index_metadata& im, const schema& base_schema) const override;
+    bool view_should_exist() const override;
+    void validate(const schema &schema, cql3::statements::index_prop_defs &properties, const std::vector<::shared_ptr<cql3::statements::index_target>> &targets, const gms::feature_service& fs) override;
+    table_schema_version index_version(const schema& schema) override;
+    static bool is_sstable_index(const index_metadata& im);
+};
+
+std::unique_ptr<secondary_index::custom_index> sstable_index_factory();
+}
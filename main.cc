@@ -838,6 +838,7 @@ sharded<locator::shared_token_metadata> token_metadata;
             // See the comment at the definition of sstables::global_cache_index_pages.
             smp::invoke_on_all([&cfg] {
                 sstables::global_cache_index_pages = cfg->cache_index_pages.operator utils::updateable_value<bool>();
+                sstables::global_cache_data_chunks = cfg->cache_data_chunks.operator utils::updateable_value<bool>();
             }).get();
 
             ::sighup_handler sighup_handler(opts, *cfg);
@@ -845,6 +846,9 @@ sharded<locator::shared_token_metadata> token_metadata;
                 sighup_handler.stop().get();
             });
 
+            if (cfg->lsa_huge_page_segments()) {
+                logalloc::use_huge_page_segment_pool_backend().get();
+            }
             logalloc::prime_segment_pool(memory::stats().total_memory(), memory::min_free_memory()).get();
             logging::apply_settings(cfg->logging_settings(app.options().log_opts));
 
@@ -1199,6 +1203,7 @@ sharded<locator::shared_token_metadata> token_metadata;
                     .available_memory = dbcfg.available_memory,
                     .static_shares = cfg->compaction_static_shares,
                     .throughput_mb_per_sec = cfg->compaction_throughput_mb_per_sec,
+                    .sub_range_parallelism = cfg->compaction_sub_range_parallelism,
                     .flush_all_tables_before_major = cfg->compaction_flush_all_tables_before_major_seconds() * 1s,
                 };
             });
@@ -2374,6 +2379,9 @@ sharded<locator::shared_token_metadata> token_metadata;
             );
             cf_cache_hitrate_calculator.local().run_on(this_shard_id());
 
+            checkpoint(stop_signal, "starting row cache warm-up");
+            replica::database::start_row_cache_warmup_on_all_shards(db);
+
             checkpoint(stop_signal, "starting view update backlog broker");
             static sharded<service::view_update_backlog_broker> view_backlog_broker;
             view_backlog_broker.start(std::ref(proxy), std::ref(gossiper)).get();
@@ -723,6 +723,8 @@ static constexpr unsigned do_get_rpc_client_idx(messaging_verb verb) {
     case messaging_verb::READ_DATA:
     case messaging_verb::READ_MUTATION_DATA:
     case messaging_verb::READ_DIGEST:
+    case messaging_verb::READ_DATA_BATCH:
+    case messaging_verb::READ_DIGEST_BATCH:
     case messaging_verb::DEFINITIONS_UPDATE:
     case messaging_verb::TRUNCATE:
     case messaging_verb::TRUNCATE_WITH_TABLETS:
@@ -210,7 +210,9 @@ enum class messaging_verb : int32_t {
     REPAIR_UPDATE_COMPACTION_CTRL = 81,
     REPAIR_UPDATE_REPAIRED_AT_FOR_MERGE = 82,
     WORK_ON_VIEW_BUILDING_TASKS = 83,
-    LAST = 84,
+    READ_DATA_BATCH = 84,
+    READ_DIGEST_BATCH = 85,
+    LAST = 86,
 };
 
 } // namespace netw
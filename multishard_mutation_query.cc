@@ -822,6 +822,87 @@ future<foreign_ptr<lw_shared_ptr<typename ResultBuilder::result_type>>> do_query
     co_return result_builder.merge(std::move(results));
 }
 
+// Scans narrowed down to more partitions than this read the ranges instead.
+static constexpr size_t max_sstable_index_candidates = 1000;
+
+static future<std::optional<utils::chunked_vector<dht::token>>> find_sstable_index_candidates_on_shard(
+        replica::database& db,
+        schema_ptr s,
+        column_id id,
+        const interval<bytes>& values,
+        const dht::partition_range_vector& ranges,
+        tracing::trace_state_ptr trace_state,
+        db::timeout_clock::time_point timeout) {
+    auto& table = db.find_column_family(s);
+    auto permit = co_await db.obtain_reader_permit(table, "sstable-index-lookup", timeout, std::move(trace_state));
+    const auto& cdef = s->regular_column_at(id);
+    utils::chunked_vector<dht::token> tokens;
+    for (const auto& range : ranges) {
+        auto found = co_await table.find_sstable_index_candidates(s, permit, cdef, values, range, max_sstable_index_candidates - tokens.size());
+        if (!found) {
+            co_return std::nullopt;
+        }
+        std::ranges::move(*found, std::back_inserter(tokens));
+    }
+    co_return tokens;
+}
+
+// Narrows down the ranges of a scan filtering on a column with an
+// sstable-attached index to the partitions the index finds on all shards, see
+// secondary_index::sstable_index. Disengaged if the index can't be used.
+static future<std::optional<dht::partition_range_vector>> narrow_ranges_by_sstable_index(
+        distributed<replica::database>& db,
+        schema_ptr s,
+        const query::read_command& cmd,
+        const dht::partition_range_vector& ranges,
+        tracing::trace_state_ptr trace_state,
+        db::timeout_clock::time_point timeout) {
+    const auto& value_ranges = cmd.slice.value_ranges();
+    if (value_ranges.empty() || ranges.empty()) {
+        co_return std::nullopt;
+    }
+    const auto indexed_columns = s->sstable_indexed_columns();
+    auto value_range = std::ranges::find_if(value_ranges, [&] (const query::column_value_range& r) {
+        return std::ranges::contains(indexed_columns, r.id, &column_definition::id);
+    });
+    if (value_range == value_ranges.end()) {
+        co_return std::nullopt;
+    }
+
+    using tokens_opt = std::optional<utils::chunked_vector<dht::token>>;
+    auto tokens = co_await db.map_reduce0(
+            [&, gs = global_schema_ptr(s), gts = tracing::global_trace_state_ptr(trace_state)] (replica::database& db) {
+        return find_sstable_index_candidates_on_shard(db, gs.get(), value_range->id, value_range->range, ranges, gts.get(), timeout);
+    }, tokens_opt(utils::chunked_vector<dht::token>()), [] (tokens_opt acc, tokens_opt shard_tokens) -> tokens_opt {
+        if (!acc || !shard_tokens || acc->size() + shard_tokens->size() > max_sstable_index_candidates) {
+            return std::nullopt;
+        }
+        std::ranges::move(*shard_tokens, std::back_inserter(*acc));
+        return acc;
+    });
+    if (!tokens) {
+        co_return std::nullopt;
+    }
+
+    std::ranges::sort(*tokens);
+    const auto cmp = dht::ring_position_comparator(*s);
+    dht::partition_range_vector narrowed;
+    for (const auto& range : ranges) {
+        std::optional<dht::token> prev;
+        for (const auto& t : *tokens) {
+            if (t == prev) {
+                continue;
+            }
+            prev = t;
+            auto token_range = dht::partition_range::make(dht::ring_position::starting_at(t), dht::ring_position::ending_at(t));
+            if (auto r = range.intersection(token_range, cmp)) {
+                narrowed.push_back(std::move(*r));
+            }
+        }
+    }
+    co_return narrowed;
+}
+
 template <typename ResultBuilder>
 static future<std::tuple<foreign_ptr<lw_shared_ptr<typename ResultBuilder::result_type>>, cache_temperature>> do_query_on_all_shards(
         distributed<replica::database>& db,
@@ -845,9 +926,26 @@ static future<std::tuple<foreign_ptr<lw_shared_ptr<typename ResultBuilder::resul
     auto query_method = keyspace.get_replication_strategy().uses_tablets() ? do_query_tablets<ResultBuilder> : do_query_vnodes<ResultBuilder>;
 
     try {
+        // The narrowed ranges depend on the data at the time of each page, so
+        // readers can't be saved for the next one.
+        std::optional<query::read_command> narrowed_cmd;
+        auto narrowed_ranges = co_await narrow_ranges_by_sstable_index(db, s, cmd, ranges, trace_state, timeout);
+        if (narrowed_ranges) {
+            ++local_db.find_column_family(s).cf_stats()->range_scans_narrowed_by_sstable_index;
+            if (narrowed_ranges->empty()) {
+                ++stats.total_reads;
+                co_return std::tuple(
+                        make_foreign(make_lw_shared<typename ResultBuilder::result_type>()),
+                        local_db.find_column_family(s).get_global_cache_hit_rate());
+            }
+            narrowed_cmd.emplace(cmd);
+            narrowed_cmd->query_uuid = query_id::create_null_id();
+        }
+
         auto accounter = co_await local_db.get_result_memory_limiter().new_mutation_read(*cmd.max_result_size, short_read_allowed);
 
-        auto result = co_await query_method(db, s, cmd, ranges, std::move(trace_state), timeout,
+        auto result = co_await query_method(db, s, narrowed_cmd ? *narrowed_cmd : cmd, narrowed_ranges ? *narrowed_ranges : ranges,
+                std::move(trace_state), timeout,
                 [result_builder_factory, accounter = std::move(accounter)] () mutable {
 			return result_builder_factory(std::move(accounter));
 		});
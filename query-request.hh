@@ -147,6 +147,17 @@ class specific_ranges {
     clustering_row_ranges _ranges;
 };
 
+// The values a regular column of the rows selected by a filtering query must
+// fall into. It is a hint only: replicas may use it to skip sstables which
+// cannot contribute to such rows (see sstables/column_zone_maps.hh), but the
+// rows are still filtered by the coordinator.
+struct column_value_range {
+    column_id id;
+    interval<bytes> range;
+};
+
+using column_value_ranges = std::vector<column_value_range>;
+
 constexpr auto max_rows = std::numeric_limits<uint64_t>::max();
 constexpr auto partition_max_rows = std::numeric_limits<uint64_t>::max();
 constexpr auto max_rows_if_set = std::numeric_limits<uint32_t>::max();
@@ -182,6 +193,11 @@ class partition_slice {
         // is a lot of dead rows. This flag is needed during rolling upgrades to support
         // old coordinators which do not tolerate pages with no live rows.
         allow_mutation_read_page_without_live_row,
+        // Set by replicas on data queries bypassing the cache, which only return
+        // the selected columns: the values of other columns aren't read from
+        // sstables. Never set on mutation queries, whose results must be complete
+        // to reconcile replicas, and never sent between nodes.
+        skip_unselected_column_values,
     };
     using option_set = enum_set<super_enum<option,
         option::send_clustering_key,
@@ -197,7 +213,8 @@ class partition_slice {
         option::bypass_cache,
         option::always_return_static_content,
         option::range_scan_data_variant,
-        option::allow_mutation_read_page_without_live_row>>;
+        option::allow_mutation_read_page_without_live_row,
+        option::skip_unselected_column_values>>;
     clustering_row_ranges _row_ranges;
 public:
     column_id_vector static_columns; // TODO: consider using bitmap
@@ -207,13 +224,15 @@ class partition_slice {
     std::unique_ptr<specific_ranges> _specific_ranges;
     uint32_t _partition_row_limit_low_bits;
     uint32_t _partition_row_limit_high_bits;
+    column_value_ranges _value_ranges;
 public:
     partition_slice(clustering_row_ranges row_ranges, column_id_vector static_columns,
         column_id_vector regular_columns, option_set options,
         std::unique_ptr<specific_ranges> specific_ranges,
         cql_serialization_format,
         uint32_t partition_row_limit_low_bits,
-        uint32_t partition_row_limit_high_bits);
+        uint32_t partition_row_limit_high_bits,
+        column_value_ranges value_ranges = {});
     partition_slice(clustering_row_ranges row_ranges, column_id_vector static_columns,
         column_id_vector regular_columns, option_set options,
         std::unique_ptr<specific_ranges> specific_ranges = nullptr,
@@ -256,6 +275,12 @@ class partition_slice {
         _partition_row_limit_low_bits = static_cast<uint64_t>(limit);
         _partition_row_limit_high_bits = static_cast<uint64_t>(limit >> 32);
     }
+    const column_value_ranges& value_ranges() const {
+        return _value_ranges;
+    }
+    void set_value_ranges(column_value_ranges ranges) {
+        _value_ranges = std::move(ranges);
+    }
 
     [[nodiscard]]
     bool is_reversed() const {
@@ -500,6 +525,9 @@ struct mapreduce_request {
     lowres_system_clock::time_point timeout;
     std::optional<std::vector<aggregation_info>> aggregation_infos;
     std::optional<shard_id> shard_id_hint;
+    // When set, rows are grouped by these columns (the partition key) and a
+    // partial result is produced for each group.
+    std::optional<std::vector<sstring>> group_by_column_names;
 };
 
 std::ostream& operator<<(std::ostream& out, const mapreduce_request& r);
@@ -509,6 +537,14 @@ std::ostream& operator<<(std::ostream& out, const mapreduce_request::aggregation
 struct mapreduce_result {
     // vector storing query result for each selected column
     std::vector<bytes_opt> query_results;
+    // Set for requests with group_by_column_names: a row for each group,
+    // holding the values of the group by columns followed by the query
+    // results of the group.
+    std::optional<std::vector<std::vector<bytes_opt>>> grouped_query_results;
+
+    bool empty() const {
+        return query_results.empty() && !grouped_query_results;
+    }
 
     struct printer {
         const std::vector<::shared_ptr<db::functions::aggregate_function>> functions;
@@ -49,6 +49,9 @@ std::ostream& operator<<(std::ostream& out, const partition_slice& ps) {
     if (ps._specific_ranges) {
         fmt::print(out, ", specific=[{}]", *ps._specific_ranges);
     }
+    for (const auto& r : ps._value_ranges) {
+        fmt::print(out, ", value_range[{}]={}", r.id, r.range);
+    }
     // FIXME: pretty print options
     fmt::print(out, ", options={:x}, , partition_row_limit={}}}",
                ps.options.mask(), ps.partition_row_limit());
@@ -100,6 +103,9 @@ std::ostream& operator<<(std::ostream& out, const mapreduce_request& r) {
     if (r.shard_id_hint) {
         fmt::print(out, ", shard_id_hint={}", r.shard_id_hint.value());
     }
+    if (r.group_by_column_names) {
+        fmt::print(out, ", group_by=[{}]", fmt::join(r.group_by_column_names.value(), ","));
+    }
     fmt::print(out, ", cmd={}, pr={}, cl={}, timeout(ms)={}}}",
                r.cmd, r.pr, r.cl, ms);
     return out;
@@ -181,7 +187,8 @@ partition_slice::partition_slice(clustering_row_ranges row_ranges,
     std::unique_ptr<specific_ranges> specific_ranges,
     cql_serialization_format cql_format,
     uint32_t partition_row_limit_low_bits,
-    uint32_t partition_row_limit_high_bits)
+    uint32_t partition_row_limit_high_bits,
+    column_value_ranges value_ranges)
     : _row_ranges(std::move(row_ranges))
     , static_columns(std::move(static_columns))
     , regular_columns(std::move(regular_columns))
@@ -189,6 +196,7 @@ partition_slice::partition_slice(clustering_row_ranges row_ranges,
     , _specific_ranges(std::move(specific_ranges))
     , _partition_row_limit_low_bits(partition_row_limit_low_bits)
     , _partition_row_limit_high_bits(partition_row_limit_high_bits)
+    , _value_ranges(std::move(value_ranges))
 {
     cql_format.ensure_supported();
 }
@@ -232,6 +240,7 @@ partition_slice::partition_slice(const partition_slice& s)
     , _specific_ranges(s._specific_ranges ? std::make_unique<specific_ranges>(*s._specific_ranges) : nullptr)
     , _partition_row_limit_low_bits(s._partition_row_limit_low_bits)
     , _partition_row_limit_high_bits(s._partition_row_limit_high_bits)
+    , _value_ranges(s._value_ranges)
 {}
 
 partition_slice::~partition_slice()
@@ -395,6 +404,9 @@ foreign_ptr<lw_shared_ptr<query::result>> result_merger::get() {
 }
 
 std::ostream& operator<<(std::ostream& out, const query::mapreduce_result::printer& p) {
+    if (p.res.grouped_query_results) {
+        return out << "[" << p.res.grouped_query_results->size() << " groups]";
+    }
     if (p.functions.size() != p.res.query_results.size()) {
         return out << "[malformed mapreduce_result (" << p.res.query_results.size()
             << " results, " << p.functions.size() << " aggregates)]";
@@ -1089,6 +1089,14 @@ reader_concurrency_semaphore::reader_concurrency_semaphore(
                                sm::description("Holds the number of currently read sstables. "),
                                {class_label(_name)}),
 
+                sm::make_counter("disk_read_requests", _stats.total_disk_read_requests,
+                               sm::description("Counts the disk read requests issued by reads on this shard."),
+                               {class_label(_name)}),
+
+                sm::make_counter("disk_read_latency", _stats.total_disk_read_latency_us,
+                               sm::description("Counts the total time, in microseconds, reads on this shard waited for their disk read requests."),
+                               {class_label(_name)}),
+
                 sm::make_counter("total_reads", _stats.total_successful_reads,
                                sm::description("Counts the total number of successful user reads on this shard."),
                                {class_label(_name)}),
@@ -1765,7 +1773,11 @@ class tracking_file_impl : public file_impl {
 
     virtual future<temporary_buffer<uint8_t>> dma_read_bulk(uint64_t offset, size_t range_size, io_intent* intent) override {
         return _permit.request_memory(range_size).then([this, offset, range_size, intent] (reader_permit::resource_units units) {
-            return get_file_impl(_tracked_file)->dma_read_bulk(offset, range_size, intent).then([units = std::move(units)] (temporary_buffer<uint8_t> buf) mutable {
+            auto& stats = _permit.semaphore().get_stats();
+            auto start = std::chrono::steady_clock::now();
+            return get_file_impl(_tracked_file)->dma_read_bulk(offset, range_size, intent).then([&stats, start, units = std::move(units)] (temporary_buffer<uint8_t> buf) mutable {
+                ++stats.total_disk_read_requests;
+                stats.total_disk_read_latency_us += std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
                 return make_ready_future<temporary_buffer<uint8_t>>(make_tracked_temporary_buffer(std::move(buf), std::move(units)));
             });
         });
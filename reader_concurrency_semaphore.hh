@@ -124,6 +124,10 @@ class reader_concurrency_semaphore {
         uint64_t sstables_read = 0;
         // Permits waiting on something: admission, memory or execution
         uint64_t waiters = 0;
+        // Total number of I/O requests issued through tracked files.
+        uint64_t total_disk_read_requests = 0;
+        // Total time spent waiting for the I/O requests issued through tracked files, in microseconds.
+        uint64_t total_disk_read_latency_us = 0;
 
         friend auto operator<=>(const stats&, const stats&) = default;
     };
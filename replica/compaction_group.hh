@@ -216,6 +216,7 @@ class compaction_group {
     void trigger_compaction();
     bool compaction_disabled() const;
     future<unsigned> estimate_pending_compactions() const;
+    uint64_t read_amplification_score() const;
 
     compaction_backlog_tracker& get_backlog_tracker();
     void register_backlog_tracker(compaction_backlog_tracker new_backlog_tracker);
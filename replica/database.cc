@@ -29,6 +29,7 @@
 #include "db/commitlog/commitlog.hh"
 #include "db/config.hh"
 #include "db/extensions.hh"
+#include "db/row_cache_warmup.hh"
 #include "cql3/functions/functions.hh"
 #include "cql3/functions/user_function.hh"
 #include "cql3/functions/user_aggregate.hh"
@@ -63,6 +64,7 @@
 #include "db/large_data_handler.hh"
 #include "db/corrupt_data_handler.hh"
 #include "db/data_listeners.hh"
+#include "db/hot_partitions.hh"
 
 #include "data_dictionary/user_types_metadata.hh"
 #include <seastar/core/shared_ptr_incomplete.hh>
@@ -384,6 +386,26 @@ database::database(const db::config& cfg, database_config dbcfg, service::migrat
         }
         return backlog;
     }))
+    , _io_bandwidth_controller(
+            io_bandwidth_controller::config{
+                .target_latency_us = [&cfg] { return cfg.background_io_read_latency_target_us(); },
+                .min_bandwidth_mbs = [&cfg] { return cfg.background_io_min_throughput_mb_per_sec(); },
+                .max_bandwidth_mbs = [&cfg] { return cfg.background_io_max_throughput_mb_per_sec(); },
+            },
+            {
+                {dbcfg.compaction_scheduling_group, [&cfg] { return cfg.compaction_throughput_mb_per_sec(); }},
+                {dbcfg.streaming_scheduling_group, [&cfg] { return cfg.stream_io_throughput_mb_per_sec(); }},
+            },
+            [this] {
+                return container().map_reduce0([] (database& db) {
+                    return io_bandwidth_controller::read_latency_sample{
+                        .requests = db.sum_read_concurrency_sem_stat(&reader_concurrency_semaphore::stats::total_disk_read_requests),
+                        .latency_us = db.sum_read_concurrency_sem_stat(&reader_concurrency_semaphore::stats::total_disk_read_latency_us),
+                    };
+                }, io_bandwidth_controller::read_latency_sample{}, [] (io_bandwidth_controller::read_latency_sample a, io_bandwidth_controller::read_latency_sample b) {
+                    return io_bandwidth_controller::read_latency_sample{a.requests + b.requests, a.latency_us + b.latency_us};
+                });
+            })
     // No timeouts or queue length limits - a failure here can kill an entire repair.
     // Trust the caller to limit concurrency.
     , _streaming_concurrency_sem(
@@ -435,6 +457,7 @@ database::database(const db::config& cfg, database_config dbcfg, service::migrat
     , _system_sstables_manager(std::make_unique<sstables::sstables_manager>("system", *_nop_large_data_handler, *_nop_corrupt_data_handler, _cfg, feat, _row_cache_tracker, dbcfg.available_memory, sst_dir_sem, [&stm]{ return stm.get()->get_my_id(); }, scf, abort, dbcfg.streaming_scheduling_group))
     , _result_memory_limiter(dbcfg.available_memory / 10)
     , _data_listeners(std::make_unique<db::data_listeners>())
+    , _hot_partitions(std::make_unique<db::hot_partitions_tracker>(*_data_listeners, _cfg.hot_partitions_sample_rate))
     , _mnotifier(mn)
     , _feat(feat)
     , _shared_token_metadata(stm)
@@ -453,6 +476,8 @@ database::database(const db::config& cfg, database_config dbcfg, service::migrat
     setup_metrics();
 
     _row_cache_tracker.set_compaction_scheduling_group(dbcfg.memory_compaction_scheduling_group);
+    _row_cache_tracker.set_scan_admission_threshold(_cfg.cache_scan_admission_threshold);
+    _row_cache_tracker.set_compressed_tier_fraction(_cfg.cache_compressed_tier_fraction);
 
     setup_scylla_memory_diagnostics_producer();
     if (_dbcfg.sstables_format) {
@@ -531,6 +556,108 @@ void backlog_controller::update_controller(float shares) {
     _scheduling_group.set_shares(shares);
 }
 
+io_bandwidth_controller::io_bandwidth_controller(config cfg, std::vector<controlled_group> groups,
+        std::function<future<read_latency_sample>()> sample, std::chrono::milliseconds interval)
+    : _cfg(std::move(cfg))
+    , _groups(std::move(groups))
+    , _sample(std::move(sample))
+    , _bandwidth_mbs(_cfg.max_bandwidth_mbs())
+    , _interval(interval)
+    , _update_timer([this] { adjust(); })
+    , _inflight_update(make_ready_future<>())
+{}
+
+void io_bandwidth_controller::start() {
+    setup_metrics();
+    _update_timer.arm_periodic(_interval);
+}
+
+uint32_t io_bandwidth_controller::next_bandwidth(uint32_t bandwidth_mbs, std::optional<uint64_t> avg_latency_us,
+        uint32_t target_latency_us, uint32_t min_bandwidth_mbs, uint32_t max_bandwidth_mbs) {
+    max_bandwidth_mbs = std::max(max_bandwidth_mbs, min_bandwidth_mbs);
+    if (avg_latency_us && *avg_latency_us > target_latency_us) {
+        bandwidth_mbs = static_cast<uint32_t>(bandwidth_mbs * decrease_factor);
+    } else if (!avg_latency_us || *avg_latency_us < target_latency_us * increase_threshold) {
+        bandwidth_mbs += std::max(max_bandwidth_mbs / increase_steps, 1u);
+    }
+    return std::clamp(bandwidth_mbs, min_bandwidth_mbs, max_bandwidth_mbs);
+}
+
+void io_bandwidth_controller::adjust() {
+    if (!_inflight_update.available()) {
+        // The previous adjustment is still being applied, skip this one.
+        return;
+    }
+    auto target = _cfg.target_latency_us();
+    if (!target) {
+        if (_enabled) {
+            dblog.info("I/O bandwidth controller disabled, restoring static background bandwidth limits");
+            _enabled = false;
+            _inflight_update = update_groups(false).handle_exception([] (std::exception_ptr ep) {
+                dblog.warn("Couldn't restore background I/O bandwidth: {}", ep);
+            });
+        }
+        return;
+    }
+    _inflight_update = _sample().then([this, target] (read_latency_sample sample) {
+        if (!_enabled) {
+            // The reads done while the controller was disabled don't count.
+            _last_sample = sample;
+        }
+        auto requests = sample.requests - _last_sample.requests;
+        auto latency_us = sample.latency_us - _last_sample.latency_us;
+        _last_sample = sample;
+
+        std::optional<uint64_t> avg_latency_us;
+        if (requests) {
+            avg_latency_us = latency_us / requests;
+        }
+        _stats.avg_latency_us = avg_latency_us.value_or(0);
+
+        auto bandwidth = _enabled ? _bandwidth_mbs : _cfg.max_bandwidth_mbs();
+        auto next = next_bandwidth(bandwidth, avg_latency_us, target, _cfg.min_bandwidth_mbs(), _cfg.max_bandwidth_mbs());
+        if (next < _bandwidth_mbs) {
+            ++_stats.decreases;
+        } else if (next > _bandwidth_mbs) {
+            ++_stats.increases;
+        }
+        _bandwidth_mbs = next;
+        _enabled = true;
+        return update_groups(true);
+    }).handle_exception([] (std::exception_ptr ep) {
+        dblog.warn("Couldn't adjust background I/O bandwidth: {}", ep);
+    });
+}
+
+future<> io_bandwidth_controller::update_groups(bool enabled) {
+    for (auto& g : _groups) {
+        auto bandwidth = g.static_bandwidth_mbs();
+        if (enabled && (!bandwidth || bandwidth > _bandwidth_mbs)) {
+            bandwidth = _bandwidth_mbs;
+        }
+        uint64_t bps = ((uint64_t)(bandwidth != 0 ? bandwidth : std::numeric_limits<uint32_t>::max())) << 20;
+        co_await smp::invoke_on_all([sg = g.sg, bps] {
+            return sg.update_io_bandwidth(bps);
+        });
+    }
+}
+
+void io_bandwidth_controller::setup_metrics() {
+    namespace sm = seastar::metrics;
+    _metrics.add_group("io_bandwidth_controller", {
+        sm::make_gauge("bandwidth", [this] { return _enabled ? _bandwidth_mbs : 0; },
+                       sm::description("Holds the I/O bandwidth, in MB/s, the controller gives to background processes. 0 means the controller is disabled.")),
+        sm::make_gauge("read_latency", [this] { return _stats.avg_latency_us; },
+                       sm::description("Holds the average latency, in microseconds, of foreground disk reads during the last interval.")),
+        sm::make_gauge("target_read_latency", [this] { return _cfg.target_latency_us(); },
+                       sm::description("Holds the target average latency, in microseconds, of foreground disk reads.")),
+        sm::make_counter("increases", _stats.increases,
+                       sm::description("Counts the times the controller increased the background I/O bandwidth.")),
+        sm::make_counter("decreases", _stats.decreases,
+                       sm::description("Counts the times the controller decreased the background I/O bandwidth.")),
+    });
+}
+
 
 namespace replica {
 
@@ -596,6 +723,17 @@ database::setup_metrics() {
                        sm::description("Counts sstables that survived the clustering key filtering. "
                                        "High value indicates that bloom filter is not very efficient and still have to access a lot of sstables to get data.")),
 
+        sm::make_counter("clustering_prefix_filter_skipped_sstables", _cf_stats.sstables_skipped_by_clustering_prefix_filter,
+                       sm::description("Counts sstables skipped by their per-partition clustering filters, which sstables of tables "
+                                       "with clustering_filter_bucket_width set have.")),
+
+        sm::make_counter("column_zone_map_skipped_sstables", _cf_stats.sstables_skipped_by_column_zone_maps,
+                       sm::description("Counts sstables skipped by filtering reads because their column zone maps, which sstables of tables "
+                                       "with column_zone_maps enabled have, show they have no matching rows.")),
+
+        sm::make_counter("sstable_index_narrowed_range_scans", _cf_stats.range_scans_narrowed_by_sstable_index,
+                       sm::description("Counts filtering range scans which only read the partitions found by sstable-attached indexes.")),
+
         sm::make_counter("dropped_view_updates", _cf_stats.dropped_view_updates,
                        sm::description("Counts the number of view updates that have been dropped due to cluster overload. "))(basic_level),
 
@@ -1080,7 +1218,9 @@ void database::add_column_family(keyspace& ks, schema_ptr schema, column_family:
     }
     // avoid self-reporting
     auto& sst_manager = get_sstables_manager(*schema);
-    auto cf = make_lw_shared<column_family>(schema, std::move(cfg), ks.metadata()->get_storage_options_ptr(), _compaction_manager, sst_manager, *_cl_stats, _row_cache_tracker, erm);
+    cfg.dedicated_row_cache_tracker = row_cache_tracker_for(*schema);
+    auto& row_cache_tracker = cfg.dedicated_row_cache_tracker ? *cfg.dedicated_row_cache_tracker : _row_cache_tracker;
+    auto cf = make_lw_shared<column_family>(schema, std::move(cfg), ks.metadata()->get_storage_options_ptr(), _compaction_manager, sst_manager, *_cl_stats, row_cache_tracker, erm);
     cf->set_durable_writes(ks.metadata()->durable_writes());
 
     if (is_new) {
@@ -1125,11 +1265,68 @@ future<> database::add_column_family_and_make_directory(schema_ptr schema, is_ne
     co_await make_column_family_directory(schema);
 }
 
+lw_shared_ptr<cache_tracker> database::row_cache_tracker_for(const schema& s) {
+    auto& co = s.caching_options();
+    if (!co.has_memory_bounds()) {
+        return nullptr;
+    }
+    auto& entry = _dedicated_row_cache_trackers[s.id()];
+    if (!entry.tracker) {
+        // The shared tracker owns the "cache" metrics, so the dedicated one registers its own, per table.
+        entry.tracker = make_lw_shared<cache_tracker>(_cfg.index_cache_fraction.operator utils::updateable_value<double>(), cache_tracker::register_metrics::no);
+        entry.tracker->set_compaction_scheduling_group(_dbcfg.memory_compaction_scheduling_group);
+        entry.tracker->set_scan_admission_threshold(_cfg.cache_scan_admission_threshold);
+        entry.tracker->setup_table_metrics(s.ks_name(), s.cf_name());
+    }
+    update_row_cache_memory_bounds(entry, co);
+    return entry.tracker;
+}
+
+void database::update_row_cache_memory_bounds(dedicated_row_cache_tracker& entry, const caching_options& co) {
+    entry.requested_reservation = co.memory_reservation();
+    entry.limit = co.memory_limit();
+    if (co.in_memory()) {
+        // Pin everything up to the limit. Without a limit, pin as much as the
+        // reservation budget allows; above it the table is evicted on memory
+        // pressure like any other.
+        entry.requested_reservation = entry.limit ? entry.limit : std::numeric_limits<size_t>::max();
+    }
+    apply_row_cache_memory_bounds();
+}
+
+void database::apply_row_cache_memory_bounds() {
+    // Reserved memory is taken away from all other tables, so the sum of
+    // reservations is capped. Tables are served in a fixed order, so the same
+    // tables keep their reservation when the budget runs out.
+    size_t budget = _dbcfg.available_memory * _cfg.in_memory_row_cache_fraction();
+    for (auto& [id, entry] : _dedicated_row_cache_trackers) {
+        auto reservation = std::min(entry.requested_reservation, budget);
+        if (reservation < entry.requested_reservation && entry.requested_reservation != std::numeric_limits<size_t>::max()) {
+            dblog.warn("Row cache memory reservation of table {} capped to {} bytes out of the {} requested, in_memory_row_cache_fraction of memory is reserved already",
+                    id, reservation, entry.requested_reservation);
+        }
+        budget -= reservation;
+        entry.tracker->set_memory_bounds(reservation, entry.limit);
+    }
+}
+
+void database::release_row_cache_tracker(table_id id) {
+    // The table keeps the tracker alive until its cache is destroyed.
+    if (_dedicated_row_cache_trackers.erase(id)) {
+        apply_row_cache_memory_bounds();
+    }
+}
+
 bool database::update_column_family(schema_ptr new_schema) {
     column_family& cfm = find_column_family(new_schema->id());
     bool columns_changed = !cfm.schema()->equal_columns(*new_schema);
     auto s = local_schema_registry().learn(new_schema);
     s->registry_entry()->mark_synced();
+    if (auto it = _dedicated_row_cache_trackers.find(s->id()); it != _dedicated_row_cache_trackers.end()) {
+        update_row_cache_memory_bounds(it->second, s->caching_options());
+    } else if (s->caching_options().has_memory_bounds()) {
+        dblog.info("Row cache memory options of {}.{} will take effect after restart", s->ks_name(), s->cf_name());
+    }
     cfm.set_schema(s);
     find_keyspace(s->ks_name()).metadata()->add_or_update_column_family(s);
     if (s->is_view()) {
@@ -1250,6 +1447,9 @@ future<> database::cleanup_drop_table_on_all_shards(sharded<database>& sharded_d
     co_await smp::invoke_on_all([&] {
         return table_shards->stop();
     });
+    co_await sharded_db.invoke_on_all([&] (database& db) {
+        db.release_row_cache_tracker(table_shards->schema()->id());
+    });
     f.get(); // re-throw exception from truncate() if any
     co_await sys_ks.local().remove_truncation_records(table_shards->schema()->id());
     co_await table_shards->destroy_storage();
@@ -2477,6 +2677,10 @@ future<> database::start(sharded<qos::service_level_controller>& sl_controller,
         on_internal_error(dblog, "The default service_level should always contain shares value");
     }
 
+    if (this_shard_id() == 0) {
+        _io_bandwidth_controller.start();
+    }
+
     if (dsm && (this_shard_id() == 0)) {
         _out_of_space_subscription = dsm->subscribe(_cfg.critical_disk_utilization_level, [this] (auto threshold_reached) {
         return set_in_critical_disk_utilization_mode(container(), bool(threshold_reached));
@@ -2531,6 +2735,7 @@ future<> database::start(sharded<qos::service_level_controller>& sl_controller,
 
 future<> database::shutdown() {
     _shutdown = true;
+    co_await stop_row_cache_warmup();
     auto b = defer([this] { _stop_barrier.abort(); });
     co_await _stop_barrier.arrive_and_wait();
     b.cancel();
@@ -2585,6 +2790,8 @@ future<> database::stop() {
     co_await _dirty_memory_manager.shutdown();
     dblog.info("Shutting down memtable controller");
     co_await _memtable_controller.shutdown();
+    dblog.info("Shutting down I/O bandwidth controller");
+    co_await _io_bandwidth_controller.shutdown();
     dblog.info("Stopping querier cache");
     co_await _querier_cache.stop();
     dblog.info("Closing user sstables manager");
@@ -3098,7 +3305,59 @@ future<> database::flush_system_column_families() {
     });
 }
 
+void database::start_row_cache_warmup_on_all_shards(sharded<database>& sharded_db) {
+    auto& local_db = sharded_db.local();
+    if (!local_db._cfg.row_cache_keys_to_save()) {
+        return;
+    }
+    local_db._row_cache_warmup = sharded_db.invoke_on_all([] (database& db) {
+        // Stopped before the warm-up reached this shard.
+        if (db._row_cache_warmup_as.abort_requested()) {
+            return;
+        }
+        db._row_cache_warmup_load.emplace(with_scheduling_group(db._dbcfg.streaming_scheduling_group, [&db] {
+            return db::row_cache_warmup::load(db, db._row_cache_warmup_as);
+        }));
+    }).then([&sharded_db] {
+        return sharded_db.map_reduce0([] (database& db) {
+            if (!db._row_cache_warmup_load) {
+                return make_ready_future<bool>(true);
+            }
+            return db._row_cache_warmup_load->get_future().then([&db] {
+                return db._row_cache_warmup_as.abort_requested();
+            });
+        }, false, std::logical_or<bool>());
+    }).then([&local_db] (bool aborted) {
+        // Keep the saved keys for the next start if any shard didn't complete its warm-up.
+        if (aborted) {
+            return make_ready_future<>();
+        }
+        return db::row_cache_warmup::remove(local_db);
+    }).handle_exception([] (std::exception_ptr ep) {
+        dblog.warn("Row cache warm-up failed: {}", ep);
+    });
+}
+
+future<> database::stop_row_cache_warmup() noexcept {
+    if (!_row_cache_warmup_as.abort_requested()) {
+        _row_cache_warmup_as.request_abort();
+    }
+    // Wait for the load of this shard before the cache is saved or the tables are closed.
+    if (_row_cache_warmup_load) {
+        // Failures are reported by the shard orchestrating the warm-up.
+        co_await _row_cache_warmup_load->get_future().handle_exception([] (std::exception_ptr) {});
+    }
+    co_await std::exchange(_row_cache_warmup, make_ready_future<>());
+}
+
 future<> database::drain() {
+    co_await stop_row_cache_warmup();
+    try {
+        co_await db::row_cache_warmup::save(*this);
+    } catch (...) {
+        dblog.warn("Failed to save row cache keys: {}", std::current_exception());
+    }
+
     auto b = defer([this] { _stop_barrier.abort(); });
     // Interrupt on going compaction and shutdown to prevent further compaction
     co_await _compaction_manager.drain();
@@ -147,6 +147,7 @@ class config;
 class extensions;
 class rp_handle;
 class data_listeners;
+class hot_partitions_tracker;
 class large_data_handler;
 class system_table_corrupt_data_handler;
 class nop_corrupt_data_handler;
@@ -361,6 +362,12 @@ struct cf_stats {
     int64_t clustering_filter_fast_path_count = 0;
     // how many sstables survived the clustering key checks
     int64_t surviving_sstables_after_clustering_filter = 0;
+    // how many sstables were skipped by their clustering filters, see sstables::clustering_filter
+    int64_t sstables_skipped_by_clustering_prefix_filter = 0;
+    // how many sstables were skipped by their column zone maps, see sstables/column_zone_maps.hh
+    int64_t sstables_skipped_by_column_zone_maps = 0;
+    // how many range scans were narrowed down by sstable-attached indexes, see secondary_index::sstable_index
+    int64_t range_scans_narrowed_by_sstable_index = 0;
 
     // How many view updates were dropped due to overload.
     int64_t dropped_view_updates = 0;
@@ -476,6 +483,9 @@ class table : public enable_lw_shared_from_this<table>
         unsigned x_log2_compaction_groups{0};
         utils::updateable_value<bool> enable_compacting_data_for_streaming_and_repair;
         utils::updateable_value<bool> enable_tombstone_gc_for_streaming_and_repair;
+        // Set for tables with row cache memory bounds. Keeps the tracker alive
+        // for as long as the table's cache, after the database releases it.
+        lw_shared_ptr<cache_tracker> dedicated_row_cache_tracker;
     };
 
     using snapshot_details = db::snapshot_ctl::table_snapshot_details;
@@ -1083,6 +1093,12 @@ class table : public enable_lw_shared_from_this<table>
     lw_shared_ptr<const sstable_list> get_sstables() const;
     lw_shared_ptr<const sstable_list> get_sstables_including_compacted_undeleted() const;
     std::vector<sstables::shared_sstable> select_sstables(const dht::partition_range& range) const;
+    // Returns the tokens, in `range`, of the partitions which may have a value of the column in `values`,
+    // found by the sstable-attached indexes of the sstables and a scan of the memtables, see
+    // secondary_index::sstable_index. The tokens are unordered and may repeat.
+    // Disengaged if some sstable has no index of the column, or more than max_tokens tokens are found.
+    future<std::optional<utils::chunked_vector<dht::token>>> find_sstable_index_candidates(schema_ptr s, reader_permit permit,
+            const column_definition& cdef, const interval<bytes>& values, const dht::partition_range& range, size_t max_tokens) const;
     future<> drop_quarantined_sstables();
     size_t sstables_count() const;
     std::vector<uint64_t> sstable_count_per_level() const;
@@ -1101,6 +1117,9 @@ class table : public enable_lw_shared_from_this<table>
                                         tasks::task_info info,
                                         do_flush = do_flush::yes);
     future<unsigned> estimate_pending_compactions() const;
+    // Sum of the read amplification scores of the last regular compaction
+    // jobs selected for the compaction groups of the table.
+    uint64_t read_amplification_score() const;
 
     void set_compaction_strategy(sstables::compaction_strategy_type strategy);
     const sstables::compaction_strategy& get_compaction_strategy() const {
@@ -1608,6 +1627,9 @@ class database : public peering_sharded_service<database>, qos::qos_configuratio
     database_config _dbcfg;
     backlog_controller::scheduling_group _flush_sg;
     flush_controller _memtable_controller;
+    // Adjusts the I/O bandwidth of compaction and streaming to the latency of user reads.
+    // Only started on shard 0.
+    io_bandwidth_controller _io_bandwidth_controller;
     drain_progress _drain_progress {};
 
 
@@ -1620,6 +1642,15 @@ class database : public peering_sharded_service<database>, qos::qos_configuratio
     db::timeout_semaphore _view_update_concurrency_sem{max_memory_pending_view_updates()};
 
     cache_tracker _row_cache_tracker;
+    // Trackers of tables with row cache memory bounds in their caching options.
+    // They don't share the LRU with other tables. Released when the table is dropped.
+    struct dedicated_row_cache_tracker {
+        lw_shared_ptr<cache_tracker> tracker;
+        // As set by the caching options, before capping the sum of reservations.
+        size_t requested_reservation = 0;
+        size_t limit = 0;
+    };
+    std::map<table_id, dedicated_row_cache_tracker> _dedicated_row_cache_trackers;
     seastar::shared_ptr<db::view::view_update_generator> _view_update_generator;
 
     inheriting_concrete_execution_stage<
@@ -1660,6 +1691,7 @@ class database : public peering_sharded_service<database>, qos::qos_configuratio
 
     friend db::data_listeners;
     std::unique_ptr<db::data_listeners> _data_listeners;
+    std::unique_ptr<db::hot_partitions_tracker> _hot_partitions;
 
     service::migration_notifier& _mnotifier;
     gms::feature_service& _feat;
@@ -1682,6 +1714,18 @@ class database : public peering_sharded_service<database>, qos::qos_configuratio
 
     utils::disk_space_monitor::subscription _out_of_space_subscription;
 
+    // See db/row_cache_warmup.hh. Each shard keeps its own load, while the future, which waits
+    // for all of them before removing the saved keys, is only set on the shard orchestrating the warm-up.
+    abort_source _row_cache_warmup_as;
+    std::optional<shared_future<>> _row_cache_warmup_load;
+    future<> _row_cache_warmup = make_ready_future<>();
+    future<> stop_row_cache_warmup() noexcept;
+    // Returns the dedicated tracker for a table with row cache memory bounds, null otherwise.
+    lw_shared_ptr<cache_tracker> row_cache_tracker_for(const schema&);
+    void update_row_cache_memory_bounds(dedicated_row_cache_tracker&, const caching_options&);
+    void apply_row_cache_memory_bounds();
+    void release_row_cache_tracker(table_id);
+
 public:
     data_dictionary::database as_data_dictionary() const;
     db::commitlog* commitlog_for(const schema_ptr& schema);
@@ -1990,6 +2034,10 @@ class database : public peering_sharded_service<database>, qos::qos_configuratio
 
     static future<db_clock::time_point> get_all_tables_flushed_at(sharded<database>& sharded_db);
 
+    // Starts populating the row cache in the background with partitions
+    // saved when the node was last drained. Call on one shard.
+    static void start_row_cache_warmup_on_all_shards(sharded<database>& sharded_db);
+
     static future<> drop_cache_for_table_on_all_shards(sharded<database>& sharded_db, table_id id);
     static future<> drop_cache_for_keyspace_on_all_shards(sharded<database>& sharded_db, std::string_view ks_name);
 
@@ -2055,6 +2103,10 @@ class database : public peering_sharded_service<database>, qos::qos_configuratio
         return *_data_listeners;
     }
 
+    db::hot_partitions_tracker& hot_partitions() const {
+        return *_hot_partitions;
+    }
+
     // Get the maximum result size for a query, appropriate for the
     // query class, which is deduced from the current scheduling group.
     query::max_result_size get_query_max_result_size() const;
@@ -79,7 +79,7 @@ distributed_loader::process_sstable_dir(sharded<sstables::sstable_directory>& di
         // Supposed to be called with the node either down or on behalf of maintenance tasks
         // like nodetool refresh
         co_await d.process_sstable_dir(flags);
-        co_await d.move_foreign_sstables(dir);
+        co_await d.move_foreign_sstables(dir, flags.sstable_open_config);
     });
 
     co_await dir.invoke_on_all(&sstables::sstable_directory::commit_directory_changes);
@@ -375,6 +375,9 @@ future<> table_populator::process_subdir(sharded<sstables::sstable_directory>& d
         .enable_dangerous_direct_import_of_cassandra_counters = _db.local().get_config().enable_dangerous_direct_import_of_cassandra_counters(),
         .allow_loading_materialized_view = true,
         .garbage_collect = true,
+        .sstable_open_config = {
+            .defer_bloom_filter_load = _db.local().get_config().defer_sstable_bloom_filter_load(),
+        },
     };
     co_await distributed_loader::process_sstable_dir(directory, flags);
 
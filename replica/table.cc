@@ -22,6 +22,7 @@
 #include "replica/data_dictionary_impl.hh"
 #include "replica/compaction_group.hh"
 #include "replica/query_state.hh"
+#include "sstables/column_zone_maps.hh"
 #include "sstables/shared_sstable.hh"
 #include "sstables/sstable_set.hh"
 #include "sstables/sstables.hh"
@@ -35,6 +36,7 @@
 #include "view_info.hh"
 #include "db/data_listeners.hh"
 #include "memtable-sstable.hh"
+#include "partition_slice_builder.hh"
 #include "compaction/compaction_manager.hh"
 #include "compaction/compaction_group_view.hh"
 #include "sstables/sstable_directory.hh"
@@ -258,6 +260,19 @@ table::make_mutation_reader(schema_ptr s,
                     get_max_purgeable_fn_for_cache_underlying_reader(), std::move(trace_state), fwd, fwd_mr)) {
             readers.emplace_back(std::move(*reader_opt));
         }
+    } else if (!slice.value_ranges().empty() && readers.empty() && !s->has_static_columns()
+            && range.is_singular() && range.start()->value().has_key()) {
+        // Only sstables have data of the partition, so those which have no
+        // rows matching the filter can be skipped, see sstables/column_zone_maps.hh.
+        const auto& key = *range.start()->value().key();
+        auto candidates = _sstables->select(range);
+        std::erase_if(candidates, [&] (const sstables::shared_sstable& sst) { return !sst->filter_has_key(*s, key); });
+        auto excluded = sstables::sstables_excluded_by_column_zone_maps(candidates, *s, slice.value_ranges());
+        _config.cf_stats->sstables_skipped_by_column_zone_maps += excluded.size();
+        auto predicate = [excluded = std::move(excluded)] (const sstables::sstable& sst) {
+            return !excluded.contains(&sst);
+        };
+        readers.emplace_back(make_sstable_reader(s, permit, _sstables, range, slice, std::move(trace_state), fwd, fwd_mr, predicate));
     } else {
         readers.emplace_back(make_sstable_reader(s, permit, _sstables, range, slice, std::move(trace_state), fwd, fwd_mr));
     }
@@ -2316,6 +2331,22 @@ future<unsigned> table::estimate_pending_compactions() const {
     co_return ret;
 }
 
+uint64_t compaction_group::read_amplification_score() const {
+    uint64_t ret = 0;
+    for (auto& view : all_views()) {
+        ret += get_compaction_manager().read_amplification_score(*view);
+    }
+    return ret;
+}
+
+uint64_t table::read_amplification_score() const {
+    uint64_t ret = 0;
+    for_each_compaction_group([&ret] (const compaction_group& cg) {
+        ret += cg.read_amplification_score();
+    });
+    return ret;
+}
+
 void compaction_group::set_compaction_strategy_state(compaction::compaction_strategy_state compaction_strategy_state) noexcept {
     _compaction_strategy_state = std::move(compaction_strategy_state);
 }
@@ -2424,6 +2455,80 @@ std::vector<sstables::shared_sstable> table::select_sstables(const dht::partitio
     return _sstables->select(range);
 }
 
+future<std::optional<utils::chunked_vector<dht::token>>>
+table::find_sstable_index_candidates(schema_ptr s, reader_permit permit, const column_definition& cdef, const interval<bytes>& values,
+        const dht::partition_range& range, size_t max_tokens) const {
+    // Sstables written before the column was dropped and added back may
+    // index values of another type, which can't be compared.
+    if (s->dropped_columns().contains(cdef.name_as_text())) {
+        co_return std::nullopt;
+    }
+    auto cmp = [&type = *cdef.type] (const bytes& a, const bytes& b) {
+        return type.compare(a, b);
+    };
+    utils::chunked_vector<dht::token> tokens;
+
+    // Memtables have no index, so scan them. Memtables flushed in the
+    // meantime have their sstables in the set selected below.
+    auto slice = partition_slice_builder(*s).with_no_static_columns().with_regular_column(cdef.name()).build();
+    std::vector<mutation_reader> readers;
+    add_memtables_to_reader_list(readers, s, permit, range, slice, nullptr, streamed_mutation::forwarding::no, mutation_reader::forwarding::no,
+            [&] (size_t memtable_count) { readers.reserve(memtable_count); });
+    std::exception_ptr ex;
+    bool too_many_tokens = false;
+    for (auto& reader : readers) {
+        if (!ex && !too_many_tokens) {
+            try {
+                std::optional<dht::token> token;
+                while (auto mf = co_await reader()) {
+                    if (mf->is_partition_start()) {
+                        token = mf->as_partition_start().key().token();
+                        continue;
+                    }
+                    if (!mf->is_clustering_row()) {
+                        continue;
+                    }
+                    auto* cell = mf->as_clustering_row().cells().find_cell(cdef.id);
+                    if (!cell) {
+                        continue;
+                    }
+                    auto acv = cell->as_atomic_cell(cdef);
+                    if (acv.is_live() && values.contains(to_bytes(acv.value()), cmp)) {
+                        tokens.push_back(*token);
+                        if (tokens.size() > max_tokens) {
+                            too_many_tokens = true;
+                            break;
+                        }
+                        co_await reader.next_partition();
+                    }
+                }
+            } catch (...) {
+                ex = std::current_exception();
+            }
+        }
+        co_await reader.close();
+    }
+    if (ex) {
+        co_return coroutine::exception(std::move(ex));
+    }
+    if (too_many_tokens) {
+        co_return std::nullopt;
+    }
+
+    auto token_range = range.transform(std::mem_fn(&dht::ring_position::token));
+    for (const auto& sst : select_sstables(range)) {
+        auto found = co_await sst->find_in_attached_index(cdef, values, token_range);
+        if (!found || tokens.size() + found->size() > max_tokens) {
+            co_return std::nullopt;
+        }
+        std::ranges::move(*found, std::back_inserter(tokens));
+    }
+    if (tokens.size() > max_tokens) {
+        co_return std::nullopt;
+    }
+    co_return tokens;
+}
+
 future<> table::drop_quarantined_sstables() {
     class quarantine_removal_updater : public row_cache::external_updater_impl {
         table& _t;
@@ -12,12 +12,21 @@
 #include "exceptions/exceptions.hh"
 #include "utils/rjson.hh"
 
-caching_options::caching_options(sstring k, sstring r, bool enabled)
-        : _key_cache(k), _row_cache(r), _enabled(enabled) {
+caching_options::caching_options(sstring k, sstring r, bool enabled, bool in_memory, uint64_t reservation_mb, uint64_t limit_mb)
+        : _key_cache(k), _row_cache(r), _enabled(enabled)
+        , _in_memory(in_memory), _memory_reservation_mb(reservation_mb), _memory_limit_mb(limit_mb) {
     if ((k != "ALL") && (k != "NONE")) {
         throw exceptions::configuration_exception("Invalid key value: " + k); 
     }
 
+    if (limit_mb && reservation_mb > limit_mb) {
+        throw exceptions::configuration_exception(format("memory_reservation_mb ({}) must not be greater than memory_limit_mb ({})", reservation_mb, limit_mb));
+    }
+
+    if (!enabled && (in_memory || reservation_mb || limit_mb)) {
+        throw exceptions::configuration_exception("Row cache memory options require caching to be enabled");
+    }
+
     if ((r == "ALL") || (r == "NONE")) {
         return;
     } else {
@@ -40,6 +49,15 @@ caching_options::to_map() const {
     if (!_enabled) {
         res.insert({"enabled", "false"});
     }
+    if (_in_memory) {
+        res.insert({"in_memory", "true"});
+    }
+    if (_memory_reservation_mb) {
+        res.insert({"memory_reservation_mb", std::to_string(_memory_reservation_mb)});
+    }
+    if (_memory_limit_mb) {
+        res.insert({"memory_limit_mb", std::to_string(_memory_limit_mb)});
+    }
     return res;
 }
 
@@ -58,6 +76,17 @@ caching_options::from_map(const std::map<sstring, sstring>& map) {
     sstring k = default_key;
     sstring r = default_row;
     bool e = true;
+    bool in_memory = false;
+    uint64_t reservation_mb = 0;
+    uint64_t limit_mb = 0;
+
+    auto parse_mb = [] (const std::pair<const sstring, sstring>& p) {
+        try {
+            return boost::lexical_cast<uint64_t>(p.second);
+        } catch (boost::bad_lexical_cast&) {
+            throw exceptions::configuration_exception(format("Invalid value for caching option {}: {}", p.first, p.second));
+        }
+    };
 
     for (auto& p : map) {
         if (p.first == "keys") {
@@ -66,11 +95,17 @@ caching_options::from_map(const std::map<sstring, sstring>& map) {
             r = p.second;
         } else if (p.first == "enabled") {
             e = p.second == "true";
+        } else if (p.first == "in_memory") {
+            in_memory = p.second == "true";
+        } else if (p.first == "memory_reservation_mb") {
+            reservation_mb = parse_mb(p);
+        } else if (p.first == "memory_limit_mb") {
+            limit_mb = parse_mb(p);
         } else {
             throw exceptions::configuration_exception(format("Invalid caching option: {}", p.first));
         }
     }
-    return caching_options(k, r, e);
+    return caching_options(k, r, e, in_memory, reservation_mb, limit_mb);
 }
 
 caching_options
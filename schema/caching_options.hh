@@ -8,6 +8,7 @@
 
 #pragma once
 #include <seastar/core/sstring.hh>
+#include <cstdint>
 #include <map>
 #include "seastarx.hh"
 
@@ -25,7 +26,11 @@ class caching_options {
     sstring _key_cache;
     sstring _row_cache;
     bool _enabled = true;
-    caching_options(sstring k, sstring r, bool enabled);
+    // Row cache memory bounds of the table, see db/cache_tracker.hh.
+    bool _in_memory = false;
+    uint64_t _memory_reservation_mb = 0;
+    uint64_t _memory_limit_mb = 0;
+    caching_options(sstring k, sstring r, bool enabled, bool in_memory = false, uint64_t reservation_mb = 0, uint64_t limit_mb = 0);
 
     friend class schema;
     caching_options();
@@ -34,6 +39,28 @@ class caching_options {
         return _enabled;
     }
 
+    // Partitions of in-memory tables are not evicted from the row cache on memory pressure,
+    // up to the table's memory limit (or the node-wide in-memory cache budget if unset).
+    bool in_memory() const {
+        return _in_memory;
+    }
+
+    // Amount of row cache memory which is not subject to eviction on memory pressure, in bytes.
+    uint64_t memory_reservation() const {
+        return _memory_reservation_mb << 20;
+    }
+
+    // Amount of row cache memory the table may use, in bytes. 0 means no limit.
+    uint64_t memory_limit() const {
+        return _memory_limit_mb << 20;
+    }
+
+    // True iff the table's row cache has its own memory bounds and can't share
+    // the LRU with other tables.
+    bool has_memory_bounds() const {
+        return _in_memory || _memory_reservation_mb || _memory_limit_mb;
+    }
+
     std::map<sstring, sstring> to_map() const;
 
     sstring to_sstring() const;
@@ -29,12 +29,16 @@
 #include "cdc/cdc_extension.hh"
 #include "tombstone_gc_extension.hh"
 #include "db/paxos_grace_seconds_extension.hh"
+#include "db/bloom_filter_layout_extension.hh"
+#include "db/clustering_filter_extension.hh"
+#include "db/column_zone_maps_extension.hh"
 #include "utils/rjson.hh"
 #include "tombstone_gc_options.hh"
 #include "db/per_partition_rate_limit_extension.hh"
 #include "db/tags/utils.hh"
 #include "db/tags/extension.hh"
 #include "index/target_parser.hh"
+#include "index/sstable_index.hh"
 #include "utils/hashing.hh"
 #include "utils/hashers.hh"
 #include "alternator/extract_from_attrs.hh"
@@ -1628,6 +1632,24 @@ schema_ptr schema_builder::build(schema::raw_schema& new_raw) {
             dynamic_pointer_cast<db::paxos_grace_seconds_extension>(it->second)->get_paxos_grace_seconds();
     }
 
+    // cache `bloom_filter_layout` for fast access when writing sstables
+    if (auto it = new_raw._extensions.find(db::bloom_filter_layout_extension::NAME); it != new_raw._extensions.end()) {
+        new_raw._bloom_filter_layout =
+            dynamic_pointer_cast<db::bloom_filter_layout_extension>(it->second)->get_layout();
+    }
+
+    // cache `clustering_filter_bucket_width` for fast access when writing sstables
+    if (auto it = new_raw._extensions.find(db::clustering_filter_extension::NAME); it != new_raw._extensions.end()) {
+        new_raw._clustering_filter_bucket_width =
+            dynamic_pointer_cast<db::clustering_filter_extension>(it->second)->get_bucket_width();
+    }
+
+    // cache `column_zone_maps` for fast access when writing sstables
+    if (auto it = new_raw._extensions.find(db::column_zone_maps_extension::NAME); it != new_raw._extensions.end()) {
+        new_raw._column_zone_maps =
+            dynamic_pointer_cast<db::column_zone_maps_extension>(it->second)->is_enabled();
+    }
+
     // cache the `per_partition_rate_limit` parameters for fast access through the schema object.
     if (auto it = new_raw._extensions.find(db::per_partition_rate_limit_extension::NAME); it != new_raw._extensions.end()) {
         new_raw._per_partition_rate_limit_options =
@@ -1724,6 +1746,21 @@ schema_builder& schema_builder::set_paxos_grace_seconds(int32_t seconds) {
     return *this;
 }
 
+schema_builder& schema_builder::set_bloom_filter_layout(utils::filter_layout layout) {
+    add_extension(db::bloom_filter_layout_extension::NAME, ::make_shared<db::bloom_filter_layout_extension>(layout));
+    return *this;
+}
+
+schema_builder& schema_builder::set_clustering_filter_bucket_width(int64_t width) {
+    add_extension(db::clustering_filter_extension::NAME, ::make_shared<db::clustering_filter_extension>(width));
+    return *this;
+}
+
+schema_builder& schema_builder::set_column_zone_maps(bool enabled) {
+    add_extension(db::column_zone_maps_extension::NAME, ::make_shared<db::column_zone_maps_extension>(enabled));
+    return *this;
+}
+
 schema_builder& schema_builder::set_tablet_options(std::map<sstring, sstring>&& hints) {
     _raw._tablet_options = std::move(hints);
     return *this;
@@ -2058,6 +2095,24 @@ const std::unordered_map<sstring, index_metadata>& schema::all_indices() const {
     return _raw._indices_by_name;
 }
 
+std::vector<const column_definition*> schema::sstable_indexed_columns() const {
+    std::vector<const column_definition*> columns;
+    for (const auto& im : _raw._indices_by_name | std::views::values) {
+        if (!secondary_index::sstable_index::is_sstable_index(im)) {
+            continue;
+        }
+        auto target_str = secondary_index::target_parser::get_target_column_name_from_string(
+            im.options().at(cql3::statements::index_target::target_option_name)
+        );
+        auto column = get_column_definition(to_bytes(cql3_parser::index_target::column_name_from_target_string(target_str)));
+        if (column && column->is_regular() && !std::ranges::contains(columns, column)) {
+            columns.push_back(column);
+        }
+    }
+    std::ranges::sort(columns, std::less<>(), std::mem_fn(&column_definition::id));
+    return columns;
+}
+
 bool schema::has_index(const sstring& index_name) const {
     return _raw._indices_by_name.contains(index_name);
 }
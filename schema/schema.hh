@@ -30,6 +30,7 @@
 #include "timestamp.hh"
 #include "tombstone_gc_options.hh"
 #include "db/per_partition_rate_limit_options.hh"
+#include "utils/i_filter.hh"
 #include "db/tablet_options.hh"
 #include "schema_fwd.hh"
 #include "db/view/base_info.hh"
@@ -542,6 +543,9 @@ class schema final : public enable_lw_shared_from_this<schema> {
         data_type _regular_column_name_type;
         data_type _default_validation_class = bytes_type;
         double _bloom_filter_fp_chance = 0.01;
+        utils::filter_layout _bloom_filter_layout = utils::filter_layout::classic;
+        std::optional<int64_t> _clustering_filter_bucket_width;
+        bool _column_zone_maps = false;
         compression_parameters _compressor_params;
         extensions_map _extensions;
         bool _is_dense = false;
@@ -657,6 +661,17 @@ class schema final : public enable_lw_shared_from_this<schema> {
     double bloom_filter_fp_chance() const {
         return _raw._bloom_filter_fp_chance;
     }
+    utils::filter_layout bloom_filter_layout() const {
+        return _raw._bloom_filter_layout;
+    }
+    // Set if sstables should be written with a clustering filter, see sstables::clustering_filter.
+    std::optional<int64_t> clustering_filter_bucket_width() const {
+        return _raw._clustering_filter_bucket_width;
+    }
+    // True if sstables should be written with column zone maps, see sstables::column_zone_maps.
+    bool column_zone_maps() const {
+        return _raw._column_zone_maps;
+    }
     const compression_parameters& get_compressor_params() const {
         return _raw._compressor_params;
     }
@@ -897,6 +912,8 @@ class schema final : public enable_lw_shared_from_this<schema> {
     // Returns all indices of this schema.
     std::vector<index_metadata> indices() const;
     const std::unordered_map<sstring, index_metadata>& all_indices() const;
+    // Returns the regular columns with an sstable-attached index, see secondary_index::sstable_index.
+    std::vector<const column_definition*> sstable_indexed_columns() const;
     // Search for an index with a given name.
     bool has_index(const sstring& index_name) const;
     // Search for an existing index with same kind and options.
@@ -101,6 +101,9 @@ struct schema_builder {
     }
 
     schema_builder& set_paxos_grace_seconds(int32_t seconds);
+    schema_builder& set_bloom_filter_layout(utils::filter_layout layout);
+    schema_builder& set_clustering_filter_bucket_width(int64_t width);
+    schema_builder& set_column_zone_maps(bool enabled);
 
     schema_builder& set_crc_check_chance(double chance) {
         _raw._crc_check_chance = chance;
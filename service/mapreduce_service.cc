@@ -13,9 +13,11 @@
 #include <seastar/coroutine/parallel_for_each.hh>
 #include <seastar/core/future-util.hh>
 #include <seastar/core/smp.hh>
+#include <seastar/core/thread.hh>
 #include <stdexcept>
 
 #include "db/consistency_level.hh"
+#include "dht/i_partitioner.hh"
 #include "dht/sharder.hh"
 #include "exceptions/exceptions.hh"
 #include "gms/gossiper.hh"
@@ -46,6 +48,7 @@
 #include "cql3/selection/selection.hh"
 #include "cql3/functions/functions.hh"
 #include "cql3/functions/aggregate_fcts.hh"
+#include "cql3/functions/first_function.hh"
 #include "cql3/expr/expr-utils.hh"
 
 namespace service {
@@ -54,11 +57,20 @@ static constexpr int DEFAULT_INTERNAL_PAGING_SIZE = 10000;
 static logging::logger flogger("forward_service"); // not "mapreduce", for compatibility with dtest
 
 static std::vector<::shared_ptr<db::functions::aggregate_function>> get_functions(const query::mapreduce_request& request);
+static std::vector<const column_definition*> get_group_by_columns(const query::mapreduce_request& request, const schema& schema);
 
 class mapreduce_aggregates {
 private:
     std::vector<::shared_ptr<db::functions::aggregate_function>> _funcs;
     std::vector<db::functions::stateless_aggregate_function> _aggrs;
+    schema_ptr _schema;
+    bool _grouped;
+    size_t _group_by_column_count;
+    // The number of groups the page of the query returns at most.
+    size_t _group_limit;
+
+    void reduce_groups(std::vector<std::vector<bytes_opt>>& groups) const;
+    void finalize_groups(std::vector<std::vector<bytes_opt>>& groups) const;
 public:
     mapreduce_aggregates(const query::mapreduce_request& request);
     void merge(query::mapreduce_result& result, query::mapreduce_result&& other);
@@ -73,14 +85,20 @@ class mapreduce_aggregates {
         }
     }
 
+    // Grouped results are sorted and reduced in a thread, which can yield.
     bool requires_thread() const {
-        return std::any_of(_funcs.cbegin(), _funcs.cend(), [](const ::shared_ptr<db::functions::aggregate_function>& f) {
+        return _grouped || std::any_of(_funcs.cbegin(), _funcs.cend(), [](const ::shared_ptr<db::functions::aggregate_function>& f) {
             return f->requires_thread();
         });
     }
 };
 
-mapreduce_aggregates::mapreduce_aggregates(const query::mapreduce_request& request) {
+mapreduce_aggregates::mapreduce_aggregates(const query::mapreduce_request& request)
+    : _schema(local_schema_registry().get(request.cmd.schema_version))
+    , _grouped(bool(request.group_by_column_names))
+    , _group_by_column_count(get_group_by_columns(request, *_schema).size())
+    , _group_limit(request.cmd.partition_limit)
+{
     _funcs = get_functions(request);
     std::vector<db::functions::stateless_aggregate_function> aggrs;
 
@@ -91,10 +109,31 @@ mapreduce_aggregates::mapreduce_aggregates(const query::mapreduce_request& reque
 }
 
 void mapreduce_aggregates::merge(query::mapreduce_result &result, query::mapreduce_result&& other) {
-    if (result.query_results.empty()) {
-        result.query_results = std::move(other.query_results);
+    if (result.empty()) {
+        result = std::move(other);
         return;
-    } else if (other.query_results.empty()) {
+    } else if (other.empty()) {
+        return;
+    }
+
+    if (_grouped) {
+        if (!result.grouped_query_results || !other.grouped_query_results) {
+            on_internal_error(flogger, "mapreduce_aggregates::merge(): grouped request with a result which is not grouped");
+        }
+        // Groups are partitions, each owned by a single shard, so results
+        // have disjoint groups and merging them is concatenating them. Should
+        // a group still show up twice, reduce_groups() reduces it.
+        auto& groups = *result.grouped_query_results;
+        auto& other_groups = *other.grouped_query_results;
+        if (groups.size() < other_groups.size()) {
+            std::swap(groups, other_groups);
+        }
+        std::ranges::move(other_groups, std::back_inserter(groups));
+        // Only the first groups in token order are returned, drop the others
+        // as soon as possible to bound the memory of the merged results.
+        if (groups.size() > _group_limit) {
+            reduce_groups(groups);
+        }
         return;
     }
 
@@ -115,6 +154,14 @@ void mapreduce_aggregates::merge(query::mapreduce_result &result, query::mapredu
 }
 
 void mapreduce_aggregates::finalize(query::mapreduce_result &result) {
+    if (_grouped) {
+        // No result means no node was queried, so there are no groups.
+        if (!result.grouped_query_results) {
+            result.grouped_query_results.emplace();
+        }
+        finalize_groups(*result.grouped_query_results);
+        return;
+    }
     if (result.query_results.empty()) {
         // An empty result means that we didn't send the aggregation request
         // to any node. I.e., it was a query that matched no partition, such
@@ -144,6 +191,115 @@ void mapreduce_aggregates::finalize(query::mapreduce_result &result) {
     }
 }
 
+using keyed_group = std::pair<dht::decorated_key, std::vector<bytes_opt>>;
+
+// Sorts groups into token order. It's a merge sort of runs short enough to be
+// sorted without yielding, so it must be called in a thread.
+static void sort_groups(std::vector<keyed_group>& groups, const schema& s) {
+    auto less = [&s] (const keyed_group& a, const keyed_group& b) {
+        return a.first.less_compare(s, b.first);
+    };
+    constexpr size_t run_size = 128;
+    for (size_t i = 0; i < groups.size(); i += run_size) {
+        std::sort(groups.begin() + i, groups.begin() + std::min(i + run_size, groups.size()), less);
+        seastar::thread::maybe_yield();
+    }
+    std::vector<keyed_group> merged;
+    merged.reserve(groups.size());
+    for (size_t width = run_size; width < groups.size(); width *= 2) {
+        for (size_t lo = 0; lo < groups.size(); lo += 2 * width) {
+            size_t mid = std::min(lo + width, groups.size());
+            size_t hi = std::min(lo + 2 * width, groups.size());
+            size_t i = lo;
+            size_t j = mid;
+            while (i < mid || j < hi) {
+                if (j == hi || (i < mid && !less(groups[j], groups[i]))) {
+                    merged.push_back(std::move(groups[i++]));
+                } else {
+                    merged.push_back(std::move(groups[j++]));
+                }
+                seastar::thread::maybe_yield();
+            }
+        }
+        std::swap(groups, merged);
+        merged.clear();
+    }
+}
+
+// Sorts the groups into token order, which is the order a GROUP BY which is
+// not parallelized returns them in, reduces the ones which show up more than
+// once, and keeps the first _group_limit of them. Must be called in a thread.
+void mapreduce_aggregates::reduce_groups(std::vector<std::vector<bytes_opt>>& groups) const {
+    std::vector<keyed_group> keyed_groups;
+    keyed_groups.reserve(groups.size());
+    for (auto& group : groups) {
+        if (group.size() != _group_by_column_count + _aggrs.size()) {
+            on_internal_error(
+                flogger,
+                format("mapreduce_aggregates::reduce_groups(): operation cannot be completed due to invalid argument sizes. "
+                        "this.aggrs.size(): {} "
+                        "group by columns: {} "
+                        "group.size(): {} ",
+                        _aggrs.size(), _group_by_column_count, group.size())
+            );
+        }
+        auto key = partition_key::from_exploded(*_schema, group
+                | std::views::take(_group_by_column_count)
+                | std::views::transform([] (const bytes_opt& v) { return v.value_or(bytes()); })
+                | std::ranges::to<std::vector<bytes>>());
+        keyed_groups.emplace_back(dht::decorate_key(*_schema, std::move(key)), std::move(group));
+        seastar::thread::maybe_yield();
+    }
+
+    sort_groups(keyed_groups, *_schema);
+
+    groups.clear();
+    for (size_t i = 0; i < keyed_groups.size(); i++) {
+        auto& group = keyed_groups[i].second;
+        if (i == 0 || !keyed_groups[i].first.equal(*_schema, keyed_groups[i - 1].first)) {
+            if (groups.size() == _group_limit) {
+                break;
+            }
+            groups.push_back(std::move(group));
+            continue;
+        }
+        auto& previous = groups.back();
+        for (size_t j = _group_by_column_count; j < previous.size(); j++) {
+            auto& aggr = _aggrs[j - _group_by_column_count];
+            previous[j] = aggr.state_reduction_function->execute(std::vector({std::move(previous[j]), std::move(group[j])}));
+        }
+        seastar::thread::maybe_yield();
+    }
+}
+
+void mapreduce_aggregates::finalize_groups(std::vector<std::vector<bytes_opt>>& groups) const {
+    reduce_groups(groups);
+    for (auto& group : groups) {
+        for (size_t j = _group_by_column_count; j < group.size(); j++) {
+            auto& aggr = _aggrs[j - _group_by_column_count];
+            if (aggr.state_to_result_function) {
+                group[j] = aggr.state_to_result_function->execute(std::vector({std::move(group[j])}));
+            }
+        }
+        seastar::thread::maybe_yield();
+    }
+}
+
+// Rows can only be grouped by the partition key, so that groups don't span
+// shards. Returns the group by columns, in the order of their values in
+// grouped results.
+static std::vector<const column_definition*> get_group_by_columns(const query::mapreduce_request& request, const schema& schema) {
+    if (!request.group_by_column_names) {
+        return {};
+    }
+    auto& names = *request.group_by_column_names;
+    auto pk_columns = schema.partition_key_columns();
+    if (!std::ranges::equal(names, pk_columns, std::ranges::equal_to{}, {}, std::mem_fn(&column_definition::name_as_text))) {
+        throw std::runtime_error(format("Cannot group by columns [{}], only grouping by the partition key is supported", fmt::join(names, ", ")));
+    }
+    return pk_columns | std::views::transform([] (const column_definition& c) { return &c; }) | std::ranges::to<std::vector>();
+}
+
 static std::vector<::shared_ptr<db::functions::aggregate_function>> get_functions(const query::mapreduce_request& request) {
     
     schema_ptr schema = local_schema_registry().get(request.cmd.schema_version);
@@ -372,6 +528,16 @@ static shared_ptr<cql3::selection::selection> mock_selection(
         return cql3::selection::prepared_selector{std::move(prepared_expr), column_identifier};
     };
 
+    // Group by columns come first in the results, selected through first(),
+    // as GROUP BY does for columns which are not aggregated.
+    for (auto col : get_group_by_columns(request, *schema)) {
+        auto first_expr = cql3::expr::function_call{
+            .func = cql3::functions::aggregate_fcts::make_first_function(col->type),
+            .args = {cql3::expr::column_value(col)},
+        };
+        prepared_selectors.push_back(cql3::selection::prepared_selector{std::move(first_expr), col->column_specification->name});
+    }
+
     for (size_t i = 0; i < request.reduction_types.size(); i++) {
         auto info = (request.aggregation_infos) ? std::optional(request.aggregation_infos->at(i)) : std::nullopt;
         prepared_selectors.emplace_back(mock_singular_selection(functions[i], request.reduction_types[i], info));
@@ -462,11 +628,14 @@ future<query::mapreduce_result> mapreduce_service::execute_on_this_shard(
         cql3::query_options::specific_options::DEFAULT
     );
 
+    auto group_by_cell_indices = get_group_by_columns(req, *schema)
+            | std::views::transform([&] (const column_definition* col) -> size_t { return selection->index_of(*col); })
+            | std::ranges::to<std::vector>();
     auto rs_builder = cql3::selection::result_set_builder(
         *selection,
         now,
         nullptr,
-        std::vector<size_t>() // Represents empty GROUP BY indices.
+        std::move(group_by_cell_indices)
     );
 
     // We serve up to 256 ranges at a time to avoid allocating a huge vector for ranges
@@ -475,6 +644,12 @@ future<query::mapreduce_result> mapreduce_service::execute_on_this_shard(
     ranges_owned_by_this_shard.reserve(std::min(max_ranges, req.pr.size()));
     partition_ranges_owned_by_this_shard owned_iter(schema, std::move(req.pr), req.shard_id_hint);
 
+    // The ranges are scanned in token order, so once the first groups the query
+    // returns are complete, the following ones aren't needed.
+    auto has_all_groups = [&] {
+        return req.group_by_column_names && rs_builder.result_set_size() >= req.cmd.partition_limit;
+    };
+
     std::optional<dht::partition_range> current_range;
     do {
         while ((current_range = owned_iter.next(*schema))) {
@@ -500,7 +675,7 @@ future<query::mapreduce_result> mapreduce_service::execute_on_this_shard(
         );
 
         // Execute query.
-        while (!pager->is_exhausted()) {
+        while (!pager->is_exhausted() && !has_all_groups()) {
             // It is necessary to check for a shutdown request before each
             // fetch_page operation. During the drain process, the messaging
             // service is shut down early (but not earlier than the
@@ -515,11 +690,24 @@ future<query::mapreduce_result> mapreduce_service::execute_on_this_shard(
         }
 
         ranges_owned_by_this_shard.clear();
-    } while (current_range);
+    } while (current_range && !has_all_groups());
 
     co_return co_await rs_builder.with_thread_if_needed([&req, &rs_builder, reductions = req.reduction_types, tr_state = std::move(tr_state)] {
         auto rs = rs_builder.build();
         auto& rows = rs->rows();
+        auto to_bytes_opts = [] (const std::vector<managed_bytes_opt>& row) {
+            return row | std::views::transform([] (const managed_bytes_opt& x) { return to_bytes_opt(x); }) | std::ranges::to<std::vector<bytes_opt>>();
+        };
+        if (req.group_by_column_names) {
+            // A row per group, with the group by columns followed by the reductions.
+            query::mapreduce_result res = { .grouped_query_results = rows
+                    | std::views::take(req.cmd.partition_limit)
+                    | std::views::transform(to_bytes_opts)
+                    | std::ranges::to<std::vector>() };
+            tracing::trace(tr_state, "On shard execution result has {} groups", res.grouped_query_results->size());
+            flogger.debug("on shard execution result has {} groups", res.grouped_query_results->size());
+            return res;
+        }
         if (rows.size() != 1) {
             flogger.error("aggregation result row count != 1");
             throw std::runtime_error("aggregation result row count != 1");
@@ -528,7 +716,7 @@ future<query::mapreduce_result> mapreduce_service::execute_on_this_shard(
             flogger.error("aggregation result column count does not match requested column count");
             throw std::runtime_error("aggregation result column count does not match requested column count");
         }
-        query::mapreduce_result res = { .query_results = rows[0] | std::views::transform([] (const managed_bytes_opt& x) { return to_bytes_opt(x); }) | std::ranges::to<std::vector<bytes_opt>>() };
+        query::mapreduce_result res = { .query_results = to_bytes_opts(rows[0]) };
 
         auto printer = seastar::value_of([&req, &res] {
             return query::mapreduce_result::printer {
@@ -574,7 +762,7 @@ future<> mapreduce_service::dispatch_range_and_reduce(const locator::effective_r
     // Anytime this coroutine yields, other coroutines may want to write to `shared_accumulator`.
     // As merging can yield internally, merging directly to `shared_accumulator` would result in race condition.
     // We can safely write to `shared_accumulator` only when it is empty.
-    while (!shared_accumulator.query_results.empty()) {
+    while (!shared_accumulator.empty()) {
         // Move `shared_accumulator` content to local variable. Leave `shared_accumulator` empty - now other coroutines can safely write to it.
         query::mapreduce_result previous_results = std::exchange(shared_accumulator, {});
         // Merge two local variables - it can yield.
@@ -47,6 +47,13 @@ class retrying_dispatcher;
 //   5. `dispatch` merges results from all coordinators and returns merged
 //      result.
 //
+// Queries grouping rows by partition key (GROUP BY of the whole partition key)
+// set `group_by_column_names`. A group never spans partitions, and so never
+// spans shards either, so each shard produces a partial result per group, and
+// merging results concatenates the groups. The super-coordinator finalizes the
+// aggregates of each group and returns groups in token order, up to the
+// command's partition limit, i.e. the groups of a page.
+//
 // Splitting query into sub-queries is implemented separately for vnodes
 // and for tablets.
 //
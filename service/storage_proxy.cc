@@ -11,6 +11,7 @@
 #include <random>
 #include <algorithm>
 #include <ranges>
+#include <cmath>
 
 #include <fmt/ranges.h>
 #include <seastar/core/sleep.hh>
@@ -197,10 +198,52 @@ bool storage_proxy::only_me(const locator::effective_replication_map& erm, const
     return replicas.size() == 1 && is_me(erm, replicas[0]);
 }
 
+// Replicas with fewer recent reads than this have too few samples for their
+// latency percentiles to be meaningful.
+static constexpr uint64_t min_replica_read_latency_samples = 100;
+// Bounds the bursts of speculative reads adaptive speculative retry may send
+// after a quiet period.
+static constexpr double max_speculative_retry_budget = 100;
+
+void storage_proxy::register_replica_read_latency(locator::host_id replica, std::chrono::microseconds latency) {
+    auto& l = _replica_read_latencies[replica];
+    // Decay the values a little every second to give new data points more
+    // weight, as table::get_coordinator_read_latency_percentile() does.
+    auto now = lowres_clock::now();
+    auto seconds = std::chrono::duration_cast<std::chrono::seconds>(now - l.decayed_at).count();
+    if (seconds > 0) {
+        l.histogram *= std::pow(0.9, std::min<int64_t>(seconds, 100));
+        l.decayed_at = now;
+    }
+    l.histogram.add(latency.count());
+}
+
+std::optional<std::chrono::microseconds> storage_proxy::get_replica_read_latency_percentile(locator::host_id replica, double percentile) const {
+    auto it = _replica_read_latencies.find(replica);
+    if (it == _replica_read_latencies.end() || it->second.histogram.count() < min_replica_read_latency_samples) {
+        return std::nullopt;
+    }
+    return std::chrono::microseconds(std::max(it->second.histogram.percentile(percentile), int64_t(1)));
+}
+
+void storage_proxy::add_speculative_retry_budget() {
+    _speculative_retry_budget = std::min(_speculative_retry_budget + _db.local().get_config().speculative_retry_budget(), max_speculative_retry_budget);
+}
+
+bool storage_proxy::consume_speculative_retry_budget() {
+    if (_speculative_retry_budget < 1) {
+        return false;
+    }
+    _speculative_retry_budget -= 1;
+    return true;
+}
+
 enum class storage_proxy_remote_read_verb {
     read_data,
     read_mutation_data,
-    read_digest
+    read_digest,
+    read_data_batch,
+    read_digest_batch
 };
 
 }
@@ -219,6 +262,12 @@ template <> struct fmt::formatter<service::storage_proxy_remote_read_verb> : fmt
         case read_digest:
             name = "read_digest";
             break;
+        case read_data_batch:
+            name = "read_data_batch";
+            break;
+        case read_digest_batch:
+            name = "read_digest_batch";
+            break;
         }
         return formatter<string_view>::format(name, ctx);
     }
@@ -269,6 +318,8 @@ class storage_proxy::remote {
         ser::storage_proxy_rpc_verbs::register_read_data(&_ms, std::bind_front(&remote::handle_read_data, this));
         ser::storage_proxy_rpc_verbs::register_read_mutation_data(&_ms, std::bind_front(&remote::handle_read_mutation_data, this));
         ser::storage_proxy_rpc_verbs::register_read_digest(&_ms, std::bind_front(&remote::handle_read_digest, this));
+        ser::storage_proxy_rpc_verbs::register_read_data_batch(&_ms, std::bind_front(&remote::handle_read_data_batch, this));
+        ser::storage_proxy_rpc_verbs::register_read_digest_batch(&_ms, std::bind_front(&remote::handle_read_digest_batch, this));
         ser::storage_proxy_rpc_verbs::register_truncate(&_ms, std::bind_front(&remote::handle_truncate, this));
         ser::storage_proxy_rpc_verbs::register_truncate_with_tablets(&_ms, std::bind_front(&remote::handle_truncate_with_tablets, this));
         // Register PAXOS verb handlers
@@ -430,6 +481,38 @@ class storage_proxy::remote {
         co_return rpc::tuple{d, t ? t.value() : api::missing_timestamp, hit_rate.value_or(cache_temperature::invalid()), opt_last_pos ? std::move(*opt_last_pos) : std::nullopt};
     }
 
+    future<rpc::tuple<std::vector<query::result>, std::vector<cache_temperature>>>
+    send_read_data_batch(
+            locator::host_id addr, storage_proxy::clock_type::time_point timeout, tracing::trace_state_ptr tr_state,
+            const query::read_command& cmd, const dht::partition_range_vector& prs,
+            query::digest_algorithm digest_algo, fencing_token fence) {
+        tracing::trace(tr_state, "read_data_batch: sending a message for {} partition ranges to /{}", prs.size(), addr);
+        auto&& [results, hit_rates, exception] =
+            co_await ser::storage_proxy_rpc_verbs::send_read_data_batch(&_ms, addr, timeout, cmd, prs, digest_algo, fence);
+        if (exception) {
+            co_await coroutine::return_exception_ptr(exception.into_exception_ptr());
+        }
+
+        tracing::trace(tr_state, "read_data_batch: got response from /{}", addr);
+        co_return rpc::tuple{std::move(results), std::move(hit_rates)};
+    }
+
+    future<rpc::tuple<std::vector<query::result_digest>, std::vector<api::timestamp_type>, std::vector<cache_temperature>, std::vector<std::optional<full_position>>>>
+    send_read_digest_batch(
+            locator::host_id addr, storage_proxy::clock_type::time_point timeout, tracing::trace_state_ptr tr_state,
+            const query::read_command& cmd, const dht::partition_range_vector& prs,
+            query::digest_algorithm digest_algo, fencing_token fence) {
+        tracing::trace(tr_state, "read_digest_batch: sending a message for {} partition ranges to /{}", prs.size(), addr);
+        auto&& [digests, last_modified, hit_rates, last_positions, exception] =
+            co_await ser::storage_proxy_rpc_verbs::send_read_digest_batch(&_ms, addr, timeout, cmd, prs, digest_algo, fence);
+        if (exception) {
+            co_await coroutine::return_exception_ptr(exception.into_exception_ptr());
+        }
+
+        tracing::trace(tr_state, "read_digest_batch: got response from /{}", addr);
+        co_return rpc::tuple{std::move(digests), std::move(last_modified), std::move(hit_rates), std::move(last_positions)};
+    }
+
     future<> send_truncate(
             locator::host_id addr, storage_proxy::clock_type::time_point timeout,
             sstring ks_name, sstring cf_name) {
@@ -793,9 +876,9 @@ class storage_proxy::remote {
 
     using read_verb = storage_proxy_remote_read_verb;
 
-    template<typename Result, read_verb verb>
+    template<typename Result, read_verb verb, typename PartitionRange = ::compat::wrapping_partition_range>
     future<Result> handle_read(const rpc::client_info& cinfo, rpc::opt_time_point t,
-        query::read_command cmd1, ::compat::wrapping_partition_range pr,
+        query::read_command cmd1, PartitionRange pr,
         rpc::optional<query::digest_algorithm> oda,
         rpc::optional<db::per_partition_rate_limit::info> rate_limit_info_opt,
         rpc::optional<service::fencing_token> fence_opt)
@@ -811,7 +894,7 @@ class storage_proxy::remote {
         }
         auto rate_limit_info = rate_limit_info_opt.value_or(std::monostate());
         if (!cmd1.max_result_size) {
-            if constexpr (verb == read_verb::read_data) {
+            if constexpr (verb == read_verb::read_data || verb == read_verb::read_data_batch) {
                 auto& cfg = _sp.local_db().get_config();
                 cmd1.max_result_size.emplace(cfg.max_memory_for_unlimited_query_soft_limit(), cfg.max_memory_for_unlimited_query_hard_limit());
             } else {
@@ -865,7 +948,14 @@ class storage_proxy::remote {
             slogger.info("storage_proxy::handle_read injection done");
         });
 
-        auto pr2 = ::compat::unwrap(std::move(pr), *s);
+        auto pr2 = [&] {
+            if constexpr (verb == read_verb::read_data_batch || verb == read_verb::read_digest_batch) {
+                // Batched reads are only sent with singular, hence non-wrapping, ranges.
+                return std::move(pr);
+            } else {
+                return ::compat::unwrap(std::move(pr), *s);
+            }
+        }();
         auto do_query = [&]() {
             if constexpr (verb == read_verb::read_data) {
                 if (pr2.second) {
@@ -906,6 +996,20 @@ class storage_proxy::remote {
                 }
                 auto da = oda.value();
                 return p->query_result_local_digest(erm, std::move(s), cmd, std::move(pr2.first), trace_state_ptr, timeout, da, rate_limit_info);
+            } else if constexpr (verb == read_verb::read_data_batch) {
+                auto erm = s->table().get_effective_replication_map();
+                p->get_stats().replica_data_reads += pr2.size();
+                p->get_stats().replica_batched_reads++;
+                auto da = oda.value();
+                query::result_options opts;
+                opts.digest_algo = da;
+                opts.request = da == query::digest_algorithm::none ? query::result_request::only_result : query::result_request::result_and_digest;
+                return p->query_result_local_batch(erm, std::move(s), cmd, std::move(pr2), opts, trace_state_ptr, timeout);
+            } else if constexpr (verb == read_verb::read_digest_batch) {
+                auto erm = s->table().get_effective_replication_map();
+                p->get_stats().replica_digest_reads += pr2.size();
+                p->get_stats().replica_batched_reads++;
+                return p->query_result_local_digest_batch(erm, std::move(s), cmd, std::move(pr2), trace_state_ptr, timeout, oda.value());
             } else {
                 static_assert(verb == static_cast<read_verb>(-1), "Unsupported verb");
             }
@@ -958,6 +1062,25 @@ class storage_proxy::remote {
             std::move(pr), oda, rate_limit_info_opt, fence);
     }
 
+    using read_data_batch_result_t = rpc::tuple<std::vector<query::result>, std::vector<cache_temperature>, replica::exception_variant>;
+    future<read_data_batch_result_t> handle_read_data_batch(
+            const rpc::client_info& cinfo, rpc::opt_time_point t,
+            query::read_command cmd1, dht::partition_range_vector prs,
+            query::digest_algorithm da, service::fencing_token fence) {
+        return handle_read<read_data_batch_result_t, read_verb::read_data_batch>(cinfo, t, std::move(cmd1),
+            std::move(prs), da, std::nullopt, fence);
+    }
+
+    using read_digest_batch_result_t = rpc::tuple<std::vector<query::result_digest>, std::vector<api::timestamp_type>, std::vector<cache_temperature>,
+            std::vector<std::optional<full_position>>, replica::exception_variant>;
+    future<read_digest_batch_result_t> handle_read_digest_batch(
+            const rpc::client_info& cinfo, rpc::opt_time_point t,
+            query::read_command cmd1, dht::partition_range_vector prs,
+            query::digest_algorithm da, service::fencing_token fence) {
+        return handle_read<read_digest_batch_result_t, read_verb::read_digest_batch>(cinfo, t, std::move(cmd1),
+            std::move(prs), da, std::nullopt, fence);
+    }
+
     future<> handle_truncate(rpc::opt_time_point timeout, sstring ksname, sstring cfname) {
         co_await replica::database::truncate_table_on_all_shards(_sp._db, _sys_ks, ksname, cfname);
     }
@@ -2933,6 +3056,18 @@ void storage_proxy_stats::stats::register_stats() {
                        sm::description("number of speculative data read requests that were sent"),
                        {storage_proxy_stats::current_scheduling_group_label(), basic_level}).set_skip_when_empty(),
 
+        sm::make_total_operations("adaptive_speculative_reads", adaptive_speculative_reads,
+                       sm::description("number of speculative read requests that were sent because the replicas read from were slower than their recent latencies"),
+                       {storage_proxy_stats::current_scheduling_group_label()}).set_skip_when_empty(),
+
+        sm::make_total_operations("speculative_reads_won", speculative_reads_won,
+                       sm::description("number of speculative read requests that were answered before one of the requests they were sent in addition to"),
+                       {storage_proxy_stats::current_scheduling_group_label()}).set_skip_when_empty(),
+
+        sm::make_total_operations("speculative_reads_over_budget", speculative_reads_over_budget,
+                       sm::description("number of speculative read requests that were not sent because of speculative_retry_budget"),
+                       {storage_proxy_stats::current_scheduling_group_label()}).set_skip_when_empty(),
+
         sm::make_summary("cas_read_latency_summary", sm::description("CAS read latency summary"), [this] {return to_metrics_summary(cas_read.summary());})(storage_proxy_stats::current_scheduling_group_label())(basic_level)(cas_label).set_skip_when_empty(),
         sm::make_summary("cas_write_latency_summary", sm::description("CAS write latency summary"), [this] {return to_metrics_summary(cas_write.summary());})(storage_proxy_stats::current_scheduling_group_label())(basic_level)(cas_label).set_skip_when_empty(),
 
@@ -3039,6 +3174,10 @@ void storage_proxy_stats::stats::register_stats() {
                        sm::description("number of remote reads this Node received. op_type label could be data, mutation_data or digest"),
                        {storage_proxy_stats::current_scheduling_group_label(), storage_proxy_stats::op_type_label("digest")}).set_skip_when_empty(),
 
+        sm::make_total_operations("batched_reads", replica_batched_reads,
+                       sm::description("number of remote data and digest reads this Node received for several partitions at once. Each of their partitions is also counted by reads"),
+                       {storage_proxy_stats::current_scheduling_group_label()}).set_skip_when_empty(),
+
         sm::make_total_operations("cross_shard_ops", replica_cross_shard_ops,
                        sm::description("number of operations that crossed a shard boundary"),
                        {storage_proxy_stats::current_scheduling_group_label()}).set_skip_when_empty(),
@@ -5255,6 +5394,120 @@ class data_read_resolver : public abstract_read_resolver {
     }
 };
 
+// Batches the requests which the read executors of a multi-partition singular
+// query (SELECT ... WHERE pk IN (...)) send to remote replicas, so that each
+// replica receives a single read_data_batch or read_digest_batch RPC for all
+// the partitions it is asked about, instead of one RPC per partition.
+// The executors still resolve (and repair) each partition on their own,
+// the batcher only demultiplexes the replies back to them.
+//
+// Requests are collected until flush() is called.
+class read_request_batcher : public enable_shared_from_this<read_request_batcher> {
+public:
+    using data_result = rpc::tuple<foreign_ptr<lw_shared_ptr<query::result>>, cache_temperature>;
+    using digest_result = rpc::tuple<query::result_digest, api::timestamp_type, cache_temperature, std::optional<full_position>>;
+private:
+    template <typename Result>
+    struct batch {
+        locator::host_id ep;
+        query::digest_algorithm digest_algo;
+        dht::partition_range_vector ranges;
+        std::vector<promise<Result>> promises;
+    };
+
+    shared_ptr<storage_proxy> _proxy;
+    lw_shared_ptr<query::read_command> _cmd;
+    fencing_token _fence;
+    tracing::trace_state_ptr _trace_state;
+    storage_proxy::clock_type::time_point _timeout;
+    std::vector<batch<data_result>> _data_batches;
+    std::vector<batch<digest_result>> _digest_batches;
+
+    template <typename Result>
+    static future<Result> add(std::vector<batch<Result>>& batches, locator::host_id ep, const dht::partition_range& pr, query::digest_algorithm digest_algo) {
+        // There are only as many batches as there are replicas of the partitions.
+        auto it = std::ranges::find_if(batches, [&] (const batch<Result>& b) { return b.ep == ep && b.digest_algo == digest_algo; });
+        if (it == batches.end()) {
+            it = batches.insert(batches.end(), batch<Result>{ep, digest_algo});
+        }
+        it->ranges.push_back(pr);
+        return it->promises.emplace_back().get_future();
+    }
+
+    template <typename Result>
+    static void fail(batch<Result>& b, std::exception_ptr ex) {
+        for (auto& p : b.promises) {
+            p.set_exception(ex);
+        }
+    }
+
+    template <typename Result>
+    static void check_reply_size(const batch<Result>& b, size_t size) {
+        if (size != b.ranges.size()) {
+            throw std::runtime_error(format("Replica {} replied to a batched read of {} partition ranges with {} results", b.ep, b.ranges.size(), size));
+        }
+    }
+
+    future<> send(batch<data_result> b) {
+        auto self = shared_from_this();
+        try {
+            auto [results, hit_rates] = co_await _proxy->remote().send_read_data_batch(b.ep, _timeout, _trace_state, *_cmd, b.ranges, b.digest_algo, _fence);
+            check_reply_size(b, results.size());
+            check_reply_size(b, hit_rates.size());
+            for (size_t i = 0; i < b.promises.size(); ++i) {
+                b.promises[i].set_value(data_result(make_foreign(make_lw_shared<query::result>(std::move(results[i]))), hit_rates[i]));
+            }
+        } catch (...) {
+            fail(b, std::current_exception());
+        }
+    }
+
+    future<> send(batch<digest_result> b) {
+        auto self = shared_from_this();
+        try {
+            auto [digests, last_modified, hit_rates, last_positions] = co_await _proxy->remote().send_read_digest_batch(b.ep, _timeout, _trace_state, *_cmd, b.ranges, b.digest_algo, _fence);
+            check_reply_size(b, digests.size());
+            check_reply_size(b, last_modified.size());
+            check_reply_size(b, hit_rates.size());
+            check_reply_size(b, last_positions.size());
+            for (size_t i = 0; i < b.promises.size(); ++i) {
+                b.promises[i].set_value(digest_result(digests[i], last_modified[i], hit_rates[i], std::move(last_positions[i])));
+            }
+        } catch (...) {
+            fail(b, std::current_exception());
+        }
+    }
+public:
+    read_request_batcher(shared_ptr<storage_proxy> proxy, lw_shared_ptr<query::read_command> cmd, fencing_token fence,
+            tracing::trace_state_ptr trace_state, storage_proxy::clock_type::time_point timeout)
+        : _proxy(std::move(proxy))
+        , _cmd(std::move(cmd))
+        , _fence(fence)
+        , _trace_state(std::move(trace_state))
+        , _timeout(timeout)
+    { }
+
+    future<data_result> add_data_request(locator::host_id ep, const dht::partition_range& pr, query::digest_algorithm digest_algo) {
+        return add(_data_batches, ep, pr, digest_algo);
+    }
+
+    future<digest_result> add_digest_request(locator::host_id ep, const dht::partition_range& pr, query::digest_algorithm digest_algo) {
+        return add(_digest_batches, ep, pr, digest_algo);
+    }
+
+    // Sends the requests collected so far, one RPC per replica and request kind.
+    void flush() {
+        for (auto& b : std::exchange(_data_batches, {})) {
+            // Waited on indirectly, through the futures returned by add_data_request().
+            (void)send(std::move(b));
+        }
+        for (auto& b : std::exchange(_digest_batches, {})) {
+            // Waited on indirectly, through the futures returned by add_digest_request().
+            (void)send(std::move(b));
+        }
+    }
+};
+
 class abstract_read_executor : public enable_shared_from_this<abstract_read_executor> {
 protected:
     using targets_iterator = host_id_vector_replica_set::iterator;
@@ -5282,6 +5535,9 @@ class abstract_read_executor : public enable_shared_from_this<abstract_read_exec
     bool _foreground = true;
     service_permit _permit; // holds admission permit until operation completes
     db::per_partition_rate_limit::info _rate_limit_info;
+    // Set while the initial requests are made, if they are to be batched
+    // with the requests of other partitions.
+    ::shared_ptr<read_request_batcher> _batcher;
 
 private:
     const bool _native_reversed_queries_enabled;
@@ -5354,6 +5610,9 @@ class abstract_read_executor : public enable_shared_from_this<abstract_read_exec
         if (_proxy->is_me(*_effective_replication_map_ptr, ep)) {
             tracing::trace(_trace_state, "read_data: querying locally");
             return _proxy->apply_fence(_proxy->query_result_local(_effective_replication_map_ptr, _schema, _cmd, _partition_range, opts, _trace_state, timeout, adjust_rate_limit_for_local_operation(_rate_limit_info)), fence, _proxy->my_address());
+        } else if (_batcher) {
+            tracing::trace(_trace_state, "read_data: batching the request to /{}", ep);
+            return _batcher->add_data_request(ep, _partition_range, opts.digest_algo);
         } else {
             const bool format_reverse_required = _cmd->slice.is_reversed() && !_native_reversed_queries_enabled;
             auto cmd = format_reverse_required ? reversed(::make_lw_shared(*_cmd)) : _cmd;
@@ -5367,6 +5626,9 @@ class abstract_read_executor : public enable_shared_from_this<abstract_read_exec
             tracing::trace(_trace_state, "read_digest: querying locally");
             return _proxy->apply_fence(_proxy->query_result_local_digest(_effective_replication_map_ptr, _schema, _cmd, _partition_range, _trace_state,
                         timeout, digest_algorithm(*_proxy), adjust_rate_limit_for_local_operation(_rate_limit_info)), fence, _proxy->my_address());
+        } else if (_batcher) {
+            tracing::trace(_trace_state, "read_digest: batching the request to /{}", ep);
+            return _batcher->add_digest_request(ep, _partition_range, digest_algorithm(*_proxy));
         } else {
             tracing::trace(_trace_state, "read_digest: sending a message to /{}", ep);
             const bool format_reverse_required = _cmd->slice.is_reversed() && !_native_reversed_queries_enabled;
@@ -5386,7 +5648,7 @@ class abstract_read_executor : public enable_shared_from_this<abstract_read_exec
                     _cf->set_hit_rate(ep, std::get<1>(v));
                     resolver->add_mutate_data(ep, std::get<0>(std::move(v)));
                     ++_proxy->get_stats().mutation_data_read_completed.get_ep_stat(get_topology(), ep);
-                    register_request_latency(latency_clock::now() - start);
+                    register_request_latency(ep, latency_clock::now() - start);
                     return;
                   } else {
                     ex = f.get_exception();
@@ -5413,7 +5675,7 @@ class abstract_read_executor : public enable_shared_from_this<abstract_read_exec
                     resolver->add_data(ep, std::get<0>(std::move(v)));
                     ++_proxy->get_stats().data_read_completed.get_ep_stat(get_topology(), ep);
                     _used_targets.push_back(ep);
-                    register_request_latency(latency_clock::now() - start);
+                    register_request_latency(ep, latency_clock::now() - start);
                     return;
                   } else {
                     ex = f.get_exception();
@@ -5440,7 +5702,7 @@ class abstract_read_executor : public enable_shared_from_this<abstract_read_exec
                     resolver->add_digest(ep, std::get<0>(v), std::get<1>(v), std::get<3>(std::move(v)));
                     ++_proxy->get_stats().digest_read_completed.get_ep_stat(get_topology(), ep);
                     _used_targets.push_back(ep);
-                    register_request_latency(latency_clock::now() - start);
+                    register_request_latency(ep, latency_clock::now() - start);
                     return;
                   } else {
                     ex = f.get_exception();
@@ -5609,7 +5871,10 @@ class abstract_read_executor : public enable_shared_from_this<abstract_read_exec
     }
 
 public:
-    future<result<foreign_ptr<lw_shared_ptr<query::result>>>> execute(storage_proxy::clock_type::time_point timeout) {
+    // If batcher is set, the initial requests to remote replicas are only
+    // sent when it is flushed. Later ones (speculative retries, read repair)
+    // are sent right away.
+    future<result<foreign_ptr<lw_shared_ptr<query::result>>>> execute(storage_proxy::clock_type::time_point timeout, ::shared_ptr<read_request_batcher> batcher = nullptr) {
         if (_targets.empty()) {
             // We may have no targets to read from if a DC with zero replication is queried with LOCACL_QUORUM.
             // Return an empty result in this case
@@ -5619,7 +5884,9 @@ class abstract_read_executor : public enable_shared_from_this<abstract_read_exec
                 db::is_datacenter_local(_cl) ? _effective_replication_map_ptr->get_topology().count_local_endpoints(_targets): _targets.size(), timeout);
         auto exec = shared_from_this();
 
+        _batcher = std::move(batcher);
         make_requests(digest_resolver, timeout);
+        _batcher = nullptr;
 
         // Waited on indirectly.
         (void)digest_resolver->has_cl().then_wrapped([exec, digest_resolver, timeout] (future<result<digest_read_result>> f) mutable {
@@ -5710,9 +5977,15 @@ class abstract_read_executor : public enable_shared_from_this<abstract_read_exec
         return _max_request_latency;
     }
 
+protected:
+    // Called when a request to `ep` succeeds.
+    virtual void on_request_completed(locator::host_id ep) {}
+
 private:
-    void register_request_latency(latency_clock::duration d) {
+    void register_request_latency(locator::host_id ep, latency_clock::duration d) {
         _max_request_latency = std::max(_max_request_latency, d);
+        _proxy->register_replica_read_latency(ep, std::chrono::duration_cast<std::chrono::microseconds>(d));
+        on_request_completed(ep);
     }
 
     static constexpr latency_clock::duration NO_LATENCY{-1};
@@ -5752,6 +6025,24 @@ class always_speculating_read_executor : public abstract_read_executor {
 // this executor sends request to an additional replica after some time below timeout
 class speculating_read_executor : public abstract_read_executor {
     timer<storage_proxy::clock_type> _speculate_timer;
+    bool _speculated = false;
+
+    // With adaptive speculative retry, the extra replica is asked once the
+    // slowest of the other replicas takes longer than the percentile of its
+    // own recent latencies, so that reads are retried when a replica is
+    // slower than usual, rather than whenever it is slower than the table.
+    // Disengaged if some of the replicas have too few recent latencies.
+    std::optional<std::chrono::microseconds> adaptive_speculation_delay(double percentile) const {
+        std::chrono::microseconds delay{0};
+        for (const auto& ep : std::ranges::subrange(_targets.begin(), _targets.end() - 1)) {
+            auto latency = _proxy->get_replica_read_latency_percentile(ep, percentile);
+            if (!latency) {
+                return std::nullopt;
+            }
+            delay = std::max(delay, *latency);
+        }
+        return delay;
+    }
 public:
     using abstract_read_executor::abstract_read_executor;
     virtual void make_requests(digest_resolver_ptr resolver, storage_proxy::clock_type::time_point timeout) override {
@@ -5761,8 +6052,24 @@ class speculating_read_executor : public abstract_read_executor {
                                               ", required at least 2 replicas",
                                               _targets.size()));
         }
-        _speculate_timer.set_callback([this, resolver, timeout] {
+        auto& sr = _schema->speculative_retry();
+        const auto max_delay = std::chrono::milliseconds(_proxy->get_db().local().get_config().read_request_timeout_in_ms()/2);
+        std::optional<std::chrono::microseconds> adaptive_delay;
+        if (sr.get_type() == speculative_retry::type::PERCENTILE && _proxy->get_db().local().get_config().adaptive_speculative_retry()) {
+            _proxy->add_speculative_retry_budget();
+            adaptive_delay = adaptive_speculation_delay(sr.get_value());
+        }
+        _speculate_timer.set_callback([this, resolver, timeout, adaptive = bool(adaptive_delay)] {
             if (!resolver->is_completed()) { // at the time the callback runs request may be completed already
+                if (adaptive) {
+                    if (!_proxy->consume_speculative_retry_budget()) {
+                        _proxy->get_stats().speculative_reads_over_budget++;
+                        tracing::trace(_trace_state, "Not launching speculative retry, over budget");
+                        return;
+                    }
+                    _proxy->get_stats().adaptive_speculative_reads++;
+                }
+                _speculated = true;
                 resolver->add_wait_targets(1); // we send one more request so wait for it too
                 // FIXME: consider disabling for CL=*ONE
                 auto send_request = [&] (bool has_data) {
@@ -5779,11 +6086,14 @@ class speculating_read_executor : public abstract_read_executor {
                 send_request(resolver->has_data());
             }
         });
-        auto& sr = _schema->speculative_retry();
-        auto t = (sr.get_type() == speculative_retry::type::PERCENTILE) ?
-            std::min(_cf->get_coordinator_read_latency_percentile(sr.get_value()), std::chrono::milliseconds(_proxy->get_db().local().get_config().read_request_timeout_in_ms()/2)) :
-            std::chrono::milliseconds(unsigned(sr.get_value()));
-        _speculate_timer.arm(t);
+        if (adaptive_delay) {
+            _speculate_timer.arm(std::min<std::chrono::microseconds>(*adaptive_delay, max_delay));
+        } else {
+            auto t = (sr.get_type() == speculative_retry::type::PERCENTILE) ?
+                std::min(_cf->get_coordinator_read_latency_percentile(sr.get_value()), max_delay) :
+                std::chrono::milliseconds(unsigned(sr.get_value()));
+            _speculate_timer.arm(t);
+        }
 
         // if CL + RR result in covering all replicas, getReadExecutor forces AlwaysSpeculating.  So we know
         // that the last replica in our list is "extra."
@@ -5806,7 +6116,18 @@ class speculating_read_executor : public abstract_read_executor {
     virtual void got_cl() override {
         _speculate_timer.cancel();
     }
+    virtual void on_request_completed(locator::host_id ep) override {
+        // The extra replica is the last one. It won if some of the others
+        // haven't replied yet.
+        if (_speculated && ep == _targets.back()) {
+            _speculated = false;
+            if (_used_targets.size() < _targets.size()) {
+                _proxy->get_stats().speculative_reads_won++;
+            }
+        }
+    }
     virtual void adjust_targets_for_reconciliation() override {
+        _speculated = false;
         _targets = used_targets();
     }
 };
@@ -5915,10 +6236,50 @@ storage_proxy::query_result_local_digest(locator::effective_replication_map_ptr
     });
 }
 
+future<rpc::tuple<std::vector<query::result>, std::vector<cache_temperature>>>
+storage_proxy::query_result_local_batch(locator::effective_replication_map_ptr erm, schema_ptr query_schema, lw_shared_ptr<query::read_command> cmd, dht::partition_range_vector prs,
+        query::result_options opts, tracing::trace_state_ptr trace_state, storage_proxy::clock_type::time_point timeout) {
+    tracing::trace(trace_state, "Start querying {} singular ranges", prs.size());
+    std::vector<query::result> results(prs.size());
+    std::vector<cache_temperature> hit_rates(prs.size(), cache_temperature::invalid());
+    co_await coroutine::parallel_for_each(std::views::iota(size_t(0), prs.size()), [&] (size_t i) -> future<> {
+        auto [result, hit_rate] = co_await query_result_local(erm, query_schema, cmd, prs[i], opts, trace_state, timeout, std::monostate());
+        // The results are sent back by value, copy them out of the shards that produced them.
+        results[i] = query::result(bytes_ostream(result->buf()), result->digest(), result->last_modified(), result->is_short_read(),
+                result->row_count_low_bits(), result->partition_count(), result->row_count_high_bits(), result->last_position());
+        hit_rates[i] = hit_rate;
+    });
+    co_return rpc::tuple{std::move(results), std::move(hit_rates)};
+}
+
+future<rpc::tuple<std::vector<query::result_digest>, std::vector<api::timestamp_type>, std::vector<cache_temperature>, std::vector<std::optional<full_position>>>>
+storage_proxy::query_result_local_digest_batch(locator::effective_replication_map_ptr erm, schema_ptr query_schema, lw_shared_ptr<query::read_command> cmd, dht::partition_range_vector prs,
+        tracing::trace_state_ptr trace_state, storage_proxy::clock_type::time_point timeout, query::digest_algorithm da) {
+    tracing::trace(trace_state, "Start querying digests of {} singular ranges", prs.size());
+    std::vector<query::result_digest> digests(prs.size());
+    std::vector<api::timestamp_type> last_modified(prs.size(), api::missing_timestamp);
+    std::vector<cache_temperature> hit_rates(prs.size(), cache_temperature::invalid());
+    std::vector<std::optional<full_position>> last_positions(prs.size());
+    co_await coroutine::parallel_for_each(std::views::iota(size_t(0), prs.size()), [&] (size_t i) -> future<> {
+        auto [digest, t, hit_rate, last_position] = co_await query_result_local_digest(erm, query_schema, cmd, prs[i], trace_state, timeout, da, std::monostate());
+        digests[i] = digest;
+        last_modified[i] = t;
+        hit_rates[i] = hit_rate;
+        last_positions[i] = std::move(last_position);
+    });
+    co_return rpc::tuple{std::move(digests), std::move(last_modified), std::move(hit_rates), std::move(last_positions)};
+}
+
 future<rpc::tuple<foreign_ptr<lw_shared_ptr<query::result>>, cache_temperature>>
 storage_proxy::query_result_local(locator::effective_replication_map_ptr erm, schema_ptr query_schema, lw_shared_ptr<query::read_command> cmd, const dht::partition_range& pr, query::result_options opts,
                                   tracing::trace_state_ptr trace_state, storage_proxy::clock_type::time_point timeout, db::per_partition_rate_limit::info rate_limit_info) {
     cmd->slice.options.set_if<query::partition_slice::option::with_digest>(opts.request != query::result_request::only_result);
+    if (cmd->slice.options.contains<query::partition_slice::option::bypass_cache>()) {
+        // The command may be shared with mutation queries, e.g. the ones of read
+        // repair, which need the values of all columns, so it's copied.
+        cmd = make_lw_shared<query::read_command>(*cmd);
+        cmd->slice.options.set<query::partition_slice::option::skip_unselected_column_values>();
+    }
     if (auto shard_opt = dht::is_single_shard(erm->get_sharder(*query_schema), *query_schema, pr)) {
         auto shard = *shard_opt;
         get_stats().replica_cross_shard_ops += shard != this_shard_id();
@@ -6047,9 +6408,18 @@ storage_proxy::query_singular(lw_shared_ptr<query::read_command> cmd,
                 handle_completion(exec[0]);
             }
         } else {
+            // Each partition is read by its own executor, but their requests to
+            // the same replica are sent in a single RPC. Per-partition rate
+            // limiting is accounted per request, so such reads are not batched.
+            // Nodes which support batched reads support native reversed queries,
+            // so the command never has to be converted to the legacy format.
+            ::shared_ptr<read_request_batcher> batcher;
+            if (features().replica_batched_reads && !(cmd->allow_limit && _db.local().can_apply_per_partition_rate_limit(*schema, db::operation_type::read))) {
+                batcher = ::make_shared<read_request_batcher>(p, cmd, get_fence(*erm), query_options.trace_state, timeout);
+            }
             auto mapper = [&] (
                     std::pair<::shared_ptr<abstract_read_executor>, dht::token_range>& executor_and_token_range) -> future<::result<foreign_ptr<lw_shared_ptr<query::result>>>> {
-                auto result = co_await executor_and_token_range.first->execute(timeout);
+                auto result = co_await executor_and_token_range.first->execute(timeout, batcher);
                 // Handle success here. Failure is handled (only once) just outside the try..catch.
                 if (result) {
                     handle_completion(executor_and_token_range);
@@ -6058,7 +6428,12 @@ storage_proxy::query_singular(lw_shared_ptr<query::read_command> cmd,
             };
             query::result_merger merger(cmd->get_row_limit(), cmd->partition_limit);
             merger.reserve(exec.size());
-            result = co_await utils::result_map_reduce(exec.begin(), exec.end(), std::move(mapper), std::move(merger));
+            // All executors make their initial requests before map_reduce returns.
+            auto f = utils::result_map_reduce(exec.begin(), exec.end(), std::move(mapper), std::move(merger));
+            if (batcher) {
+                batcher->flush();
+            }
+            result = co_await std::move(f);
         }
     } catch(...) {
         handle_read_error(std::current_exception(), false);
@@ -7072,6 +7447,7 @@ void storage_proxy::on_leave_cluster(const gms::inet_address& endpoint, const lo
     // Discarding these futures is safe. They're awaited by db::hints::manager::stop().
     (void) _hints_manager.drain_for(hid, endpoint);
     (void) _hints_for_views_manager.drain_for(hid, endpoint);
+    _replica_read_latencies.erase(hid);
 }
 
 void storage_proxy::cancel_write_handlers(noncopyable_function<bool(const abstract_write_response_handler&)> filter_fun) {
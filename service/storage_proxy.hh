@@ -90,6 +90,7 @@ namespace paxos {
 class abstract_write_response_handler;
 class paxos_response_handler;
 class abstract_read_executor;
+class read_request_batcher;
 class mutation_holder;
 class client_state;
 class migration_manager;
@@ -313,6 +314,16 @@ class storage_proxy : public seastar::async_sharded_service<storage_proxy>, publ
             coordinator_mutate_options> _mutate_stage;
     db::view::node_update_backlog& _max_view_update_backlog;
     std::unordered_map<locator::host_id, view_update_backlog_timestamped> _view_update_backlogs;
+    // Recent latencies, in microseconds, of the read requests sent to each
+    // replica, for adaptive speculative retry.
+    struct replica_read_latency {
+        utils::estimated_histogram histogram;
+        lowres_clock::time_point decayed_at = lowres_clock::now();
+    };
+    std::unordered_map<locator::host_id, replica_read_latency> _replica_read_latencies;
+    // The number of speculative reads adaptive speculative retry may send,
+    // see the speculative_retry_budget option.
+    double _speculative_retry_budget = 0;
 
     //NOTICE(sarna): This opaque pointer is here just to avoid moving write handler class definitions from .cc to .hh. It's slow path.
     class cancellable_write_handlers_list;
@@ -425,6 +436,25 @@ class storage_proxy : public seastar::async_sharded_service<storage_proxy>, publ
             clock_type::time_point timeout,
             query::digest_algorithm da,
             db::per_partition_rate_limit::info rate_limit_info);
+    // Like query_result_local() and query_result_local_digest(), but for
+    // several singular ranges at once, which are read concurrently.
+    future<rpc::tuple<std::vector<query::result>, std::vector<cache_temperature>>> query_result_local_batch(
+            locator::effective_replication_map_ptr,
+            schema_ptr,
+            lw_shared_ptr<query::read_command> cmd,
+            dht::partition_range_vector prs,
+            query::result_options opts,
+            tracing::trace_state_ptr trace_state,
+            clock_type::time_point timeout);
+    future<rpc::tuple<std::vector<query::result_digest>, std::vector<api::timestamp_type>, std::vector<cache_temperature>, std::vector<std::optional<full_position>>>>
+    query_result_local_digest_batch(
+            locator::effective_replication_map_ptr,
+            schema_ptr,
+            lw_shared_ptr<query::read_command> cmd,
+            dht::partition_range_vector prs,
+            tracing::trace_state_ptr trace_state,
+            clock_type::time_point timeout,
+            query::digest_algorithm da);
     future<result<coordinator_query_result>> query_partition_key_range(lw_shared_ptr<query::read_command> cmd,
             dht::partition_range_vector partition_ranges,
             db::consistency_level cl,
@@ -568,6 +598,16 @@ class storage_proxy : public seastar::async_sharded_service<storage_proxy>, publ
 private:
     bool only_me(const locator::effective_replication_map& erm, const host_id_vector_replica_set& replicas) const noexcept;
 
+    void register_replica_read_latency(locator::host_id replica, std::chrono::microseconds latency);
+    // The latency at the given percentile (between 0 and 1) of the recent
+    // reads from the replica. Disengaged if too few of them were measured.
+    std::optional<std::chrono::microseconds> get_replica_read_latency_percentile(locator::host_id replica, double percentile) const;
+    // Called for each read which may speculate adaptively.
+    void add_speculative_retry_budget();
+    // Returns whether adaptive speculative retry may send another
+    // speculative read, and takes it from the budget if so.
+    bool consume_speculative_retry_budget();
+
     // Throws an error if remote is not initialized.
     const struct remote& remote() const;
     struct remote& remote();
@@ -792,6 +832,7 @@ class storage_proxy : public seastar::async_sharded_service<storage_proxy>, publ
     virtual void on_down(const gms::inet_address& endpoint, locator::host_id hid) override;
 
     friend class abstract_read_executor;
+    friend class read_request_batcher;
     friend class abstract_write_response_handler;
     friend class speculating_read_executor;
     friend class view_update_backlog_broker;
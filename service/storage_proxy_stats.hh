@@ -158,6 +158,8 @@ struct stats : public write_stats {
     uint64_t replica_data_reads = 0;
     uint64_t replica_digest_reads = 0;
     uint64_t replica_mutation_data_reads = 0;
+    // number of batched read requests received as a replica, each for several partitions
+    uint64_t replica_batched_reads = 0;
 
     uint64_t replica_cross_shard_ops = 0;
 
@@ -170,6 +172,9 @@ struct stats : public write_stats {
     uint64_t read_retries = 0; // read is retried with new limit
     uint64_t speculative_digest_reads = 0;
     uint64_t speculative_data_reads = 0;
+    uint64_t adaptive_speculative_reads = 0; // included in speculative_{digest,data}_reads
+    uint64_t speculative_reads_won = 0;
+    uint64_t speculative_reads_over_budget = 0;
 
     uint64_t cas_read_unfinished_commit = 0;
     uint64_t cas_foreground = 0;
@@ -0,0 +1,181 @@
+/*
+ * Copyright (C) 2026-present ScyllaDB
+ */
+
+/*
+ * SPDX-License-Identifier: LicenseRef-ScyllaDB-Source-Available-1.0
+ */
+
+#include <seastar/core/byteorder.hh>
+#include <seastar/core/coroutine.hh>
+#include <seastar/core/fstream.hh>
+#include <seastar/core/thread.hh>
+
+#include "sstables/attached_index.hh"
+#include "sstables/exceptions.hh"
+#include "sstables/writer.hh"
+#include "schema/schema.hh"
+
+namespace sstables {
+
+attached_index_writer::attached_index_writer(std::vector<const column_definition*> columns, file_writer writer, sstable_version_types version)
+    : _version(version)
+    , _writer(std::make_unique<file_writer>(std::move(writer)))
+{
+    _columns.reserve(columns.size());
+    for (auto* cdef : columns) {
+        auto& c = _columns.emplace_back(column{.cdef = cdef});
+        c.directory.column_name.value = cdef->name();
+    }
+}
+
+attached_index_writer::~attached_index_writer() = default;
+
+void attached_index_writer::consume_new_partition(const dht::decorated_key& dk) {
+    _token = dht::token::to_int64(dk.token());
+}
+
+void attached_index_writer::consume(const column_definition& cdef, atomic_cell_view cell) {
+    if (!cell.is_live()) {
+        return;
+    }
+    auto it = std::ranges::find(_columns, cdef.id, [] (const column& c) { return c.cdef->id; });
+    if (it == _columns.end()) {
+        return;
+    }
+    auto value = to_bytes(cell.value());
+    // Rows of a partition often share values; there is no need to buffer more than one entry for them.
+    if (!it->entries.empty() && it->entries.back().token == _token && it->entries.back().value == value) {
+        return;
+    }
+    _memory += sizeof(entry) + value.size();
+    it->entries.push_back(entry{.value = std::move(value), .token = _token});
+    if (_memory > max_segment_memory) {
+        write_segments();
+    }
+}
+
+void attached_index_writer::write_segment(column& c) {
+    if (c.entries.empty()) {
+        return;
+    }
+    const auto& type = *c.cdef->type;
+    std::ranges::sort(c.entries, [&type] (const entry& a, const entry& b) {
+        auto cmp = type.compare(a.value, b.value);
+        return cmp != 0 ? cmp < 0 : a.token < b.token;
+    });
+
+    auto& segment = c.directory.segments.elements.emplace_back();
+    auto& blocks = segment.blocks.elements;
+    auto close_block = [&] {
+        if (!blocks.empty()) {
+            blocks.back().size = _writer->offset() - blocks.back().offset;
+        }
+    };
+    size_t block_entries = 0;
+    const entry* prev = nullptr;
+    for (const auto& e : c.entries) {
+        if (prev && prev->token == e.token && type.equal(prev->value, e.value)) {
+            continue;
+        }
+        if (blocks.empty() || block_entries == entries_per_block) {
+            close_block();
+            blocks.push_back(attached_index_block{.first_value = {e.value}, .offset = _writer->offset()});
+            block_entries = 0;
+            seastar::thread::maybe_yield();
+        }
+        auto value = disk_string_view<uint32_t>();
+        value.value = bytes_view(e.value);
+        write(_version, *_writer, value, e.token);
+        ++block_entries;
+        prev = &e;
+    }
+    close_block();
+    c.entries.clear();
+}
+
+void attached_index_writer::write_segments() {
+    for (auto& c : _columns) {
+        write_segment(c);
+    }
+    _memory = 0;
+}
+
+uint64_t attached_index_writer::finish() {
+    write_segments();
+    uint64_t directory_offset = _writer->offset();
+    attached_index_directory directory;
+    for (auto& c : _columns) {
+        directory.columns.elements.push_back(std::move(c.directory));
+    }
+    write(_version, *_writer, directory, directory_offset);
+    auto size = _writer->offset();
+    _writer->close();
+    return size;
+}
+
+attached_index::attached_index(attached_index_directory directory)
+    : _directory(std::move(directory))
+{}
+
+const attached_index_column* attached_index::find_column(const column_definition& cdef) const {
+    auto it = std::ranges::find_if(_directory.columns.elements, [&] (const attached_index_column& c) {
+        return c.column_name.value == cdef.name();
+    });
+    return it == _directory.columns.elements.end() ? nullptr : &*it;
+}
+
+future<utils::chunked_vector<dht::token>> attached_index::lookup(file f, const attached_index_column& column, const abstract_type& type,
+        const interval<bytes>& values, const dht::token_range& range) {
+    auto cmp = [&type] (const bytes& a, const bytes& b) {
+        return type.compare(a, b);
+    };
+    utils::chunked_vector<dht::token> tokens;
+    for (const auto& segment : column.segments.elements) {
+        const auto& blocks = segment.blocks.elements;
+        // A block starts with its smallest value, so values in the range can
+        // only be in the blocks starting in the range, and the one before them.
+        auto end = std::partition_point(blocks.begin(), blocks.end(), [&] (const attached_index_block& b) {
+            return !values.after(b.first_value.value, cmp);
+        });
+        auto begin = std::partition_point(blocks.begin(), end, [&] (const attached_index_block& b) {
+            return values.before(b.first_value.value, cmp);
+        });
+        if (begin != blocks.begin()) {
+            --begin;
+        }
+        if (begin == end) {
+            continue;
+        }
+        const auto& last = *std::prev(end);
+        auto in = make_file_input_stream(f, begin->offset, last.offset + last.size - begin->offset, {.buffer_size = 32 * 1024, .read_ahead = 1});
+        std::exception_ptr ex;
+        try {
+            while (auto size = co_await in.read_exactly(sizeof(uint32_t))) {
+                if (size.size() != sizeof(uint32_t)) {
+                    throw malformed_sstable_exception("truncated entry of attached index");
+                }
+                auto value_size = read_be<uint32_t>(size.get());
+                auto value = co_await in.read_exactly(value_size);
+                auto token = co_await in.read_exactly(sizeof(int64_t));
+                if (value.size() != value_size || token.size() != sizeof(int64_t)) {
+                    throw malformed_sstable_exception("truncated entry of attached index");
+                }
+                auto t = dht::token::from_int64(read_be<int64_t>(token.get()));
+                if (values.contains(bytes(reinterpret_cast<const bytes::value_type*>(value.get()), value.size()), cmp)
+                        && range.contains(t, dht::token_comparator())) {
+                    tokens.push_back(t);
+                }
+            }
+        } catch (...) {
+            ex = std::current_exception();
+        }
+        co_await in.close();
+        if (ex) {
+            std::rethrow_exception(std::move(ex));
+        }
+    }
+    co_return tokens;
+}
+
+} // namespace sstables
@@ -0,0 +1,100 @@
+/*
+ * Copyright (C) 2026-present ScyllaDB
+ */
+
+/*
+ * SPDX-License-Identifier: LicenseRef-ScyllaDB-Source-Available-1.0
+ */
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include <seastar/core/file.hh>
+
+#include "dht/decorated_key.hh"
+#include "dht/token.hh"
+#include "utils/interval.hh"
+#include "mutation/atomic_cell.hh"
+#include "schema/schema_fwd.hh"
+#include "sstables/types.hh"
+#include "utils/chunked_vector.hh"
+
+namespace sstables {
+
+class file_writer;
+
+// An sstable-attached index maps the values of a regular column of an sstable
+// to the tokens of the partitions which have them, so that filtering range
+// scans can read only the partitions which may match instead of their whole
+// token range. The indexes are declared with CREATE CUSTOM INDEX ... USING
+// 'sstable_index' (see secondary_index::sstable_index) and built by the
+// sstable writer, i.e. when memtables are flushed and sstables compacted.
+//
+// The AttachedIndex component holds, for each indexed column, one or more
+// segments: runs of (value, token) entries sorted by value, in the order of
+// the column's type, and token. Each entry is the value as a
+// disk_string<uint32_t> followed by the token as an int64_t. The entries of a
+// segment are split into blocks, located by an attached_index_directory
+// written after them. The component ends with the offset of the directory,
+// as an uint64_t.
+//
+// The index has an entry for every live cell written to the sstable, so it
+// may list partitions whose values were overwritten or deleted since, but
+// never misses a partition whose current value is in the sstable.
+
+// Builds the AttachedIndex component of an sstable while it is written.
+class attached_index_writer {
+public:
+    // Buffered entries are written as a segment when they use more memory
+    // than this. It also bounds the time spent sorting them.
+    static constexpr size_t max_segment_memory = 1 << 20;
+    static constexpr size_t entries_per_block = 128;
+private:
+    struct entry {
+        bytes value;
+        int64_t token;
+    };
+    struct column {
+        const column_definition* cdef;
+        utils::chunked_vector<entry> entries;
+        attached_index_column directory;
+    };
+
+    sstable_version_types _version;
+    std::unique_ptr<file_writer> _writer;
+    std::vector<column> _columns;
+    int64_t _token = 0;
+    size_t _memory = 0;
+
+    void write_segment(column&);
+    void write_segments();
+public:
+    attached_index_writer(std::vector<const column_definition*> columns, file_writer writer, sstable_version_types version);
+    ~attached_index_writer();
+
+    void consume_new_partition(const dht::decorated_key&);
+    // Only live cells of indexed columns are added to the index.
+    void consume(const column_definition&, atomic_cell_view);
+    // Writes the buffered entries and the directory, and closes the
+    // component. Returns its size.
+    uint64_t finish();
+};
+
+// The directory of the AttachedIndex component of an sstable.
+class attached_index {
+    attached_index_directory _directory;
+public:
+    explicit attached_index(attached_index_directory directory);
+
+    const attached_index_column* find_column(const column_definition&) const;
+
+    // Returns the tokens, in `range`, of the partitions which have a value
+    // of the column in `values`, reading the entries from `f`, the
+    // AttachedIndex component. The tokens are unordered and may repeat.
+    static future<utils::chunked_vector<dht::token>> lookup(file f, const attached_index_column& column, const abstract_type& type,
+            const interval<bytes>& values, const dht::token_range& range);
+};
+
+} // namespace sstables
@@ -0,0 +1,114 @@
+/*
+ * Copyright (C) 2026-present ScyllaDB
+ */
+
+/*
+ * SPDX-License-Identifier: LicenseRef-ScyllaDB-Source-Available-1.0
+ */
+
+#include <seastar/core/coroutine.hh>
+#include <seastar/coroutine/maybe_yield.hh>
+
+#include "sstables/chunk_cache.hh"
+#include "utils/assert.hh"
+
+namespace sstables {
+
+chunk_cache::cached_chunk::cached_chunk(chunk_cache* parent, offset_type offset, const temporary_buffer<char>& data)
+    : parent(parent)
+    , offset(offset)
+    , buf(parent->_region.alloc_buf(data.size()))
+{
+    std::copy(data.begin(), data.end(), buf.get());
+}
+
+void chunk_cache::cached_chunk::on_evicted() noexcept {
+    parent->on_evicted(*this);
+    with_allocator(standard_allocator(), [this] {
+        cache_type::iterator it(this);
+        it.erase(offset_less_comparator());
+    });
+}
+
+chunk_cache::chunk_cache(chunk_cache_stats& stats, lru& l, logalloc::region& r)
+    : _stats(stats)
+    , _lru(l)
+    , _region(r)
+    , _cache(offset_less_comparator())
+{ }
+
+chunk_cache::~chunk_cache() {
+    with_allocator(standard_allocator(), [this] {
+        auto it = _cache.begin();
+        while (it != _cache.end()) {
+            _lru.remove(*it);
+            on_evicted(*it);
+            it = it.erase(offset_less_comparator());
+        }
+    });
+    SCYLLA_ASSERT(_cache.empty());
+}
+
+void chunk_cache::on_evicted(cached_chunk& c) noexcept {
+    _stats.cached_bytes -= c.size_in_allocator();
+    _cached_bytes -= c.size_in_allocator();
+    ++_stats.evictions;
+}
+
+std::optional<temporary_buffer<char>> chunk_cache::get(offset_type offset) {
+    auto it = _cache.find(offset);
+    if (it == _cache.end()) {
+        ++_stats.misses;
+        return std::nullopt;
+    }
+    ++_stats.hits;
+    cached_chunk& c = *it;
+    // Allocating the copy may run the reclaimer, which must not evict the chunk.
+    _lru.remove(c);
+    temporary_buffer<char> out;
+    try {
+        out = temporary_buffer<char>(c.buf.size());
+    } catch (...) {
+        _lru.add(c);
+        throw;
+    }
+    std::copy(c.buf.get(), c.buf.get() + c.buf.size(), out.get_write());
+    _lru.add(c);
+    return out;
+}
+
+void chunk_cache::populate(offset_type offset, const temporary_buffer<char>& data) noexcept {
+    try {
+        // _cache.emplace() needs to run under allocating section even though it lives in the std space
+        // because bplus::tree operations are not reentrant, so we need to prevent memory reclamation.
+        auto [it, inserted] = _as(_region, [&] {
+            return with_allocator(standard_allocator(), [&] {
+                return _cache.emplace(offset, this, offset, data);
+            });
+        });
+        if (inserted) {
+            ++_stats.populations;
+            _stats.cached_bytes += it->size_in_allocator();
+            _cached_bytes += it->size_in_allocator();
+            _lru.add(*it);
+        }
+    } catch (const std::bad_alloc&) {
+        // Not caching the chunk is not an error.
+    }
+}
+
+future<> chunk_cache::evict_gently() {
+    auto it = _cache.begin();
+    while (it != _cache.end()) {
+        _lru.remove(*it);
+        on_evicted(*it);
+        it = it.erase(offset_less_comparator());
+        if (need_preempt() && it != _cache.end()) {
+            auto key = it->offset;
+            co_await coroutine::maybe_yield();
+            it = _cache.lower_bound(key);
+        }
+    }
+}
+
+} // namespace sstables
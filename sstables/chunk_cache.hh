@@ -0,0 +1,100 @@
+/*
+ * Copyright (C) 2026-present ScyllaDB
+ */
+
+/*
+ * SPDX-License-Identifier: LicenseRef-ScyllaDB-Source-Available-1.0
+ */
+
+#pragma once
+
+#include <optional>
+
+#include <seastar/core/future.hh>
+#include <seastar/core/temporary_buffer.hh>
+
+#include "seastarx.hh"
+#include "sstables/chunk_cache_stats.hh"
+#include "utils/bptree.hh"
+#include "utils/logalloc.hh"
+#include "utils/lru.hh"
+
+namespace sstables {
+
+/// \brief A cache of decompressed chunks of a compressed Data.db file.
+///
+/// Chunks are identified by their offset in the compressed file, so a
+/// chunk_cache belongs to a single sstable. Contents live in the LSA region
+/// of the cache_tracker and are evicted by its LRU, together with the row cache
+/// and the index caches, or manually using evict_gently(), or when the object
+/// is destroyed.
+///
+/// Readers which consume a chunk at most once, like compaction, should not
+/// populate the cache, or they would evict the working set of other readers.
+class chunk_cache {
+public:
+    using offset_type = uint64_t;
+private:
+    class cached_chunk final : public evictable {
+    public:
+        chunk_cache* parent;
+        offset_type offset;
+        logalloc::lsa_buffer buf;
+    public:
+        cached_chunk(chunk_cache* parent, offset_type offset, const temporary_buffer<char>& data);
+
+        cached_chunk(cached_chunk&&) noexcept {
+            // Required by the bplus::tree, but entries are never moved. See cached_file::cached_page.
+            abort();
+        }
+
+        size_t size_in_allocator() const noexcept {
+            return buf.size();
+        }
+
+        void on_evicted() noexcept override;
+    };
+
+    struct offset_less_comparator {
+        bool operator()(offset_type lhs, offset_type rhs) const noexcept {
+            return lhs < rhs;
+        }
+    };
+
+    using cache_type = bplus::tree<offset_type, cached_chunk, offset_less_comparator, 12, bplus::key_search::linear>;
+
+    chunk_cache_stats& _stats;
+    lru& _lru;
+    logalloc::region& _region;
+    logalloc::allocating_section _as;
+    cache_type _cache;
+    size_t _cached_bytes = 0;
+
+    void on_evicted(cached_chunk&) noexcept;
+public:
+    chunk_cache(chunk_cache_stats&, lru&, logalloc::region&);
+    chunk_cache(chunk_cache&&) = delete; // captured this
+    ~chunk_cache();
+
+    /// \brief Returns a copy of the decompressed chunk which starts at
+    /// given offset in the compressed file, or a disengaged optional
+    /// if it is not cached.
+    std::optional<temporary_buffer<char>> get(offset_type offset);
+
+    /// \brief Inserts the decompressed chunk which starts at given offset
+    /// in the compressed file. Does nothing if the chunk is already cached.
+    ///
+    /// Failure to allocate memory for the chunk is not an error; the chunk
+    /// is just not cached.
+    void populate(offset_type offset, const temporary_buffer<char>& data) noexcept;
+
+    /// \brief Returns the number of bytes cached.
+    size_t cached_bytes() const noexcept {
+        return _cached_bytes;
+    }
+
+    // Evicts all chunks.
+    future<> evict_gently();
+};
+
+} // namespace sstables
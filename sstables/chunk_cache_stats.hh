@@ -0,0 +1,19 @@
+/*
+ * Copyright (C) 2026-present ScyllaDB
+ */
+
+/*
+ * SPDX-License-Identifier: LicenseRef-ScyllaDB-Source-Available-1.0
+ */
+
+#pragma once
+
+#include <cstdint>
+
+struct chunk_cache_stats {
+    uint64_t hits = 0; // Number of chunks served from cache
+    uint64_t misses = 0; // Number of chunks which had to be read and decompressed
+    uint64_t evictions = 0; // Number of chunks evicted from memory
+    uint64_t populations = 0; // Number of chunks inserted into the cache
+    uint64_t cached_bytes = 0; // Number of bytes chunks occupy in memory
+};
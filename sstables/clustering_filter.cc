@@ -0,0 +1,243 @@
+/*
+ * Copyright (C) 2026-present ScyllaDB
+ */
+
+/*
+ * SPDX-License-Identifier: LicenseRef-ScyllaDB-Source-Available-1.0
+ */
+
+#include <seastar/core/byteorder.hh>
+#include <seastar/core/thread.hh>
+
+#include "sstables/clustering_filter.hh"
+#include "sstables/sstables.hh"
+#include "schema/schema.hh"
+#include "utils/bloom_filter.hh"
+#include "utils/UUID_gen.hh"
+
+namespace sstables {
+
+// The finalizer of murmur3, mixes all bits of k into all bits of the result.
+static uint64_t fmix(uint64_t k) {
+    k ^= k >> 33;
+    k *= 0xff51afd7ed558ccdULL;
+    k ^= k >> 33;
+    k *= 0xc4ceb9fe1a85ec53ULL;
+    k ^= k >> 33;
+    return k;
+}
+
+// The hashes of (pk, bucket) pairs are derived from the hash of pk, so that
+// a read hashes the partition key once, however many buckets it checks.
+static utils::hashed_key bucket_key(const utils::hashed_key& pk, int64_t bucket) {
+    auto h = pk.hash();
+    auto b = fmix(uint64_t(bucket));
+    return utils::hashed_key({fmix(h[0] ^ b), fmix(h[1] + b)});
+}
+
+static utils::hashed_key whole_partition_key(const utils::hashed_key& pk) {
+    auto h = pk.hash();
+    return utils::hashed_key({fmix(h[1] ^ 0x9e3779b97f4a7c15ULL), fmix(h[0])});
+}
+
+std::optional<clustering_filter_bucketing> clustering_filter_bucketing::make(const schema& s, int64_t width) {
+    if (!s.clustering_key_size() || width <= 0) {
+        return std::nullopt;
+    }
+    switch (s.clustering_key_columns().front().type->without_reversed().get_kind()) {
+    case abstract_type::kind::byte:
+    case abstract_type::kind::short_kind:
+    case abstract_type::kind::int32:
+    case abstract_type::kind::long_kind:
+    case abstract_type::kind::timestamp:
+    case abstract_type::kind::simple_date:
+    case abstract_type::kind::time:
+    case abstract_type::kind::timeuuid:
+        return clustering_filter_bucketing(s.clustering_key_columns().front().type, width);
+    default:
+        return std::nullopt;
+    }
+}
+
+std::optional<int64_t> clustering_filter_bucketing::bucket_of(managed_bytes_view first_component) const {
+    auto v = to_bytes(first_component);
+    auto p = reinterpret_cast<const char*>(v.data());
+    auto value = [&] () -> std::optional<int64_t> {
+        switch (_type->without_reversed().get_kind()) {
+        case abstract_type::kind::byte:
+            return v.size() == 1 ? std::optional<int64_t>(int8_t(v[0])) : std::nullopt;
+        case abstract_type::kind::short_kind:
+            return v.size() == 2 ? std::optional<int64_t>(read_be<int16_t>(p)) : std::nullopt;
+        case abstract_type::kind::int32:
+            return v.size() == 4 ? std::optional<int64_t>(read_be<int32_t>(p)) : std::nullopt;
+        case abstract_type::kind::simple_date:
+            return v.size() == 4 ? std::optional<int64_t>(read_be<uint32_t>(p)) : std::nullopt;
+        case abstract_type::kind::long_kind:
+        case abstract_type::kind::timestamp:
+        case abstract_type::kind::time:
+            return v.size() == 8 ? std::optional<int64_t>(read_be<int64_t>(p)) : std::nullopt;
+        case abstract_type::kind::timeuuid:
+            return v.size() == 16 ? std::optional<int64_t>(utils::UUID_gen::unix_timestamp(utils::UUID_gen::get_UUID(v.data())).count()) : std::nullopt;
+        default:
+            return std::nullopt;
+        }
+    }();
+    if (!value) {
+        return std::nullopt;
+    }
+    // Rounds towards negative infinity, so that buckets are all equally wide.
+    auto bucket = *value / _width;
+    if (*value % _width < 0) {
+        --bucket;
+    }
+    return bucket;
+}
+
+std::optional<int64_t> clustering_filter_bucketing::bucket_of(const schema& s, const clustering_key_prefix& prefix) const {
+    if (prefix.is_empty(s)) {
+        return std::nullopt;
+    }
+    return bucket_of(*prefix.begin(s));
+}
+
+clustering_filter::clustering_filter(clustering_filter_bucketing bucketing, utils::filter_ptr filter)
+    : _bucketing(std::move(bucketing))
+    , _filter(std::move(filter))
+{ }
+
+std::unique_ptr<clustering_filter> clustering_filter::make(const schema& s, clustering_filter_metadata&& m) {
+    auto bucketing = clustering_filter_bucketing::make(s, m.bucket_width);
+    auto nr_bits = m.bitset.elements.size() * 64;
+    if (!bucketing || !nr_bits || nr_bits % utils::filter::split_block_bloom_filter::block_bits) {
+        return nullptr;
+    }
+    auto filter = utils::filter::create_filter(0, large_bitset(nr_bits, std::move(m.bitset.elements)), utils::filter_format::m_format,
+            utils::filter_layout::split_block);
+    return std::make_unique<clustering_filter>(std::move(*bucketing), std::move(filter));
+}
+
+bool clustering_filter::may_contain(const schema& s, const utils::hashed_key& pk, const query::clustering_row_ranges& ranges,
+        const position_range& bounds) const {
+    if (_filter->is_present(whole_partition_key(pk))) {
+        return true;
+    }
+    auto bucket_of = [&] (position_in_partition_view pos) -> std::optional<int64_t> {
+        return pos.has_key() ? _bucketing.bucket_of(s, pos.key()) : std::nullopt;
+    };
+    // Ranges are in clustering order, which is the reverse of the order of values for descending columns.
+    auto in_value_order = [&] (std::optional<int64_t> start, std::optional<int64_t> end) {
+        return _bucketing.reversed() ? std::pair(end, start) : std::pair(start, end);
+    };
+    auto [sst_lo, sst_hi] = in_value_order(bucket_of(bounds.start()), bucket_of(bounds.end()));
+    for (auto& r : ranges) {
+        auto [lo, hi] = in_value_order(
+                r.start() ? _bucketing.bucket_of(s, r.start()->value()) : std::nullopt,
+                r.end() ? _bucketing.bucket_of(s, r.end()->value()) : std::nullopt);
+        lo = lo && sst_lo ? std::max(lo, sst_lo) : (lo ? lo : sst_lo);
+        hi = hi && sst_hi ? std::min(hi, sst_hi) : (hi ? hi : sst_hi);
+        if (!lo || !hi) {
+            return true;
+        }
+        if (*lo > *hi) {
+            continue;
+        }
+        auto nr_buckets = uint64_t(*hi) - uint64_t(*lo) + 1;
+        if (!nr_buckets || nr_buckets > uint64_t(max_buckets_per_read)) {
+            return true;
+        }
+        for (uint64_t i = 0; i < nr_buckets; ++i) {
+            if (_filter->is_present(bucket_key(pk, int64_t(uint64_t(*lo) + i)))) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+size_t clustering_filter::memory_size() const {
+    return sizeof(*this) + _filter->memory_size();
+}
+
+clustering_filter_builder::clustering_filter_builder(const schema& s, clustering_filter_bucketing bucketing)
+    : _schema(s)
+    , _bucketing(std::move(bucketing))
+{ }
+
+std::optional<clustering_filter_builder> clustering_filter_builder::make(const schema& s) {
+    auto width = s.clustering_filter_bucket_width();
+    if (!width) {
+        return std::nullopt;
+    }
+    auto bucketing = clustering_filter_bucketing::make(s, *width);
+    if (!bucketing) {
+        return std::nullopt;
+    }
+    return std::make_optional<clustering_filter_builder>(s, std::move(*bucketing));
+}
+
+void clustering_filter_builder::add(utils::hashed_key key) {
+    if (_overflow) {
+        return;
+    }
+    if (_keys.size() == max_keys) {
+        _overflow = true;
+        _keys = {};
+        return;
+    }
+    _keys.push_back(key);
+}
+
+void clustering_filter_builder::consume_new_partition(const dht::decorated_key& dk) {
+    _partition_key = sstable::make_hashed_key(_schema, dk.key());
+    _last_bucket = std::nullopt;
+    _whole_partition = false;
+}
+
+void clustering_filter_builder::consume(tombstone partition_tombstone) {
+    if (partition_tombstone) {
+        consume_range_tombstone();
+    }
+}
+
+void clustering_filter_builder::consume(const clustering_key_prefix& ck) {
+    if (_whole_partition) {
+        return;
+    }
+    auto bucket = _bucketing.bucket_of(_schema, ck);
+    if (!bucket) {
+        consume_range_tombstone();
+        return;
+    }
+    // Rows come in clustering order, so all rows of a bucket are consecutive.
+    if (bucket != _last_bucket) {
+        _last_bucket = bucket;
+        add(bucket_key(_partition_key, *bucket));
+    }
+}
+
+void clustering_filter_builder::consume_range_tombstone() {
+    if (!_whole_partition) {
+        _whole_partition = true;
+        add(whole_partition_key(_partition_key));
+    }
+}
+
+std::optional<clustering_filter_metadata> clustering_filter_builder::build() {
+    if (_overflow || _keys.empty()) {
+        return std::nullopt;
+    }
+    auto fp_chance = std::min(_schema.bloom_filter_fp_chance(), 0.1);
+    auto filter = utils::filter::create_split_block_filter(_keys.size(), fp_chance, utils::filter_format::m_format);
+    auto& sbf = static_cast<utils::filter::split_block_bloom_filter&>(*filter);
+    for (auto& key : _keys) {
+        sbf.add(key);
+        seastar::thread::maybe_yield();
+    }
+    _keys = {};
+    return clustering_filter_metadata{
+        .bucket_width = _bucketing.width(),
+        .bitset = {sbf.bits().get_storage()},
+    };
+}
+
+} // namespace sstables
@@ -0,0 +1,103 @@
+/*
+ * Copyright (C) 2026-present ScyllaDB
+ */
+
+/*
+ * SPDX-License-Identifier: LicenseRef-ScyllaDB-Source-Available-1.0
+ */
+
+#pragma once
+
+#include <memory>
+#include <optional>
+
+#include "dht/decorated_key.hh"
+#include "mutation/position_in_partition.hh"
+#include "mutation/tombstone.hh"
+#include "query-request.hh"
+#include "schema/schema_fwd.hh"
+#include "sstables/types.hh"
+#include "utils/chunked_vector.hh"
+#include "utils/i_filter.hh"
+
+namespace sstables {
+
+// Maps values of the first clustering column to buckets of consecutive values,
+// preserving their order. Only possible for types whose values are integers,
+// see db::clustering_filter_extension.
+class clustering_filter_bucketing {
+    data_type _type;
+    int64_t _width;
+
+    clustering_filter_bucketing(data_type type, int64_t width) : _type(std::move(type)), _width(width) {}
+public:
+    // Disengaged if the first clustering column of the schema is not supported.
+    static std::optional<clustering_filter_bucketing> make(const schema&, int64_t width);
+
+    int64_t width() const noexcept { return _width; }
+    // True if the column is in descending clustering order, so buckets are too.
+    bool reversed() const noexcept { return _type->is_reversed(); }
+
+    // Disengaged for empty values.
+    std::optional<int64_t> bucket_of(managed_bytes_view first_component) const;
+    // Disengaged if the prefix is empty, or its first component is.
+    std::optional<int64_t> bucket_of(const schema&, const clustering_key_prefix&) const;
+};
+
+// A filter of the (partition key, clustering prefix bucket) pairs an sstable
+// has data for. Complements the sstable's min/max clustering metadata, which
+// covers all of its partitions, with per-partition information.
+//
+// Partitions which have a partition tombstone or range tombstones, for which
+// it is not worth tracking the buckets they cover, are added as a whole and
+// match any range.
+class clustering_filter {
+    clustering_filter_bucketing _bucketing;
+    utils::filter_ptr _filter;
+public:
+    // Reads which would need to check more buckets than this just read the sstable.
+    static constexpr int64_t max_buckets_per_read = 64;
+
+    clustering_filter(clustering_filter_bucketing, utils::filter_ptr);
+
+    // Disengaged if the first clustering column of the schema is not supported.
+    static std::unique_ptr<clustering_filter> make(const schema&, clustering_filter_metadata&&);
+
+    // Returns false if the sstable has certainly no data for the partition in
+    // any of the ranges. `bounds` are the min/max positions of the sstable,
+    // used for ranges which are not bounded on one of their sides.
+    bool may_contain(const schema&, const utils::hashed_key& pk, const query::clustering_row_ranges&, const position_range& bounds) const;
+
+    size_t memory_size() const;
+};
+
+// Collects the (partition key, clustering prefix bucket) pairs of an sstable while it is written.
+class clustering_filter_builder {
+    // No filter is built for sstables with more pairs than that, to bound the memory used for collecting them.
+    static constexpr size_t max_keys = 1 << 20;
+
+    const schema& _schema;
+    clustering_filter_bucketing _bucketing;
+    utils::chunked_vector<utils::hashed_key> _keys;
+    utils::hashed_key _partition_key{{0, 0}};
+    std::optional<int64_t> _last_bucket;
+    bool _whole_partition = false;
+    bool _overflow = false;
+
+    void add(utils::hashed_key);
+public:
+    clustering_filter_builder(const schema&, clustering_filter_bucketing);
+
+    // Engaged if the schema asks for a clustering filter and supports one.
+    static std::optional<clustering_filter_builder> make(const schema&);
+
+    void consume_new_partition(const dht::decorated_key&);
+    void consume(tombstone partition_tombstone);
+    void consume(const clustering_key_prefix&);
+    void consume_range_tombstone();
+
+    // Must be called in a seastar thread.
+    std::optional<clustering_filter_metadata> build();
+};
+
+} // namespace sstables
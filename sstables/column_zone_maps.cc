@@ -0,0 +1,142 @@
+/*
+ * Copyright (C) 2026-present ScyllaDB
+ */
+
+/*
+ * SPDX-License-Identifier: LicenseRef-ScyllaDB-Source-Available-1.0
+ */
+
+#include "sstables/column_zone_maps.hh"
+#include "sstables/sstables.hh"
+#include "schema/schema.hh"
+
+namespace sstables {
+
+column_zone_maps_collector::column_zone_maps_collector(const schema& s) {
+    _columns.resize(s.regular_columns_count());
+    for (const auto& cdef : s.regular_columns()) {
+        if (is_tracked(cdef)) {
+            _columns[cdef.id].emplace(column_range{.cdef = &cdef});
+        }
+    }
+}
+
+bool column_zone_maps_collector::is_tracked(const column_definition& cdef) {
+    // Durations have no total order.
+    return cdef.is_atomic() && !cdef.is_counter() && !cdef.type->references_duration();
+}
+
+void column_zone_maps_collector::update(const column_definition& cdef, atomic_cell_view cell) {
+    auto& col = _columns[cdef.id];
+    if (!col || col->too_large || !cell.is_live()) {
+        return;
+    }
+    auto value = cell.value();
+    if (value.size_bytes() > max_value_size) {
+        col->too_large = true;
+        return;
+    }
+    auto& type = *cdef.type;
+    if (!col->value_count || type.compare(value, col->min) < 0) {
+        col->min = to_bytes(value);
+    }
+    if (!col->value_count || type.compare(value, col->max) > 0) {
+        col->max = to_bytes(value);
+    }
+    ++col->value_count;
+}
+
+scylla_metadata::column_zone_maps column_zone_maps_collector::build() const {
+    scylla_metadata::column_zone_maps ret;
+    for (const auto& col : _columns) {
+        if (!col || col->too_large) {
+            continue;
+        }
+        ret.elements.push_back(column_zone_map{
+            .column_name = {col->cdef->name()},
+            .min = {col->min},
+            .max = {col->max},
+            .value_count = col->value_count,
+            .null_count = _rows - std::min(col->value_count, _rows),
+        });
+    }
+    return ret;
+}
+
+bool column_zone_maps_may_contain(const scylla_metadata::column_zone_maps& zone_maps, const schema& s, const query::column_value_range& range) {
+    const auto& cdef = s.regular_column_at(range.id);
+    // A column may have been dropped and added back with another type since
+    // the sstable was written; we can't compare the values then.
+    if (s.dropped_columns().contains(cdef.name_as_text())) {
+        return true;
+    }
+    auto it = std::ranges::find_if(zone_maps.elements, [&] (const column_zone_map& zm) {
+        return zm.column_name.value == cdef.name();
+    });
+    if (it == zone_maps.elements.end()) {
+        return true;
+    }
+    if (!it->value_count) {
+        return false;
+    }
+    auto cmp = [&type = *cdef.type] (const bytes& a, const bytes& b) {
+        return type.compare(a, b);
+    };
+    return !range.range.before(it->max.value, cmp) && !range.range.after(it->min.value, cmp);
+}
+
+std::unordered_set<const sstable*> sstables_excluded_by_column_zone_maps(const std::vector<shared_sstable>& sstables, const schema& s,
+        const query::column_value_ranges& ranges) {
+    std::unordered_set<const sstable*> excluded;
+    if (sstables.empty() || ranges.empty()) {
+        return excluded;
+    }
+    // The positions are in the order of the table, even if the read is reversed.
+    const schema& table_schema = *sstables.front()->get_schema();
+    auto positions = sstables | std::views::transform([] (const shared_sstable& sst) {
+        return position_range(sst->min_position(), sst->max_position());
+    }) | std::ranges::to<std::vector>();
+
+    std::vector<bool> kept(sstables.size());
+    for (const auto& range : ranges) {
+        for (size_t i = 0; i < sstables.size(); ++i) {
+            const auto& sst = *sstables[i];
+            auto* zone_maps = sst.get_column_zone_maps();
+            // Without reliable min/max positions we can't tell whether rows
+            // of the sstable merge with rows of other sstables.
+            kept[i] = !zone_maps || !sst.has_correct_min_max_column_names() || sst.may_have_partition_tombstones()
+                    || column_zone_maps_may_contain(*zone_maps, s, range);
+        }
+        // Skipping an sstable whose rows could be merged with rows of an
+        // sstable which is read could change the result of the merge, so
+        // keep the sstables overlapping kept ones, until there are none.
+        // The skipped sstables only overlap each other, and rows merged out
+        // of them have no values in the range either.
+        bool changed = true;
+        while (changed) {
+            changed = false;
+            for (size_t i = 0; i < sstables.size(); ++i) {
+                if (kept[i]) {
+                    continue;
+                }
+                for (size_t j = 0; j < sstables.size(); ++j) {
+                    if (kept[j] && positions[j].overlaps(table_schema, positions[i].start(), positions[i].end())) {
+                        kept[i] = true;
+                        changed = true;
+                        break;
+                    }
+                }
+            }
+        }
+        // Restrictions of different columns are ANDed, so a row has to be in
+        // all ranges and sstables skipped for any of them can be skipped.
+        for (size_t i = 0; i < sstables.size(); ++i) {
+            if (!kept[i]) {
+                excluded.insert(sstables[i].get());
+            }
+        }
+    }
+    return excluded;
+}
+
+} // namespace sstables
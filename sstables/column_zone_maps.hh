@@ -0,0 +1,76 @@
+/*
+ * Copyright (C) 2026-present ScyllaDB
+ */
+
+/*
+ * SPDX-License-Identifier: LicenseRef-ScyllaDB-Source-Available-1.0
+ */
+
+#pragma once
+
+#include <optional>
+#include <unordered_set>
+#include <vector>
+
+#include "mutation/atomic_cell.hh"
+#include "query-request.hh"
+#include "schema/schema_fwd.hh"
+#include "sstables/shared_sstable.hh"
+#include "sstables/types.hh"
+
+namespace sstables {
+
+// Column zone maps are the ranges of the values of the atomic regular columns
+// of an sstable, across all of its rows. Filtering reads use them to skip
+// sstables which have no values in the ranges the query restricts the columns
+// to, see db::column_zone_maps_extension.
+
+// Collects the zone maps of an sstable while it is written.
+class column_zone_maps_collector {
+    // No zone map is kept for columns with larger values, so that the
+    // metadata stays small.
+    static constexpr size_t max_value_size = 256;
+
+    struct column_range {
+        const column_definition* cdef = nullptr;
+        bytes min;
+        bytes max;
+        uint64_t value_count = 0;
+        bool too_large = false;
+    };
+
+    // Indexed by column id, disengaged for columns which are not tracked.
+    std::vector<std::optional<column_range>> _columns;
+    uint64_t _rows = 0;
+public:
+    explicit column_zone_maps_collector(const schema&);
+
+    static bool is_tracked(const column_definition&);
+
+    // Accounts for the value of a live cell of a regular column.
+    void update(const column_definition&, atomic_cell_view);
+    void add_row() noexcept {
+        ++_rows;
+    }
+
+    scylla_metadata::column_zone_maps build() const;
+};
+
+// Returns false if none of the values of the column in the sstable with the
+// zone maps is in the range.
+bool column_zone_maps_may_contain(const scylla_metadata::column_zone_maps&, const schema&, const query::column_value_range&);
+
+// Returns the sstables out of the ones containing a partition which a
+// single-partition filtering read can skip: none of their values of one of
+// the restricted columns is in its range, and none of their rows can be
+// merged with rows of the sstables which are read. The column ids of the
+// ranges are those of the read's schema.
+//
+// The caller must make sure that the sstables are the only source of data
+// for the partition, i.e. that it is not in memtables nor read through the
+// cache, and that the read has no static columns, whose values are returned
+// along with every row.
+std::unordered_set<const sstable*> sstables_excluded_by_column_zone_maps(const std::vector<shared_sstable>&, const schema&,
+        const query::column_value_ranges&);
+
+} // namespace sstables
@@ -27,6 +27,8 @@ enum class component_type {
     TemporaryTOC,
     TemporaryStatistics,
     Scylla,
+    TemporaryScylla,
+    AttachedIndex,
     Unknown,
 };
 
@@ -73,6 +75,10 @@ struct fmt::formatter<sstables::component_type> : fmt::formatter<string_view> {
             return formatter<string_view>::format("TemporaryStatistics", ctx);
         case Scylla:
             return formatter<string_view>::format("Scylla", ctx);
+        case TemporaryScylla:
+            return formatter<string_view>::format("TemporaryScylla", ctx);
+        case AttachedIndex:
+            return formatter<string_view>::format("AttachedIndex", ctx);
         case Unknown:
             return formatter<string_view>::format("Unknown", ctx);
         }
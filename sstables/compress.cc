@@ -8,6 +8,7 @@
 
 #include <stdexcept>
 #include <cstdlib>
+#include <deque>
 
 #include <seastar/core/align.hh>
 #include <seastar/core/bitops.hh>
@@ -24,6 +25,7 @@
 #include "utils/class_registrator.hh"
 #include "reader_permit.hh"
 #include "data_source_types.hh"
+#include "chunk_cache.hh"
 
 namespace sstables {
 
@@ -310,19 +312,126 @@ class compressed_file_data_source_impl : public data_source_impl {
     sstables::compression::segmented_offsets::accessor _offsets;
     [[no_unique_address]] sstables::digest_members<check_digest> _digests;
     reader_permit _permit;
-    uint64_t _underlying_pos;
+    sstables::chunk_cache* _cache;
+    // Position of _input_stream in the compressed file. Lags behind
+    // the chunks read when chunks are served from _cache.
+    uint64_t _stream_pos;
     uint64_t _pos;
     uint64_t _beg_pos;
     uint64_t _end_pos;
+
+    // Chunks following _pos which were already requested, in file order.
+    // Each chunk is uncompressed as soon as it is read, and reading the
+    // next one starts right after, so disk reads of the following chunks
+    // overlap with uncompressing and consuming the current one.
+    struct prefetched_chunk {
+        uint64_t chunk_start;
+        future<temporary_buffer<char>> buf;
+    };
+    std::deque<prefetched_chunk> _prefetched;
+    // Chain of the reads of _input_stream issued for _prefetched. Never fails.
+    future<> _reads = make_ready_future<>();
+    // Uncompressed position of the first chunk which wasn't prefetched yet.
+    uint64_t _prefetch_pos;
+    // Number of chunks kept prefetched after the one being consumed. Starts
+    // at 1 and doubles with every chunk consumed, up to _max_readahead, so
+    // short reads don't prefetch chunks they won't need. Reset by skips which
+    // drop prefetched chunks. 0 _max_readahead disables prefetching: chunks
+    // are read one at a time, when consumed.
+    unsigned _readahead = 1;
+    unsigned _max_readahead = 0;
+
+    future<> sync_input_stream(uint64_t chunk_start) {
+        if (!_input_stream) {
+            _input_stream = co_await _stream_creator();
+        }
+        if (_stream_pos != chunk_start) {
+            co_await _input_stream->skip(chunk_start - _stream_pos);
+            _stream_pos = chunk_start;
+        }
+    }
+
+    // Reads, verifies and uncompresses the whole chunk at addr.
+    future<temporary_buffer<char>> read_chunk(sstables::compression::chunk_and_offset addr) {
+        if (!addr.chunk_len) {
+            throw sstables::malformed_sstable_exception(format("compressed chunk_len must be greater than zero, chunk_start={}", addr.chunk_start));
+        }
+        co_await sync_input_stream(addr.chunk_start);
+        auto buf = co_await _input_stream->read_exactly(addr.chunk_len);
+        if (buf.size() != addr.chunk_len) {
+            throw sstables::malformed_sstable_exception(format("compressed reader hit premature end-of-file at file offset {}, expected chunk_len={}, actual={}", addr.chunk_start, addr.chunk_len, buf.size()));
+        }
+        _stream_pos += addr.chunk_len;
+        auto res_units = co_await _permit.request_memory(_compression_metadata->uncompressed_chunk_length());
+        // The last 4 bytes of the chunk are the adler32/crc32 checksum
+        // of the rest of the (compressed) chunk.
+        auto compressed_len = addr.chunk_len - 4;
+        // FIXME: Do not always calculate checksum - Cassandra has a
+        // probability (defaulting to 1.0, but still...)
+        auto expected_checksum = read_be<uint32_t>(buf.get() + compressed_len);
+        auto actual_checksum = ChecksumType::checksum(buf.get(), compressed_len);
+        if (expected_checksum != actual_checksum) {
+            throw sstables::malformed_sstable_exception(format("compressed chunk of size {} at file offset {} failed checksum, expected={}, actual={}", addr.chunk_len, addr.chunk_start, expected_checksum, actual_checksum));
+        }
+
+        if constexpr (check_digest) {
+            if (_digests.can_calculate_digest) {
+                _digests.actual_digest = checksum_combine_or_feed<ChecksumType>(_digests.actual_digest, actual_checksum, buf.get(), compressed_len);
+                if constexpr (mode == compressed_checksum_mode::checksum_all) {
+                    uint32_t be_actual_checksum = cpu_to_be(actual_checksum);
+                    _digests.actual_digest = ChecksumType::checksum(_digests.actual_digest,
+                            reinterpret_cast<const char*>(&be_actual_checksum), sizeof(be_actual_checksum));
+                }
+            }
+        }
+
+        // We know that the uncompressed data will take exactly
+        // chunk_length bytes (or less, if reading the last chunk).
+        temporary_buffer<char> out(
+                _compression_metadata->uncompressed_chunk_length());
+        // The compressed data is the whole chunk, minus the last 4
+        // bytes (which contain the checksum verified above).
+
+        auto len = _compression_metadata->get_compressor().uncompress(buf.get(), compressed_len, out.get_write(), out.size());
+
+        out.trim(len);
+        if (_cache) {
+            _cache->populate(addr.chunk_start, out);
+        }
+        co_return make_tracked_temporary_buffer(std::move(out), std::move(res_units));
+    }
+
+    void prefetch(size_t count) {
+        while (_prefetched.size() < count && _prefetch_pos < _end_pos) {
+            auto addr = _compression_metadata->locate(_prefetch_pos, _offsets);
+            promise<temporary_buffer<char>> pr;
+            _prefetched.push_back({addr.chunk_start, pr.get_future()});
+            _reads = _reads.then([this, addr] {
+                return read_chunk(addr);
+            }).then_wrapped([pr = std::move(pr)] (future<temporary_buffer<char>> f) mutable {
+                f.forward_to(std::move(pr));
+            });
+            _prefetch_pos += _compression_metadata->uncompressed_chunk_length() - addr.offset;
+        }
+    }
+
+    static void discard(prefetched_chunk& chunk) {
+        // The read is part of _reads, which close() waits for.
+        (void)std::move(chunk.buf).then_wrapped([] (future<temporary_buffer<char>> f) {
+            f.ignore_ready_future();
+        });
+    }
 public:
     compressed_file_data_source_impl(sstables::stream_creator_fn stream_creator, sstables::compression* cm,
                 uint64_t pos, size_t len, file_input_stream_options options,
-                reader_permit permit, std::optional<uint32_t> digest)
+                reader_permit permit, std::optional<uint32_t> digest, sstables::chunk_cache* cache)
             : _compression_metadata(cm)
             , _offsets(_compression_metadata->offsets.get_accessor())
             , _permit(std::move(permit))
+            // Chunks served from cache cannot contribute to the digest.
+            , _cache(check_digest ? nullptr : cache)
     {
-        _pos = _beg_pos = pos;
+        _pos = _beg_pos = _prefetch_pos = pos;
         if (pos > _compression_metadata->uncompressed_file_length()) {
             throw std::runtime_error("attempt to uncompress beyond end");
         }
@@ -348,6 +457,11 @@ class compressed_file_data_source_impl : public data_source_impl {
                 _digests = {true, *digest, ChecksumType::init_checksum()};
             }
         }
+        // Prefetch as much uncompressed data as the underlying stream reads
+        // ahead. Cached chunks are looked up one at a time, when consumed.
+        if (!_cache && options.read_ahead) {
+            _max_readahead = std::max<uint64_t>(1, uint64_t(options.read_ahead) * options.buffer_size / _compression_metadata->uncompressed_chunk_length());
+        }
         // _beg_pos and _end_pos specify positions in the compressed stream.
         // We need to translate them into a range of uncompressed chunks,
         // and open a file_input_stream to read that range.
@@ -356,65 +470,44 @@ class compressed_file_data_source_impl : public data_source_impl {
         _stream_creator = [stream_creator{std::move(stream_creator)}, start = start.chunk_start, length = end.chunk_start + end.chunk_len - start.chunk_start, options] mutable {
             return stream_creator(start, length, std::move(options));
         };
-        _underlying_pos = start.chunk_start;
+        _stream_pos = start.chunk_start;
     }
     virtual future<temporary_buffer<char>> get() override {
         if (_pos >= _end_pos) {
             co_return temporary_buffer<char>();
         }
 
-        if (!_input_stream) {
-            _input_stream = co_await _stream_creator();
-        }
         auto addr = _compression_metadata->locate(_pos, _offsets);
         // Uncompress the next chunk. We need to skip part of the first
         // chunk, but then continue to read from beginning of chunks.
         if (_pos != _beg_pos && addr.offset != 0) {
             throw std::runtime_error(format("compressed reader not aligned to chunk boundary: pos={} offset={}", _pos, addr.offset));
         }
-        if (!addr.chunk_len) {
-            throw sstables::malformed_sstable_exception(format("compressed chunk_len must be greater than zero, chunk_start={}", addr.chunk_start));
+        if (_cache && _prefetched.empty()) {
+            if (auto cached = _cache->get(addr.chunk_start)) {
+                auto res_units = co_await _permit.request_memory(cached->size());
+                auto out = std::move(*cached);
+                out.trim_front(addr.offset);
+                _pos += out.size();
+                _prefetch_pos = _pos;
+                co_return make_tracked_temporary_buffer(std::move(out), std::move(res_units));
+            }
         }
-        auto buf = co_await _input_stream->read_exactly(addr.chunk_len);
-        if (buf.size() != addr.chunk_len) {
-            throw sstables::malformed_sstable_exception(format("compressed reader hit premature end-of-file at file offset {}, expected chunk_len={}, actual={}", _underlying_pos, addr.chunk_len, buf.size()));
+        prefetch(1);
+        auto chunk = std::move(_prefetched.front());
+        _prefetched.pop_front();
+        if (chunk.chunk_start != addr.chunk_start) {
+            on_internal_error(sstables::sstlog, format("compressed reader prefetched chunk at file offset {}, expected {}", chunk.chunk_start, addr.chunk_start));
         }
-        auto res_units = co_await _permit.request_memory(_compression_metadata->uncompressed_chunk_length());
-        // The last 4 bytes of the chunk are the adler32/crc32 checksum
-        // of the rest of the (compressed) chunk.
-        auto compressed_len = addr.chunk_len - 4;
-        // FIXME: Do not always calculate checksum - Cassandra has a
-        // probability (defaulting to 1.0, but still...)
-        auto expected_checksum = read_be<uint32_t>(buf.get() + compressed_len);
-        auto actual_checksum = ChecksumType::checksum(buf.get(), compressed_len);
-        if (expected_checksum != actual_checksum) {
-            throw sstables::malformed_sstable_exception(format("compressed chunk of size {} at file offset {} failed checksum, expected={}, actual={}", addr.chunk_len, _underlying_pos, expected_checksum, actual_checksum));
-        }
-
-        if constexpr (check_digest) {
-            if (_digests.can_calculate_digest) {
-                _digests.actual_digest = checksum_combine_or_feed<ChecksumType>(_digests.actual_digest, actual_checksum, buf.get(), compressed_len);
-                if constexpr (mode == compressed_checksum_mode::checksum_all) {
-                    uint32_t be_actual_checksum = cpu_to_be(actual_checksum);
-                    _digests.actual_digest = ChecksumType::checksum(_digests.actual_digest,
-                            reinterpret_cast<const char*>(&be_actual_checksum), sizeof(be_actual_checksum));
-                }
-            }
+        // Keep the pipeline full while this chunk is consumed.
+        if (_max_readahead) {
+            prefetch(_readahead);
+            _readahead = std::min(_readahead * 2, _max_readahead);
         }
 
-        // We know that the uncompressed data will take exactly
-        // chunk_length bytes (or less, if reading the last chunk).
-        temporary_buffer<char> out(
-                _compression_metadata->uncompressed_chunk_length());
-        // The compressed data is the whole chunk, minus the last 4
-        // bytes (which contain the checksum verified above).
-
-        auto len = _compression_metadata->get_compressor().uncompress(buf.get(), compressed_len, out.get_write(), out.size());
-
-        out.trim(len);
+        auto out = co_await std::move(chunk.buf);
         out.trim_front(addr.offset);
         _pos += out.size();
-        _underlying_pos += addr.chunk_len;
 
         if constexpr (check_digest) {
             if (_digests.can_calculate_digest
@@ -423,14 +516,18 @@ class compressed_file_data_source_impl : public data_source_impl {
                 throw sstables::malformed_sstable_exception(seastar::format("Digest mismatch: expected={}, actual={}", _digests.expected_digest, _digests.actual_digest));
             }
         }
-        co_return make_tracked_temporary_buffer(std::move(out), std::move(res_units));
+        co_return out;
     }
 
     virtual future<> close() override {
-        if (!_input_stream) {
-            return make_ready_future<>();
+        for (auto& chunk : _prefetched) {
+            discard(chunk);
+        }
+        _prefetched.clear();
+        co_await std::move(_reads);
+        if (_input_stream) {
+            co_await _input_stream->close();
         }
-        return _input_stream->close();
     }
 
     virtual future<temporary_buffer<char>> skip(uint64_t n) override {
@@ -448,13 +545,27 @@ class compressed_file_data_source_impl : public data_source_impl {
             co_return temporary_buffer<char>();
         }
         auto addr = _compression_metadata->locate(_pos, _offsets);
-        auto underlying_n = addr.chunk_start - _underlying_pos;
-        _underlying_pos = addr.chunk_start;
         _beg_pos = _pos;
-        if (!_input_stream) {
-            _input_stream = co_await _stream_creator();
+        // Drop the prefetched chunks which were skipped over. The stream
+        // only moves forward, so the skip can't go back before them.
+        bool dropped = false;
+        while (!_prefetched.empty() && _prefetched.front().chunk_start < addr.chunk_start) {
+            discard(_prefetched.front());
+            _prefetched.pop_front();
+            dropped = true;
+        }
+        if (_prefetched.empty()) {
+            _prefetch_pos = _pos;
+        }
+        if (dropped) {
+            _readahead = 1;
+        }
+        if (_max_readahead) {
+            prefetch(_readahead);
+        } else if (!_cache) {
+            // With a cache, the next chunk may not need to be read at all.
+            co_await sync_input_stream(addr.chunk_start);
         }
-        co_await _input_stream->skip(underlying_n);
         co_return temporary_buffer<char>();
     }
 };
@@ -464,23 +575,23 @@ class compressed_file_data_source : public data_source {
 public:
     compressed_file_data_source(sstables::stream_creator_fn stream_creator, sstables::compression* cm,
             uint64_t offset, size_t len, file_input_stream_options options, reader_permit permit,
-            std::optional<uint32_t> digest)
+            std::optional<uint32_t> digest, sstables::chunk_cache* cache)
         : data_source(std::make_unique<compressed_file_data_source_impl<ChecksumType, check_digest, mode>>(
-                std::move(stream_creator), cm, offset, len, std::move(options), std::move(permit), digest))
+                std::move(stream_creator), cm, offset, len, std::move(options), std::move(permit), digest, cache))
         {}
 };
 
 template <ChecksumUtils ChecksumType, compressed_checksum_mode mode>
 inline input_stream<char> make_compressed_file_input_stream(sstables::stream_creator_fn stream_creator, sstables::compression *cm, uint64_t offset, size_t len,
         file_input_stream_options options, reader_permit permit,
-        std::optional<uint32_t> digest)
+        std::optional<uint32_t> digest, sstables::chunk_cache* cache)
 {
     if (digest) [[unlikely]] {
         return input_stream<char>(compressed_file_data_source<ChecksumType, true, mode>(
-                std::move(stream_creator), cm, offset, len, std::move(options), std::move(permit), digest));
+                std::move(stream_creator), cm, offset, len, std::move(options), std::move(permit), digest, cache));
     }
     return input_stream<char>(compressed_file_data_source<ChecksumType, false, mode>(
-            std::move(stream_creator), cm, offset, len, std::move(options), std::move(permit), digest));
+            std::move(stream_creator), cm, offset, len, std::move(options), std::move(permit), digest, cache));
 }
 
 // compressed_file_data_sink_impl works as a filter for a file output stream,
@@ -582,18 +693,18 @@ inline output_stream<char> make_compressed_file_output_stream(output_stream<char
 input_stream<char> sstables::make_compressed_file_k_l_format_input_stream(stream_creator_fn stream_creator,
         sstables::compression* cm, uint64_t offset, size_t len,
         class file_input_stream_options options, reader_permit permit,
-        std::optional<uint32_t> digest)
+        std::optional<uint32_t> digest, chunk_cache* cache)
 {
     return make_compressed_file_input_stream<adler32_utils, compressed_checksum_mode::checksum_chunks_only>(
-            std::move(stream_creator), cm, offset, len, std::move(options), std::move(permit), digest);
+            std::move(stream_creator), cm, offset, len, std::move(options), std::move(permit), digest, cache);
 }
 
 input_stream<char> sstables::make_compressed_file_m_format_input_stream(stream_creator_fn stream_creator,
         sstables::compression *cm, uint64_t offset, size_t len,
         class file_input_stream_options options, reader_permit permit,
-        std::optional<uint32_t> digest) {
+        std::optional<uint32_t> digest, chunk_cache* cache) {
     return make_compressed_file_input_stream<crc32_utils, compressed_checksum_mode::checksum_all>(
-            std::move(stream_creator), cm, offset, len, std::move(options), std::move(permit), digest);
+            std::move(stream_creator), cm, offset, len, std::move(options), std::move(permit), digest, cache);
 }
 
 output_stream<char> sstables::make_compressed_file_m_format_output_stream(output_stream<char> out,
@@ -55,6 +55,8 @@ class compressor;
 
 namespace sstables {
 
+class chunk_cache;
+
 struct compression {
     // To reduce the memory footpring of compression-info, n offsets are grouped
     // together into segments, where each segment stores a base absolute offset
@@ -367,15 +369,20 @@ using stream_creator_fn = std::function<future<input_stream<char>>(uint64_t, uin
 // are open streams on it. This should happen naturally on a higher level -
 // as long as we have *sstables* work in progress, we need to keep the whole
 // sstable alive, and the compression metadata is only a part of it.
+//
+// If cache is given, decompressed chunks are looked up in, and populated into
+// it. The cache is not used when verifying the digest of the whole file.
 input_stream<char> make_compressed_file_k_l_format_input_stream(stream_creator_fn stream_creator,
                 sstables::compression* cm, uint64_t offset, size_t len,
                 class file_input_stream_options options, reader_permit permit,
-                std::optional<uint32_t> digest);
+                std::optional<uint32_t> digest,
+                chunk_cache* cache = nullptr);
 
 input_stream<char> make_compressed_file_m_format_input_stream(stream_creator_fn stream_creator,
                 sstables::compression* cm, uint64_t offset, size_t len,
                 class file_input_stream_options options, reader_permit permit,
-                std::optional<uint32_t> digest);
+                std::optional<uint32_t> digest,
+                chunk_cache* cache = nullptr);
 
 output_stream<char> make_compressed_file_m_format_output_stream(output_stream<char> out,
                 sstables::compression* cm,
@@ -1343,7 +1343,8 @@ class sstable_mutation_reader : public mp_row_consumer_reader_k_l {
 
         if (_single_partition_read) {
             _read_enabled = (begin != *end);
-            _context = co_await data_consume_single_partition<DataConsumeRowsContext>(*_schema, _sst, _consumer, { begin, *end }, integrity_check::no);
+            auto caching = use_caching(global_cache_data_chunks && !_slice.options.contains(query::partition_slice::option::bypass_cache));
+            _context = co_await data_consume_single_partition<DataConsumeRowsContext>(*_schema, _sst, _consumer, { begin, *end }, integrity_check::no, caching);
         } else {
             sstable::disk_read_range drr{begin, *end};
             auto last_end = _fwd_mr ? _sst->data_size() : drr.end;
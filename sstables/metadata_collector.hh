@@ -11,6 +11,7 @@
 #pragma once
 
 #include "sstables/types.hh"
+#include "sstables/column_zone_maps.hh"
 #include "sstables/component_type.hh"
 #include "timestamp.hh"
 #include "utils/extremum_tracking.hh"
@@ -147,6 +148,7 @@ class metadata_collector {
     bool _has_legacy_counter_shards = false;
     uint64_t _columns_count = 0;
     uint64_t _rows_count = 0;
+    std::optional<column_zone_maps_collector> _column_zone_maps;
 
     /**
      * Default cardinality estimation method is to use HyperLogLog++.
@@ -169,6 +171,9 @@ class metadata_collector {
             _min_clustering_pos.emplace(position_in_partition_view::before_all_clustered_rows());
             _max_clustering_pos.emplace(position_in_partition_view::after_all_clustered_rows());
         }
+        if (schema.column_zone_maps()) {
+            _column_zone_maps.emplace(schema);
+        }
     }
 
     const schema& get_schema() {
@@ -266,6 +271,26 @@ class metadata_collector {
             { ext_timestamp_stats_type::min_live_row_marker_timestamp, _min_live_row_marker_timestamp_tracker.get() },
         };
     }
+
+    // Column zone maps are only collected for tables which enable them.
+    void update_column_value(const column_definition& cdef, atomic_cell_view cell) {
+        if (_column_zone_maps) {
+            _column_zone_maps->update(cdef, cell);
+        }
+    }
+
+    void add_clustering_row() noexcept {
+        if (_column_zone_maps) {
+            _column_zone_maps->add_row();
+        }
+    }
+
+    std::optional<scylla_metadata::column_zone_maps> get_column_zone_maps() const {
+        if (!_column_zone_maps) {
+            return std::nullopt;
+        }
+        return _column_zone_maps->build();
+    }
 };
 
 }
@@ -76,6 +76,12 @@ class mp_row_consumer_m {
     std::vector<cell> _cells;
     collection_mutation_description _cm;
 
+    // Regular and static columns whose values the slice asks for, indexed by column id.
+    // Cells of other columns are still emitted, to keep the liveness of rows intact,
+    // but with empty values. Empty when the values of all columns are needed.
+    std::vector<bool> _needed_regular_column_values;
+    std::vector<bool> _needed_static_column_values;
+
     data_consumer::proceed consume_range_tombstone_start(clustering_key_prefix ck, bound_kind k, tombstone t) {
         sstlog.trace("mp_row_consumer_m {}: consume_range_tombstone_start(ck={}, k={}, t={})", fmt::ptr(this), ck, k, t);
         if (_mf_filter->current_tombstone()) {
@@ -204,6 +210,20 @@ class mp_row_consumer_m {
             && (!sst->has_scylla_component() || sst->features().is_enabled(sstable_feature::CorrectStaticCompact))) // See #4139
     {
         _cells.reserve(std::max(_schema->static_columns_count(), _schema->regular_columns_count()));
+        // Only data queries which bypass the cache may drop column values: the
+        // cache populates its entries with the rows read from sstables, and the
+        // results of mutation queries are used to reconcile replicas.
+        if (_slice.options.contains(query::partition_slice::option::skip_unselected_column_values)) {
+            auto needed_column_values = [] (const query::column_id_vector& ids, size_t count) {
+                std::vector<bool> needed(count, false);
+                for (auto id : ids) {
+                    needed[id] = true;
+                }
+                return needed;
+            };
+            _needed_regular_column_values = needed_column_values(_slice.regular_columns, _schema->regular_columns_count());
+            _needed_static_column_values = needed_column_values(_slice.static_columns, _schema->static_columns_count());
+        }
     }
 
     mp_row_consumer_m(mp_row_consumer_reader_mx* reader,
@@ -375,6 +395,15 @@ class mp_row_consumer_m {
         return row_processing_result::do_proceed;
     }
 
+    bool is_column_value_needed(const column_translation::column_info& column_info) const {
+        // Counter cells are merged by value, so it is always needed.
+        if (!column_info.id || column_info.is_counter) {
+            return true;
+        }
+        auto& needed = _inside_static_row ? _needed_static_column_values : _needed_regular_column_values;
+        return needed.empty() || needed[*column_info.id];
+    }
+
     data_consumer::proceed consume_column(const column_translation::column_info& column_info,
                                    bytes_view cell_path,
                                    fragmented_temporary_buffer::view value,
@@ -673,6 +702,7 @@ requires requires(
     { c.consume_static_row_start() } -> std::same_as<row_processing_result>;
     { c.consume_row_start(ck_view) } -> std::same_as<row_processing_result>;
     { c.consume_row_marker_and_tombstone(l_info, tomb, tomb) } -> std::same_as<data_consumer::proceed>;
+    { c.is_column_value_needed(column_info) } -> std::same_as<bool>;
     { c.consume_column(column_info, cell_path, value, timestamp, ttl, local_deletion_time, is_deleted) } -> std::same_as<data_consumer::proceed>;
     { c.consume_complex_column_start(column_info, tomb) } -> std::same_as<data_consumer::proceed>;
     { c.consume_complex_column_end(column_info) } -> std::same_as<data_consumer::proceed>;
@@ -1103,6 +1133,20 @@ class data_consume_rows_context_m : public data_consumer::continuous_data_consum
             }
             if (!_column_flags.has_value()) {
                 _column_value = fragmented_temporary_buffer();
+            } else if (!_consumer.is_column_value_needed(get_column_info())) {
+                // Skip over the value instead of copying it.
+                _column_value = fragmented_temporary_buffer();
+                uint64_t len;
+                if (auto fixed_len = get_column_value_length()) {
+                    len = *fixed_len;
+                } else {
+                    co_yield this->read_unsigned_vint(*_processing_data);
+                    len = this->_u64;
+                }
+                auto maybe_skip_bytes = this->skip(*_processing_data, len);
+                if (std::holds_alternative<skip_bytes>(maybe_skip_bytes)) {
+                    co_yield maybe_skip_bytes;
+                }
             } else {
                 read_status status = read_status::waiting;
                 if (auto len = get_column_value_length()) {
@@ -1590,7 +1634,8 @@ class mx_sstable_mutation_reader : public mp_row_consumer_reader_mx {
                 _context = std::move(reversed_context.the_context);
                 _reversed_read_sstable_position = &reversed_context.current_position_in_sstable;
             } else {
-                _context = co_await data_consume_single_partition<DataConsumeRowsContext>(*_schema, _sst, _consumer, { begin, *end }, _integrity);
+                auto caching = use_caching(global_cache_data_chunks && !_slice.options.contains(query::partition_slice::option::bypass_cache));
+                _context = co_await data_consume_single_partition<DataConsumeRowsContext>(*_schema, _sst, _consumer, { begin, *end }, _integrity, caching);
             }
         } else {
             sstable::disk_read_range drr{begin, *end};
@@ -2174,6 +2219,10 @@ class validating_consumer {
         return row_processing_result::do_proceed;
     }
 
+    bool is_column_value_needed(const column_translation::column_info& column_info) const {
+        return true;
+    }
+
     data_consumer::proceed consume_column(const column_translation::column_info& column_info, bytes_view cell_path, fragmented_temporary_buffer::view value,
             api::timestamp_type timestamp, gc_clock::duration ttl, gc_clock::time_point local_deletion_time, bool is_deleted) {
         return data_consumer::proceed::yes;
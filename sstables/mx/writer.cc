@@ -8,6 +8,8 @@
 
 #include "sstables/mx/writer.hh"
 #include "sstables/writer.hh"
+#include "sstables/clustering_filter.hh"
+#include "sstables/attached_index.hh"
 #include "encoding_stats.hh"
 #include "schema/schema.hh"
 #include "mutation/mutation_fragment.hh"
@@ -595,6 +597,8 @@ class writer : public sstable_writer::writer_impl {
     large_data_stats_entry _row_size_entry;
     large_data_stats_entry _cell_size_entry;
     large_data_stats_entry _elements_in_collection_entry;
+    std::optional<clustering_filter_builder> _clustering_filter_builder = clustering_filter_builder::make(_schema);
+    std::unique_ptr<attached_index_writer> _attached_index_writer;
 
     void init_file_writers();
 
@@ -801,7 +805,8 @@ class writer : public sstable_writer::writer_impl {
         _sst._shards = { shard };
 
         _cfg.monitor->on_write_started(_data_writer->offset_tracker());
-        _sst._components->filter = utils::i_filter::get_filter(estimated_partitions, _sst._schema->bloom_filter_fp_chance(), utils::filter_format::m_format);
+        _sst._components->filter = utils::i_filter::get_filter(estimated_partitions, _sst._schema->bloom_filter_fp_chance(), utils::filter_format::m_format,
+                _sst.filter_layout());
         _pi_write_m.promoted_index_block_size = cfg.promoted_index_block_size;
         _pi_write_m.promoted_index_auto_scale_threshold = cfg.promoted_index_auto_scale_threshold;
         _index_sampling_state.summary_byte_cost = _cfg.summary_byte_cost;
@@ -897,6 +902,13 @@ void writer::init_file_writers() {
 
     out = _sst._storage->make_data_or_index_sink(_sst, component_type::Index).get();
     _index_writer = std::make_unique<file_writer>(output_stream<char>(std::move(out)), _sst.index_filename());
+
+    if (_sst.has_component(component_type::AttachedIndex)) {
+        file_output_stream_options options;
+        options.buffer_size = _sst.sstable_buffer_size;
+        _attached_index_writer = std::make_unique<attached_index_writer>(_schema.sstable_indexed_columns(),
+                _sst.make_component_file_writer(component_type::AttachedIndex, std::move(options)).get(), _sst.get_version());
+    }
 }
 
 std::unique_ptr<file_writer> writer::close_writer(std::unique_ptr<file_writer>& w) {
@@ -924,6 +936,12 @@ void writer::consume_new_partition(const dht::decorated_key& dk) {
     maybe_add_summary_entry(dk.token(), bytes_view(*_partition_key));
 
     _sst._components->filter->add(bytes_view(*_partition_key));
+    if (_clustering_filter_builder) {
+        _clustering_filter_builder->consume_new_partition(dk);
+    }
+    if (_attached_index_writer) {
+        _attached_index_writer->consume_new_partition(dk);
+    }
     _collector.add_key(bytes_view(*_partition_key));
     _num_partitions_consumed++;
 
@@ -967,6 +985,9 @@ void writer::consume(tombstone t) {
     if (t) {
         _collector.update_min_max_components(position_in_partition_view::before_all_clustered_rows());
         _collector.update_min_max_components(position_in_partition_view::after_all_clustered_rows());
+        if (_clustering_filter_builder) {
+            _clustering_filter_builder->consume(t);
+        }
     }
 }
 
@@ -1174,6 +1195,12 @@ void writer::write_cells(bytes_ostream& writer, const clustering_key_prefix* clu
         atomic_cell_view cell = c.as_atomic_cell(column_definition);
         ++_c_stats.cells_count;
         ++_c_stats.column_count;
+        if (kind == column_kind::regular_column) {
+            _collector.update_column_value(column_definition, cell);
+            if (_attached_index_writer) {
+                _attached_index_writer->consume(column_definition, cell);
+            }
+        }
         write_cell(writer, clustering_key, cell, column_definition, properties);
     });
 
@@ -1302,6 +1329,7 @@ void writer::write_clustered(const clustering_row& clustered_row, uint64_t prev_
 
     // Collect statistics
     _collector.update_min_max_components(clustered_row.position());
+    _collector.add_clustering_row();
     collect_row_stats(_data_writer->offset() - current_pos, &clustered_row.key(), is_dead);
 }
 
@@ -1343,6 +1371,9 @@ stop_iteration writer::consume(clustering_row&& cr) {
     ensure_tombstone_is_written();
     ensure_static_row_is_written_if_needed();
     write_clustered(cr);
+    if (_clustering_filter_builder) {
+        _clustering_filter_builder->consume(cr.key());
+    }
 
     auto can_split_partition_at_clustering_boundary = [this] {
         // will allow size limit to be exceeded for 10%, so we won't perform unnecessary split
@@ -1444,6 +1475,9 @@ stop_iteration writer::consume(range_tombstone_change&& rtc) {
     if (!_current_tombstone && !rtc.tombstone()) {
         return stop_iteration::no;
     }
+    if (_clustering_filter_builder) {
+        _clustering_filter_builder->consume_range_tombstone();
+    }
     tombstone prev_tombstone = std::exchange(_current_tombstone, rtc.tombstone());
     if (!prev_tombstone) { // start bound
         auto bv = pos.as_start_bound_view();
@@ -1511,6 +1545,9 @@ void writer::consume_end_of_stream() {
     }
 
     close_writer(_index_writer);
+    if (_attached_index_writer) {
+        _sst._metadata_size_on_disk += _attached_index_writer->finish();
+    }
     _sst.set_first_and_last_keys();
 
     _sst._components->statistics.contents[metadata_type::Serialization] = std::make_unique<serialization_header>(std::move(_sst_schema.header));
@@ -1542,7 +1579,9 @@ void writer::consume_end_of_stream() {
     std::optional<scylla_metadata::ext_timestamp_stats> ts_stats(scylla_metadata::ext_timestamp_stats{
         .map = _collector.get_ext_timestamp_stats()
     });
-    _sst.write_scylla_metadata(_shard, std::move(identifier), std::move(ld_stats), std::move(ts_stats));
+    auto cf_metadata = _clustering_filter_builder ? _clustering_filter_builder->build() : std::nullopt;
+    _sst.write_scylla_metadata(_shard, std::move(identifier), std::move(ld_stats), std::move(ts_stats), std::move(cf_metadata),
+            _collector.get_column_zone_maps());
     _sst.seal_sstable(_cfg.backup).get();
 }
 
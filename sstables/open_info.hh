@@ -76,6 +76,12 @@ struct sstable_open_config {
     // filter, meaning that the SSTable will be opened on every single-partition
     // read.
     bool load_bloom_filter = true;
+    // If set, the bloom filter is not read while opening the SSTable. The
+    // SSTable starts out with an always-present filter and is handed over to
+    // the sstables manager as if its filter had been reclaimed, so the filter
+    // is loaded in the background once memory allows, with SSTables that see
+    // reads going first. Ignored if load_bloom_filter is false.
+    bool defer_bloom_filter_load = false;
     // Mimics behavior when a SSTable is streamed to a given shard, where SSTable
     // writer considers the shard that created the SSTable as its owner.
     bool current_shard_as_sstable_owner = false;
@@ -12,6 +12,7 @@
 #include <seastar/core/weak_ptr.hh>
 
 #include "compress.hh"
+#include "sstables/clustering_filter.hh"
 #include "sstables/types.hh"
 #include "utils/i_filter.hh"
 
@@ -21,6 +22,7 @@ namespace sstables {
 struct shareable_components {
     sstables::compression compression;
     utils::filter_ptr filter;
+    std::unique_ptr<sstables::clustering_filter> clustering_filter;
     sstables::summary summary;
     sstables::statistics statistics;
     std::optional<sstables::scylla_metadata> scylla_metadata;
@@ -187,10 +187,12 @@ void sstable_directory::filesystem_components_lister::handle(sstables::entry_des
 
     switch (desc.component) {
     case component_type::TemporaryStatistics:
+    case component_type::TemporaryScylla:
         // We generate TemporaryStatistics when we rewrite the Statistics file,
-        // for instance on mutate_level. We should delete it - so we mark it for deletion
-        // here, but just the component. The old statistics file should still be there
-        // and we'll go with it.
+        // for instance on mutate_level, and TemporaryScylla when we rewrite the
+        // Scylla file. We should delete it - so we mark it for deletion here,
+        // but just the component. The old file should still be there and we'll
+        // go with it.
         _state->files_for_removal.insert(filename.native());
         break;
     case component_type::TOC:
@@ -477,8 +479,8 @@ future<> sstable_directory::sstables_registry_components_lister::garbage_collect
 }
 
 future<>
-sstable_directory::move_foreign_sstables(sharded<sstable_directory>& source_directory) {
-    return parallel_for_each(std::views::iota(0u, smp::count), [this, &source_directory] (unsigned shard_id) mutable {
+sstable_directory::move_foreign_sstables(sharded<sstable_directory>& source_directory, sstables::sstable_open_config cfg) {
+    return parallel_for_each(std::views::iota(0u, smp::count), [this, &source_directory, cfg] (unsigned shard_id) mutable {
         auto info_vec = std::exchange(_unshared_remote_sstables[shard_id], {});
         if (info_vec.empty()) {
             return make_ready_future<>();
@@ -486,7 +488,7 @@ sstable_directory::move_foreign_sstables(sharded<sstable_directory>& source_dire
         // Should be empty, since an SSTable that belongs to this shard is not remote.
         SCYLLA_ASSERT(shard_id != this_shard_id());
         dirlog.debug("Moving {} unshared SSTables of {}.{} to shard {} ", info_vec.size(), _schema->ks_name(), _schema->cf_name(), shard_id);
-        return source_directory.invoke_on(shard_id, &sstables::sstable_directory::load_foreign_sstables, std::move(info_vec));
+        return source_directory.invoke_on(shard_id, &sstables::sstable_directory::load_foreign_sstables, std::move(info_vec), cfg);
     });
 }
 
@@ -497,9 +499,9 @@ future<shared_sstable> sstable_directory::load_foreign_sstable(foreign_sstable_o
 }
 
 future<>
-sstable_directory::load_foreign_sstables(sstable_entry_descriptor_vector info_vec) {
-    co_await _manager.dir_semaphore().parallel_for_each(info_vec, [this] (const sstables::entry_descriptor& info) {
-        return load_sstable(info, *_storage_opts).then([this] (auto sst) {
+sstable_directory::load_foreign_sstables(sstable_entry_descriptor_vector info_vec, sstables::sstable_open_config cfg) {
+    co_await _manager.dir_semaphore().parallel_for_each(info_vec, [this, cfg] (const sstables::entry_descriptor& info) {
+        return load_sstable(info, *_storage_opts, cfg).then([this] (auto sst) {
             _unshared_local_sstables.push_back(sst);
             return make_ready_future<>();
         });
@@ -207,7 +207,7 @@ class sstable_directory {
     future<sstables::shared_sstable> load_sstable(sstables::entry_descriptor desc,
             const data_dictionary::storage_options& storage_opts, sstables::sstable_open_config cfg = {}) const;
 
-    future<> load_foreign_sstables(sstable_entry_descriptor_vector info_vec);
+    future<> load_foreign_sstables(sstable_entry_descriptor_vector info_vec, sstables::sstable_open_config cfg);
 
     // Compute owner of shards for a particular SSTable.
     future<std::vector<shard_id>> get_shards_for_this_sstable(
@@ -249,7 +249,7 @@ class sstable_directory {
     future<shared_sstable> load_foreign_sstable(foreign_sstable_open_info& info);
 
     // moves unshared SSTables that don't belong to this shard to the right shards.
-    future<> move_foreign_sstables(sharded<sstable_directory>& source_directory);
+    future<> move_foreign_sstables(sharded<sstable_directory>& source_directory, sstables::sstable_open_config cfg = {});
 
     // returns what is the highest version seen in this directory.
     sstables::sstable_version_types highest_version_seen() const;
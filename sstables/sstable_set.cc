@@ -923,15 +923,31 @@ filter_sstable_for_reader(std::vector<shared_sstable>&& sstables, const schema&
     return std::move(sstables);
 }
 
+// The clustering ranges of the slice, in the clustering order of the table,
+// which is the order of the sstable metadata. Native reversed slices have
+// their ranges in reverse order, with their bounds swapped.
+static query::clustering_row_ranges get_ranges_in_table_order(const query::partition_slice& slice) {
+    auto ranges = slice.get_all_ranges();
+    if (slice.is_reversed()) {
+        for (auto& range : ranges) {
+            range = query::reverse(range);
+        }
+    }
+    return ranges;
+}
+
 // Filter out sstables for reader using sstable metadata that keeps track
-// of a range for each clustering component.
+// of a range for each clustering component, and clustering filters of
+// sstables which have them.
 static std::vector<shared_sstable>
 filter_sstable_for_reader_by_ck(std::vector<shared_sstable>&& sstables, replica::column_family& cf, const schema_ptr& schema,
-        const query::partition_slice& slice) {
+        const dht::ring_position& pos, const query::partition_slice& slice) {
     // no clustering filtering is applied if schema defines no clustering key or
-    // compaction strategy thinks it will not benefit from such an optimization,
-    // or the partition_slice includes static columns.
-    if (!schema->clustering_key_size() || !cf.get_compaction_strategy().use_clustering_key_filter() || slice.static_columns.size()) {
+    // compaction strategy thinks it will not benefit from such an optimization
+    // and sstables have no clustering filters, or the partition_slice includes static columns.
+    const bool use_min_max = cf.get_compaction_strategy().use_clustering_key_filter();
+    if (!schema->clustering_key_size() || slice.static_columns.size()
+            || (!use_min_max && std::ranges::none_of(sstables, &sstable::has_clustering_filter))) {
         return std::move(sstables);
     }
 
@@ -939,7 +955,7 @@ filter_sstable_for_reader_by_ck(std::vector<shared_sstable>&& sstables, replica:
     stats->clustering_filter_count++;
     stats->sstables_checked_by_clustering_filter += sstables.size();
 
-    auto ck_filtering_all_ranges = slice.get_all_ranges();
+    auto ck_filtering_all_ranges = get_ranges_in_table_order(slice);
     // fast path to include all sstables if only one full range was specified.
     // For example, this happens if query only specifies a partition key.
     if (ck_filtering_all_ranges.size() == 1 && ck_filtering_all_ranges[0].is_full()) {
@@ -948,8 +964,22 @@ filter_sstable_for_reader_by_ck(std::vector<shared_sstable>&& sstables, replica:
         return std::move(sstables);
     }
 
-    auto skipped = std::partition(sstables.begin(), sstables.end(), [&ranges = ck_filtering_all_ranges] (const shared_sstable& sst) {
-        return sst->may_contain_rows(ranges);
+    std::optional<utils::hashed_key> pk_hash;
+    auto skipped = std::partition(sstables.begin(), sstables.end(), [&] (const shared_sstable& sst) {
+        if (use_min_max && !sst->may_contain_rows(ck_filtering_all_ranges)) {
+            return false;
+        }
+        if (!sst->has_clustering_filter()) {
+            return true;
+        }
+        if (!pk_hash) {
+            pk_hash = sstable::make_hashed_key(*schema, *pos.key());
+        }
+        if (!sst->clustering_filter_may_contain(*pk_hash, ck_filtering_all_ranges)) {
+            stats->sstables_skipped_by_clustering_prefix_filter++;
+            return false;
+        }
+        return true;
     });
     sstables.erase(skipped, sstables.end());
     stats->surviving_sstables_after_clustering_filter += sstables.size();
@@ -995,9 +1025,10 @@ sstable_set_impl::create_single_key_sstable_reader(
     if (!num_sstables) {
         return make_empty_mutation_reader(schema, permit);
     }
-    auto readers = filter_sstable_for_reader_by_ck(std::move(selected_sstables), *cf, schema, slice)
+    auto readers = filter_sstable_for_reader_by_ck(std::move(selected_sstables), *cf, schema, pos, slice)
         | std::views::transform([&] (const shared_sstable& sstable) {
             tracing::trace(trace_state, "Reading key {} from sstable {}", pos, seastar::value_of([&sstable] { return sstable->get_filename(); }));
+            sstable->add_read();
             return sstable->make_reader(schema, permit, pr, slice, trace_state, fwd);
           })
         | std::ranges::to<std::vector<mutation_reader>>();
@@ -1065,11 +1096,12 @@ time_series_sstable_set::create_single_key_sstable_reader(
     stats.clustering_filter_count++;
 
     auto create_reader = [schema, permit, &pr, &slice, trace_state, fwd_sm] (sstable& sst) {
+        sst.add_read();
         return sst.make_reader(schema, permit, pr, slice, trace_state, fwd_sm);
     };
 
     auto pk_filter = make_pk_filter(pos, *schema);
-    auto ck_filter = [ranges = slice.get_all_ranges()] (const sstable& sst) { return sst.may_contain_rows(ranges); };
+    auto ck_filter = [ranges = get_ranges_in_table_order(slice)] (const sstable& sst) { return sst.may_contain_rows(ranges); };
 
     // We're going to pass this filter into sstable_position_reader_queue. The queue guarantees that
     // the filter is going to be called at most once for each sstable and exactly once after
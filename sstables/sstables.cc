@@ -10,6 +10,7 @@
 #include <concepts>
 #include <vector>
 #include <limits>
+#include <cmath>
 #include <algorithm>
 #include <fmt/ranges.h>
 #include <seastar/core/future.hh>
@@ -58,6 +59,7 @@
 #include "utils/bloom_filter.hh"
 #include "utils/cached_file.hh"
 #include "utils/stall_free.hh"
+#include "sstables/chunk_cache.hh"
 #include "utils/checked-file-impl.hh"
 #include "db/extensions.hh"
 #include "sstables/partition_index_cache.hh"
@@ -104,6 +106,10 @@ namespace sstables {
 //
 thread_local utils::updateable_value<bool> global_cache_index_pages(true);
 
+// Like global_cache_index_pages, but governs caching of decompressed data
+// chunks by single-partition reads.
+thread_local utils::updateable_value<bool> global_cache_data_chunks(false);
+
 logging::logger sstlog("sstable");
 
 [[noreturn]] void on_parse_error(sstring message, std::optional<component_name> filename) {
@@ -879,6 +885,9 @@ void sstable::generate_toc() {
         _recognized_components.insert(component_type::CompressionInfo);
     }
     _recognized_components.insert(component_type::Scylla);
+    if (!_schema->sstable_indexed_columns().empty()) {
+        _recognized_components.insert(component_type::AttachedIndex);
+    }
 }
 
 future<std::unordered_map<component_type, file>> sstable::readable_file_for_all_components() const {
@@ -1329,6 +1338,19 @@ void sstable::rewrite_statistics() {
     sstable_write_io_check(rename_file, fmt::to_string(filename(component_type::TemporaryStatistics)), fmt::to_string(filename(component_type::Statistics))).get();
 }
 
+void sstable::rewrite_scylla_metadata() {
+    sstlog.debug("Rewriting scylla component of sstable {}", get_filename());
+
+    file_output_stream_options options;
+    options.buffer_size = sstable_buffer_size;
+    auto w = make_component_file_writer(component_type::TemporaryScylla, std::move(options),
+            open_flags::wo | open_flags::create | open_flags::truncate).get();
+    write(_version, w, *_components->scylla_metadata);
+    w.close();
+    // rename() guarantees atomicity when renaming a file into place.
+    sstable_write_io_check(rename_file, fmt::to_string(filename(component_type::TemporaryScylla)), fmt::to_string(filename(component_type::Scylla))).get();
+}
+
 future<> sstable::read_summary() noexcept {
     if (_components->summary) {
         co_return;
@@ -1383,11 +1405,21 @@ future<> sstable::open_data(sstable_open_config cfg) noexcept {
     if (ts_stats) {
         _ext_timestamp_stats.emplace(*ts_stats);
     }
+    auto* cf = _components->scylla_metadata->data.get<scylla_metadata_type::ClusteringFilter, scylla_metadata::clustering_filter>();
+    if (cf && !cf->bitset.elements.empty()) {
+        // The filter takes over the bitset.
+        _components->clustering_filter = clustering_filter::make(*_schema, std::move(*cf));
+        cf->bitset.elements = {};
+    }
     _open_mode.emplace(open_flags::ro);
     _stats.on_open_for_reading();
 
     _total_reclaimable_memory.reset();
     _manager.increment_total_reclaimable_memory(this);
+    if (_total_memory_reclaimed) {
+        // The bloom filter was not loaded, see sstable_open_config::defer_bloom_filter_load.
+        _manager.track_unloaded_components(this);
+    }
 }
 
 future<> sstable::update_info_for_opened_data(sstable_open_config cfg) {
@@ -1408,6 +1440,11 @@ future<> sstable::update_info_for_opened_data(sstable_open_config cfg) {
                                                             _manager.get_cache_tracker().region(),
                                                             _index_file_size);
     _index_file = make_cached_seastar_file(*_cached_index_file);
+    if (_components->compression) {
+        _data_chunk_cache = seastar::make_shared<chunk_cache>(_manager.get_cache_tracker().get_chunk_cache_stats(),
+                                                              _manager.get_cache_tracker().get_lru(),
+                                                              _manager.get_cache_tracker().region());
+    }
 
     this->set_min_max_position_range();
     this->set_first_and_last_keys();
@@ -1433,6 +1470,10 @@ future<> sstable::create_data() noexcept {
 future<> sstable::drop_caches() {
     co_await _cached_index_file->evict_gently();
     co_await _index_cache->evict_gently();
+    if (_data_chunk_cache) {
+        co_await _data_chunk_cache->evict_gently();
+    }
+    _attached_index.reset();
 }
 
 // Return the filter format for the given sstable version
@@ -1447,22 +1488,40 @@ future<> sstable::read_filter(sstable_open_config cfg) {
         _components->filter = std::make_unique<utils::filter::always_present_filter>();
         return make_ready_future<>();
     }
+    if (cfg.defer_bloom_filter_load) {
+        return defer_filter_load();
+    }
 
     return seastar::async([this] () mutable {
         sstables::filter filter;
         read_simple<component_type::Filter>(filter).get();
         auto nr_bits = filter.buckets.elements.size() * std::numeric_limits<typename decltype(filter.buckets.elements)::value_type>::digits;
+        if (filter_layout() == utils::filter_layout::split_block && nr_bits % utils::filter::split_block_bloom_filter::block_bits) {
+            throw malformed_sstable_exception(format("split-block bloom filter of {} bits is not made of whole blocks", nr_bits), filename(component_type::Filter));
+        }
         large_bitset bs(nr_bits, std::move(filter.buckets.elements));
-        _components->filter = utils::filter::create_filter(filter.hashes, std::move(bs), get_filter_format(_version));
+        _components->filter = utils::filter::create_filter(filter.hashes, std::move(bs), get_filter_format(_version), filter_layout());
     });
 }
 
+future<> sstable::defer_filter_load() {
+    _components->filter = std::make_unique<utils::filter::always_present_filter>();
+    // Only the size of the filter is needed to account for it in the sstables
+    // manager; the on-disk size is a close enough estimate of its memory size
+    // and the manager settles the difference when the filter is loaded.
+    auto f = co_await new_sstable_component_file(_read_error_handler, component_type::Filter, open_flags::ro);
+    auto size = co_await f.size();
+    co_await f.close();
+    _metadata_size_on_disk += size;
+    _total_memory_reclaimed = size;
+}
+
 void sstable::write_filter() {
     if (!has_component(component_type::Filter)) {
         return;
     }
 
-    auto f = downcast_ptr<utils::filter::murmur3_bloom_filter>(_components->filter.get());
+    auto f = downcast_ptr<utils::filter::bloom_filter>(_components->filter.get());
 
     auto&& bs = f->bits();
     auto filter_ref = sstables::filter_ref(f->num_hashes(), bs.get_storage());
@@ -1479,9 +1538,9 @@ void sstable::maybe_rebuild_filter_from_index(uint64_t num_partitions) {
     // false positive rate.
     auto curr_bitset_size = downcast_ptr<utils::filter::bloom_filter>(_components->filter.get())->bits().memory_size();
     auto bitset_size_lower_bound = utils::i_filter::get_filter_size(num_partitions,
-                                                                    _schema->bloom_filter_fp_chance() * 1.25);
+                                                                    _schema->bloom_filter_fp_chance() * 1.25, filter_layout());
     auto bitset_size_upper_bound = utils::i_filter::get_filter_size(num_partitions,
-                                                                    _schema->bloom_filter_fp_chance() * 0.75);
+                                                                    _schema->bloom_filter_fp_chance() * 0.75, filter_layout());
     if (bitset_size_lower_bound <= curr_bitset_size && curr_bitset_size <= bitset_size_upper_bound) {
         return;
     }
@@ -1493,7 +1552,7 @@ void sstable::maybe_rebuild_filter_from_index(uint64_t num_partitions) {
     //    - to avoid downsizing when the savings are minimal.
     //    - the fp rate is also already atleast at the configured value, so no gain there.
     // 3. Do not resize filters of garbage_collected sstables.
-    const auto optimal_filter_size = utils::i_filter::get_filter_size(num_partitions, _schema->bloom_filter_fp_chance());
+    const auto optimal_filter_size = utils::i_filter::get_filter_size(num_partitions, _schema->bloom_filter_fp_chance(), filter_layout());
     const auto filter_size_diff = std::abs<int64_t>(optimal_filter_size - curr_bitset_size);
     if (filter_size_diff < 1024 || filter_size_diff < 0.1 * curr_bitset_size || // [1]
             (curr_bitset_size > optimal_filter_size && curr_bitset_size < 16384) || // [2]
@@ -1512,7 +1571,7 @@ void sstable::maybe_rebuild_filter_from_index(uint64_t num_partitions) {
     };
 
     // Create a new filter that can optimally represent the given num_partitions.
-    auto optimal_filter = utils::i_filter::get_filter(num_partitions, _schema->bloom_filter_fp_chance(), get_filter_format(_version));
+    auto optimal_filter = utils::i_filter::get_filter(num_partitions, _schema->bloom_filter_fp_chance(), get_filter_format(_version), filter_layout());
     sstlog.info("Rebuilding bloom filter {}: resizing bitset from {} bytes to {} bytes. sstable origin: {}", filename(component_type::Filter), curr_bitset_size,
                 downcast_ptr<utils::filter::bloom_filter>(optimal_filter.get())->bits().memory_size(), _origin);
 
@@ -1567,6 +1626,7 @@ size_t sstable::reclaim_memory_from_components() {
             // No need to remove it from _recognized_components as the filter is still in disk.
             _components->filter = std::make_unique<utils::filter::always_present_filter>();
             memory_reclaimed_this_iteration += filter_memory_size;
+            _reclaimed_components_accessed = false;
         }
     }
 
@@ -1587,12 +1647,22 @@ future<> sstable::reload_reclaimed_components() {
 
     co_await utils::get_local_injector().inject("reload_reclaimed_components/pause", utils::wait_for_message(std::chrono::seconds(5)));
 
+    // The filter was already accounted for in the on-disk size of the metadata,
+    // either when the sstable was opened or when it was deferred.
+    auto metadata_size_on_disk = _metadata_size_on_disk;
     co_await read_filter();
+    _metadata_size_on_disk = metadata_size_on_disk;
     _total_reclaimable_memory.reset();
-    _total_memory_reclaimed -= _components->filter->memory_size();
+    // The memory of a filter whose load was deferred is only known once it is loaded.
+    _total_memory_reclaimed = 0;
     sstlog.info("Reloaded bloom filter of {}", get_filename());
 }
 
+void sstable::on_reclaimed_filter_access() const {
+    // The sstable is only const to the readers, the manager owns it.
+    _manager.prioritize_components_reload(const_cast<sstable&>(*this));
+}
+
 void sstable::disable_component_memory_reload() {
     if (total_reclaimable_memory_size() > 0) {
         // should be called only when the components have been dropped already
@@ -1862,7 +1932,8 @@ sstable::read_scylla_metadata() noexcept {
 
 void
 sstable::write_scylla_metadata(shard_id shard, struct run_identifier identifier,
-        std::optional<scylla_metadata::large_data_stats> ld_stats, std::optional<scylla_metadata::ext_timestamp_stats> ts_stats) {
+        std::optional<scylla_metadata::large_data_stats> ld_stats, std::optional<scylla_metadata::ext_timestamp_stats> ts_stats,
+        std::optional<scylla_metadata::clustering_filter> cf_metadata, std::optional<scylla_metadata::column_zone_maps> zone_maps) {
     auto&& first_key = get_first_decorated_key();
     auto&& last_key = get_last_decorated_key();
 
@@ -1916,6 +1987,12 @@ sstable::write_scylla_metadata(shard_id shard, struct run_identifier identifier,
 
         _components->scylla_metadata->data.set<scylla_metadata_type::ExtTimestampStats>(std::move(*ts_stats));
     }
+    if (cf_metadata) {
+        _components->scylla_metadata->data.set<scylla_metadata_type::ClusteringFilter>(std::move(*cf_metadata));
+    }
+    if (zone_maps) {
+        _components->scylla_metadata->data.set<scylla_metadata_type::ColumnZoneMaps>(std::move(*zone_maps));
+    }
 
     sstable_id sid;
     if (generation().is_uuid_based()) {
@@ -1952,6 +2029,76 @@ bool sstable::may_contain_rows(const query::clustering_row_ranges& ranges) const
     });
 }
 
+bool sstable::clustering_filter_may_contain(const utils::hashed_key& pk, const query::clustering_row_ranges& ranges) const {
+    if (!_components->clustering_filter || !has_correct_min_max_column_names()) {
+        return true;
+    }
+    return _components->clustering_filter->may_contain(*_schema, pk, ranges, _min_max_position_range);
+}
+
+const scylla_metadata::column_zone_maps* sstable::get_column_zone_maps() const noexcept {
+    if (!_components->scylla_metadata) {
+        return nullptr;
+    }
+    return _components->scylla_metadata->data.get<scylla_metadata_type::ColumnZoneMaps, scylla_metadata::column_zone_maps>();
+}
+
+future<lw_shared_ptr<const attached_index>> sstable::read_attached_index() {
+    attached_index_directory directory;
+    auto f = co_await new_sstable_component_file(_read_error_handler, component_type::AttachedIndex, open_flags::ro);
+    auto size_fut = co_await coroutine::as_future(f.size());
+    if (size_fut.failed()) {
+        co_await f.close();
+        co_return coroutine::exception(size_fut.get_exception());
+    }
+    auto size = size_fut.get();
+    // Closes the file.
+    auto r = file_random_access_reader(std::move(f), size, sstable_buffer_size);
+    std::exception_ptr ex;
+    try {
+        if (size < sizeof(uint64_t)) {
+            throw malformed_sstable_exception("attached index too small", filename(component_type::AttachedIndex));
+        }
+        uint64_t directory_offset;
+        co_await r.seek(size - sizeof(uint64_t));
+        co_await parse(*_schema, _version, r, directory_offset);
+        co_await r.seek(directory_offset);
+        co_await parse(*_schema, _version, r, directory);
+    } catch (...) {
+        ex = std::current_exception();
+    }
+    co_await r.close();
+    if (ex) {
+        co_return coroutine::exception(std::move(ex));
+    }
+    co_return make_lw_shared<const attached_index>(std::move(directory));
+}
+
+future<std::optional<utils::chunked_vector<dht::token>>> sstable::find_in_attached_index(const column_definition& cdef,
+        const interval<bytes>& values, const dht::token_range& range) {
+    if (!has_component(component_type::AttachedIndex)) {
+        co_return std::nullopt;
+    }
+    if (!_attached_index) {
+        _attached_index.emplace(read_attached_index());
+    }
+    auto index_fut = co_await coroutine::as_future(_attached_index->get_future());
+    if (index_fut.failed()) {
+        // Try again on next use.
+        _attached_index.reset();
+        co_return coroutine::exception(index_fut.get_exception());
+    }
+    auto index = index_fut.get();
+    auto* column = index->find_column(cdef);
+    if (!column) {
+        co_return std::nullopt;
+    }
+    auto f = co_await new_sstable_component_file(_read_error_handler, component_type::AttachedIndex, open_flags::ro);
+    auto tokens_fut = co_await coroutine::as_future(attached_index::lookup(f, *column, *cdef.type, values, range));
+    co_await f.close();
+    co_return co_await std::move(tokens_fut);
+}
+
 future<> sstable::seal_sstable(bool backup)
 {
     co_await _storage->seal(*this);
@@ -2180,6 +2327,21 @@ bool sstable::is_shared() const {
     return _shards.size() > 1;
 }
 
+void sstable::decay_read_amplification_hits(lowres_clock::time_point now) const noexcept {
+    if (now > _read_hits_updated) {
+        _recent_read_hits *= std::exp2(-std::chrono::duration<double>(now - _read_hits_updated) / read_amplification_half_life);
+        _read_hits_updated = now;
+    }
+    auto hits = _read_count + _filter_tracker.false_positive;
+    _recent_read_hits += hits - _decayed_read_hits;
+    _decayed_read_hits = hits;
+}
+
+uint64_t sstable::read_amplification_hits(lowres_clock::time_point now) const noexcept {
+    decay_read_amplification_hits(now);
+    return std::llround(_recent_read_hits);
+}
+
 uint64_t sstable::data_size() const {
     if (has_component(component_type::CompressionInfo)) {
         return _components->compression.uncompressed_file_length();
@@ -2500,7 +2662,7 @@ component_type sstable::component_from_sstring(version_types v, const sstring &s
 
 future<input_stream<char>> sstable::data_stream(uint64_t pos, size_t len,
         reader_permit permit, tracing::trace_state_ptr trace_state, lw_shared_ptr<file_input_stream_history> history, raw_stream raw,
-        integrity_check integrity, integrity_error_handler error_handler) {
+        integrity_check integrity, integrity_error_handler error_handler, use_caching caching) {
     file_input_stream_options options;
     options.buffer_size = sstable_buffer_size;
     options.read_ahead = 4;
@@ -2519,12 +2681,13 @@ future<input_stream<char>> sstable::data_stream(uint64_t pos, size_t len,
         co_return input_stream<char>(co_await _storage->make_data_or_index_source(*this, component_type::Data, std::move(f), pos, len, std::move(options)));
     };
     if (_components->compression && raw == raw_stream::no) {
+        auto* cache = caching ? _data_chunk_cache.get() : nullptr;
         if (_version >= sstable_version_types::mc) {
             co_return make_compressed_file_m_format_input_stream(stream_creator, &_components->compression,
-               pos, len, std::move(options), permit, digest);
+               pos, len, std::move(options), permit, digest, cache);
         } else {
             co_return make_compressed_file_k_l_format_input_stream(stream_creator, &_components->compression,
-                pos, len, std::move(options), permit, digest);
+                pos, len, std::move(options), permit, digest, cache);
         }
     }
     if (_components->checksum && integrity == integrity_check::yes) {
@@ -2768,6 +2931,21 @@ void sstable::set_first_and_last_keys() {
     _last = std::move(last);
 }
 
+void sstable::set_synthetic_metadata(uint64_t data_size, dht::decorated_key first, dht::decorated_key last, stats_metadata stats, run_id run) {
+    // Components other than Data are accounted as negligible, but not as
+    // absent, as that's what bytes_on_disk() takes as unset sizes.
+    _data_file_size = std::max<uint64_t>(data_size, 1);
+    _index_file_size = 1;
+    _metadata_size_on_disk = 1;
+    _recognized_components.insert(component_type::Scylla);
+    _components->statistics.contents[metadata_type::Stats] = std::make_unique<stats_metadata>(std::move(stats));
+    _components->statistics.contents[metadata_type::Compaction] = std::make_unique<compaction_metadata>();
+    _first = std::move(first);
+    _last = std::move(last);
+    _run_identifier = run;
+    _shards = {this_shard_id()};
+}
+
 const partition_key& sstable::get_first_partition_key() const {
     return get_first_decorated_key().key();
  }
@@ -2849,6 +3027,25 @@ future<> sstable::mutate_sstable_level(uint32_t new_level) {
     });
 }
 
+future<> sstable::mutate_run_identifier(run_id new_run_id) {
+    if (!has_component(component_type::Scylla) || !_components->scylla_metadata) {
+        return make_exception_future<>(std::runtime_error(format("Cannot change run identifier of {} without a Scylla component", get_filename())));
+    }
+    auto& data = _components->scylla_metadata->data;
+    data.set<scylla_metadata_type::RunIdentifier>(run_identifier{new_run_id});
+    if (generation().is_uuid_based()) {
+        data.set<scylla_metadata_type::SSTableIdentifier>(scylla_metadata::sstable_identifier{sstable_id(generation().as_uuid())});
+        _sstable_identifier = sstable_id(generation().as_uuid());
+    }
+    _run_identifier = new_run_id;
+    // The Scylla component is rewritten, rather than modified in place, so
+    // that an sstable sharing its files with another one through hard links
+    // doesn't affect it.
+    return seastar::async([this] {
+        rewrite_scylla_metadata();
+    });
+}
+
 int sstable::compare_by_max_timestamp(const sstable& other) const {
     auto ts1 = get_stats_metadata().max_timestamp;
     auto ts2 = other.get_stats_metadata().max_timestamp;
@@ -3138,6 +3335,22 @@ void register_index_page_cache_metrics(seastar::metrics::metric_groups& metrics,
     });
 }
 
+void register_data_chunk_cache_metrics(seastar::metrics::metric_groups& metrics, chunk_cache_stats& m) {
+    namespace sm = seastar::metrics;
+    metrics.add_group("sstables", {
+        sm::make_counter("data_chunk_cache_hits", [&m] { return m.hits; },
+            sm::description("Data chunk reads which were served from cache without I/O and decompression")),
+        sm::make_counter("data_chunk_cache_misses", [&m] { return m.misses; },
+            sm::description("Data chunk reads which had to read and decompress the chunk")),
+        sm::make_counter("data_chunk_cache_evictions", [&m] { return m.evictions; },
+            sm::description("Total number of decompressed data chunks which have been evicted")),
+        sm::make_counter("data_chunk_cache_populations", [&m] { return m.populations; },
+            sm::description("Total number of decompressed data chunks which were inserted into the cache")),
+        sm::make_gauge("data_chunk_cache_bytes", [&m] { return m.cached_bytes; },
+            sm::description("Total number of bytes cached in the data chunk cache")),
+    });
+}
+
 void register_index_page_metrics(seastar::metrics::metric_groups& metrics, partition_index_cache_stats& m) {
     namespace sm = seastar::metrics;
     metrics.add_group("sstables", {
@@ -3310,6 +3523,9 @@ future<> sstable::destroy() {
     if (_cached_index_file) {
         co_await _cached_index_file->evict_gently();
     }
+    if (_data_chunk_cache) {
+        co_await _data_chunk_cache->evict_gently();
+    }
     co_await _storage->destroy(*this);
 
     if (ex) {
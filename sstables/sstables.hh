@@ -19,6 +19,8 @@
 #include <seastar/core/sstring.hh>
 #include <seastar/core/enum.hh>
 #include <seastar/core/shared_ptr.hh>
+#include <seastar/core/shared_future.hh>
+#include <seastar/core/lowres_clock.hh>
 #include <unordered_set>
 #include <unordered_map>
 #include <variant>
@@ -37,6 +39,7 @@
 #include "sstables/storage.hh"
 #include "sstables/generation_type.hh"
 #include "sstables/types.hh"
+#include "sstables/attached_index.hh"
 #include "sstables/checksummed_data_source.hh"
 #include "mutation/mutation_fragment_stream_validator.hh"
 #include "readers/mutation_reader_fwd.hh"
@@ -65,8 +68,10 @@ class corrupt_data_handler;
 namespace sstables {
 
 struct abstract_index_reader;
+class chunk_cache;
 class sstable_directory;
 extern thread_local utils::updateable_value<bool> global_cache_index_pages;
+extern thread_local utils::updateable_value<bool> global_cache_data_chunks;
 
 namespace mc {
 class writer;
@@ -395,6 +400,10 @@ class sstable : public enable_lw_shared_from_this<sstable> {
         return _version;
     }
 
+    format_types get_format() const {
+        return _format;
+    }
+
     // Returns the total bytes of all components.
     uint64_t bytes_on_disk() const;
 
@@ -545,6 +554,10 @@ class sstable : public enable_lw_shared_from_this<sstable> {
     std::set<generation_type> _compaction_ancestors;
     file _index_file;
     seastar::shared_ptr<cached_file> _cached_index_file;
+    // Decompressed chunks of _data_file. Only set for compressed sstables.
+    seastar::shared_ptr<chunk_cache> _data_chunk_cache;
+    // The directory of the AttachedIndex component, read on first use.
+    std::optional<shared_future<lw_shared_ptr<const attached_index>>> _attached_index;
     file _data_file;
     uint64_t _data_file_size;
     uint64_t _index_file_size;
@@ -576,6 +589,14 @@ class sstable : public enable_lw_shared_from_this<sstable> {
     const format_types _format;
 
     filter_tracker _filter_tracker;
+    // Number of single-partition reads this sstable was selected for, i.e.
+    // which it passed the key range, bloom filter and clustering filters of.
+    uint64_t _read_count = 0;
+    // See read_amplification_hits(): the decayed hits as of _read_hits_updated,
+    // and the raw hits they account for.
+    mutable double _recent_read_hits = 0;
+    mutable uint64_t _decayed_read_hits = 0;
+    mutable lowres_clock::time_point _read_hits_updated = lowres_clock::now();
     std::unique_ptr<partition_index_cache> _index_cache;
 
     enum class mark_for_deletion {
@@ -617,6 +638,9 @@ class sstable : public enable_lw_shared_from_this<sstable> {
     mutable std::optional<size_t> _total_reclaimable_memory{0};
     // Total memory reclaimed so far from this sstable
     size_t _total_memory_reclaimed{0};
+    // Set when a read consults the filter while its memory is reclaimed.
+    // Takes part in the ordering of the _reclaimed set of sstables manager.
+    mutable bool _reclaimed_components_accessed = false;
 public:
     bool has_component(component_type f) const;
     sstables_manager& manager() { return _manager; }
@@ -653,6 +677,7 @@ class sstable : public enable_lw_shared_from_this<sstable> {
 
     void generate_toc();
     void open_sstable(const sstring& origin);
+    future<lw_shared_ptr<const attached_index>> read_attached_index();
 
     future<> read_compression();
     void write_compression();
@@ -662,9 +687,13 @@ class sstable : public enable_lw_shared_from_this<sstable> {
     void write_scylla_metadata(shard_id shard,
                                run_identifier identifier,
                                std::optional<scylla_metadata::large_data_stats> ld_stats,
-                               std::optional<scylla_metadata::ext_timestamp_stats> ts_stats);
+                               std::optional<scylla_metadata::ext_timestamp_stats> ts_stats,
+                               std::optional<scylla_metadata::clustering_filter> cf_metadata = std::nullopt,
+                               std::optional<scylla_metadata::column_zone_maps> zone_maps = std::nullopt);
 
     future<> read_filter(sstable_open_config cfg = {});
+    // Leave the filter on disk and account for it as reclaimed memory.
+    future<> defer_filter_load();
 
     void write_filter();
     // Rebuild a bloom filter from the index with the given number of
@@ -691,6 +720,8 @@ class sstable : public enable_lw_shared_from_this<sstable> {
     // Rewrite statistics component by creating a temporary Statistics and
     // renaming it into place of existing one.
     void rewrite_statistics();
+    // Same as rewrite_statistics(), for the Scylla component.
+    void rewrite_scylla_metadata();
     // Validate metadata that's used to optimize reads when user specifies
     // a clustering key range. If this specific metadata is incorrect, then
     // it should be cleared. Otherwise, it could lead to bad decisions.
@@ -726,6 +757,12 @@ class sstable : public enable_lw_shared_from_this<sstable> {
     future<> reload_reclaimed_components();
     // Disable reload of components for this sstable
     void disable_component_memory_reload();
+    // Whether a read consulted the filter since its memory was reclaimed
+    bool reclaimed_components_accessed() const {
+        return _reclaimed_components_accessed;
+    }
+    // Ask the manager to reload the filter of this sstable ahead of the others
+    void on_reclaimed_filter_access() const;
 
 public:
     // Finds first position_in_partition in a given partition.
@@ -753,11 +790,16 @@ class sstable : public enable_lw_shared_from_this<sstable> {
     // logic when a checksum or digest mismatch is detected on an
     // integrity-checked stream with no compression. The parameter is ignored
     // if integrity checking is disabled or the SSTable is compressed.
+    //
+    // If `caching` is set, decompressed chunks of a compressed SSTable are
+    // read from, and populated into, the global cache. Ignored for
+    // uncompressed SSTables and for raw or integrity-checked streams.
     using raw_stream = bool_class<class raw_stream_tag>;
     future<input_stream<char>> data_stream(uint64_t pos, size_t len,
             reader_permit permit, tracing::trace_state_ptr trace_state, lw_shared_ptr<file_input_stream_history> history,
             raw_stream raw = raw_stream::no, integrity_check integrity = integrity_check::no,
-            integrity_error_handler error_handler = throwing_integrity_error_handler);
+            integrity_error_handler error_handler = throwing_integrity_error_handler,
+            use_caching caching = use_caching::no);
 
     // Read exactly the specific byte range from the data file (after
     // uncompression, if the file is compressed). This can be used to read
@@ -830,6 +872,10 @@ class sstable : public enable_lw_shared_from_this<sstable> {
         return has_feature(sstable_feature::ShadowableTombstones);
     }
 
+    utils::filter_layout filter_layout() const {
+        return has_feature(sstable_feature::SplitBlockFilter) ? utils::filter_layout::split_block : utils::filter_layout::classic;
+    }
+
     sstable_enabled_features features() const {
         return _features;
     }
@@ -855,6 +901,9 @@ class sstable : public enable_lw_shared_from_this<sstable> {
     }
 
     bool filter_has_key(const key& key) const {
+        if (_total_memory_reclaimed && !_reclaimed_components_accessed) [[unlikely]] {
+            on_reclaimed_filter_access();
+        }
         return _components->filter->is_present(bytes_view(key));
     }
 
@@ -867,6 +916,9 @@ class sstable : public enable_lw_shared_from_this<sstable> {
     future<bool> has_partition_key(const utils::hashed_key& hk, const dht::decorated_key& dk);
 
     bool filter_has_key(utils::hashed_key key) const {
+        if (_total_memory_reclaimed && !_reclaimed_components_accessed) [[unlikely]] {
+            on_reclaimed_filter_access();
+        }
         return _components->filter->is_present(key);
     }
 
@@ -895,6 +947,24 @@ class sstable : public enable_lw_shared_from_this<sstable> {
         return t;
     }
 
+private:
+    void decay_read_amplification_hits(lowres_clock::time_point now) const noexcept;
+public:
+    void add_read() noexcept {
+        ++_read_count;
+        decay_read_amplification_hits(lowres_clock::now());
+    }
+    uint64_t get_read_count() const noexcept {
+        return _read_count;
+    }
+    static constexpr std::chrono::seconds read_amplification_half_life{300};
+    // How much this sstable costs to single-partition reads lately: the number
+    // of reads it was selected for, with the ones which were bloom filter false
+    // positives counted twice, since those are pure waste. Hits are halved every
+    // read_amplification_half_life, so that an sstable read a lot long ago
+    // doesn't outrank the ones read now.
+    uint64_t read_amplification_hits(lowres_clock::time_point now = lowres_clock::now()) const noexcept;
+
     const statistics& get_statistics() const {
         return _components->statistics;
     }
@@ -961,6 +1031,11 @@ class sstable : public enable_lw_shared_from_this<sstable> {
         _run_identifier = run_id::create_random_id();
     }
 
+    // Makes this sstable describe data it doesn't have, such that it can be
+    // fed to compaction strategies without any I/O, e.g. by simulations.
+    // The sstable has no components on disk and must not be read.
+    void set_synthetic_metadata(uint64_t data_size, dht::decorated_key first, dht::decorated_key last, stats_metadata stats, run_id run);
+
     double get_compression_ratio() const;
 
     const sstables::compression& get_compression() const {
@@ -968,6 +1043,10 @@ class sstable : public enable_lw_shared_from_this<sstable> {
     }
 
     future<> mutate_sstable_level(uint32_t);
+    // Makes the sstable part of the given run. Also assigns it a new sstable
+    // identifier, derived from its generation, as it's meant to be used on
+    // sstables cloned from another one.
+    future<> mutate_run_identifier(run_id);
 
     const summary& get_summary() const {
         return _components->summary;
@@ -1002,6 +1081,24 @@ class sstable : public enable_lw_shared_from_this<sstable> {
     // Return true if this sstable possibly stores clustering row(s) specified by ranges.
     bool may_contain_rows(const query::clustering_row_ranges& ranges) const;
 
+    bool has_clustering_filter() const {
+        return bool(_components->clustering_filter);
+    }
+
+    // Return true if this sstable possibly stores data of the partition in the clustering ranges,
+    // according to its clustering filter, if it has one.
+    bool clustering_filter_may_contain(const utils::hashed_key& pk, const query::clustering_row_ranges& ranges) const;
+
+    // Return the ranges of the values of the regular columns of this sstable, if it has them,
+    // see sstables/column_zone_maps.hh.
+    const scylla_metadata::column_zone_maps* get_column_zone_maps() const noexcept;
+
+    // Return the tokens, in `range`, of the partitions which may have a value of the column in `values`,
+    // according to the sstable-attached index of the column, see sstables/attached_index.hh.
+    // Disengaged if the sstable has no index of the column.
+    future<std::optional<utils::chunked_vector<dht::token>>> find_in_attached_index(const column_definition& cdef,
+            const interval<bytes>& values, const dht::token_range& range);
+
     // false => there are no partition tombstones, true => we don't know
     bool may_have_partition_tombstones() const {
         return !has_correct_min_max_column_names()
@@ -1038,8 +1135,10 @@ class sstable : public enable_lw_shared_from_this<sstable> {
 
     struct lesser_reclaimed_memory {
         // comparator class to be used by the _reclaimed set in sstables manager
+        // sstables that were read from since their memory was reclaimed come first.
         bool operator()(const sstable& sst1, const sstable& sst2) const {
-            return sst1.total_memory_reclaimed() < sst2.total_memory_reclaimed();
+            return std::tuple(!sst1.reclaimed_components_accessed(), sst1.total_memory_reclaimed())
+                    < std::tuple(!sst2.reclaimed_components_accessed(), sst2.total_memory_reclaimed());
         }
     };
 
@@ -1063,7 +1162,7 @@ class sstable : public enable_lw_shared_from_this<sstable> {
     data_consume_rows(const schema&, shared_sstable, typename DataConsumeRowsContext::consumer&, disk_read_range, uint64_t, integrity_check);
     template <typename DataConsumeRowsContext>
     friend future<std::unique_ptr<DataConsumeRowsContext>>
-    data_consume_single_partition(const schema&, shared_sstable, typename DataConsumeRowsContext::consumer&, disk_read_range, integrity_check);
+    data_consume_single_partition(const schema&, shared_sstable, typename DataConsumeRowsContext::consumer&, disk_read_range, integrity_check, use_caching);
     template <typename DataConsumeRowsContext>
     friend future<std::unique_ptr<DataConsumeRowsContext>>
     data_consume_rows(const schema&, shared_sstable, typename DataConsumeRowsContext::consumer&, integrity_check);
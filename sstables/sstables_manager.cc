@@ -193,6 +193,25 @@ void sstables_manager::increment_total_reclaimable_memory(sstable* sst) {
     _components_memory_change_event.signal();
 }
 
+void sstables_manager::track_unloaded_components(sstable* sst) {
+    _total_memory_reclaimed += sst->total_memory_reclaimed();
+    _reclaimed.insert(*sst);
+    _components_memory_change_event.signal();
+}
+
+void sstables_manager::prioritize_components_reload(sstable& sst) {
+    // The access flag is part of the ordering of _reclaimed,
+    // so it may only change while the sstable is out of the set.
+    if (!sst._manager_set_link.is_linked()) {
+        sst._reclaimed_components_accessed = true;
+        return;
+    }
+    sst._manager_set_link.unlink();
+    sst._reclaimed_components_accessed = true;
+    _reclaimed.insert(sst);
+    _components_memory_change_event.signal();
+}
+
 future<> sstables_manager::maybe_reclaim_components() {
     while(_total_reclaimable_memory > get_components_memory_reclaim_threshold()) {
         // Memory consumption is above threshold. Reclaim from the SSTable that
@@ -250,7 +269,8 @@ future<> sstables_manager::components_reclaim_reload_fiber() {
 
 future<> sstables_manager::maybe_reload_components() {
     // Reload bloom filters from the smallest to largest so as to maximize
-    // the number of bloom filters being reloaded.
+    // the number of bloom filters being reloaded, starting with the ones of
+    // sstables that are being read from (see sstable::lesser_reclaimed_memory).
     auto memory_available = get_memory_available_for_reclaimable_components();
     while (!_reclaimed.empty() && memory_available > 0) {
         auto sstable_to_reload = _reclaimed.begin();
@@ -274,10 +294,12 @@ future<> sstables_manager::maybe_reload_components() {
             sstlog.warn("Failed to reload reclaimed SSTable components : {}", std::current_exception());
             // revert back changes made before the reload
             _total_reclaimable_memory -= reclaimed_memory;
-            _reclaimed.insert(*sstable_to_reload);
+            _reclaimed.insert(*sstable_ptr);
             break;
         }
 
+        // The memory of a filter whose load was deferred was only estimated.
+        _total_reclaimable_memory = _total_reclaimable_memory - reclaimed_memory + sstable_ptr->total_reclaimable_memory_size();
         _total_memory_reclaimed -= reclaimed_memory;
         memory_available = get_memory_available_for_reclaimable_components();
     }
@@ -286,11 +308,14 @@ future<> sstables_manager::maybe_reload_components() {
 void sstables_manager::reclaim_memory_and_stop_tracking_sstable(sstable* sst) {
     // remove the sstable from the memory tracking metrics
     _total_reclaimable_memory -= sst->total_reclaimable_memory_size();
-    _total_memory_reclaimed -= sst->total_memory_reclaimed();
+    // an sstable whose load failed after its filter was deferred was never tracked
+    if (sst->_manager_set_link.is_linked()) {
+        _total_memory_reclaimed -= sst->total_memory_reclaimed();
+        sst->_manager_set_link.unlink();
+    }
     // reclaim any remaining memory from the sstable
     sst->reclaim_memory_from_components();
     // disable further reload of components
-    _reclaimed.erase(*sst);
     sst->disable_component_memory_reload();
 }
 
@@ -251,6 +251,11 @@ class sstables_manager {
 
     // Increment the _total_reclaimable_memory with the new SSTable's reclaimable memory
     void increment_total_reclaimable_memory(sstable* sst);
+    // Track an SSTable opened without loading its bloom filter as a reclaimed one,
+    // so that the filter is loaded by the reload fiber once memory is available.
+    void track_unloaded_components(sstable* sst);
+    // Move a reclaimed SSTable that is being read from ahead of the others for reload.
+    void prioritize_components_reload(sstable& sst);
     // Fiber to reload reclaimed components back into memory when memory becomes available.
     future<> components_reclaim_reload_fiber();
     // Reclaims components from SSTables if total memory usage exceeds the threshold.
@@ -497,7 +497,8 @@ enum sstable_feature : uint8_t {
     CorrectEmptyCounters = 4, // See #4363
     CorrectUDTsInCollections = 5, // See #6130
     CorrectLastPiBlockWidth = 6,
-    End = 7,
+    SplitBlockFilter = 7, // Filter.db holds a split-block bloom filter
+    End = 8,
 };
 
 // Scylla-specific features enabled for a particular sstable.
@@ -542,6 +543,8 @@ enum class scylla_metadata_type : uint32_t {
     ScyllaVersion = 8,
     ExtTimestampStats = 9,
     SSTableIdentifier = 10,
+    ClusteringFilter = 11,
+    ColumnZoneMaps = 12,
 };
 
 // UUID is used for uniqueness across nodes, such that an imported sstable
@@ -598,6 +601,68 @@ enum class ext_timestamp_stats_type : uint32_t {
     min_live_row_marker_timestamp = 2,
 };
 
+// Filter of the (partition key, clustering prefix bucket) pairs which have data
+// in the sstable, see sstables/clustering_filter.hh.
+struct clustering_filter_metadata {
+    // Width of a bucket of values of the first clustering column.
+    int64_t bucket_width;
+    // Bitset of a split-block bloom filter.
+    disk_array<uint32_t, uint64_t> bitset;
+
+    template <typename Describer>
+    auto describe_type(sstable_version_types v, Describer f) { return f(bucket_width, bitset); }
+};
+
+// Range of the values of a regular column in the sstable, see sstables/column_zone_maps.hh.
+struct column_zone_map {
+    disk_string<uint32_t> column_name;
+    // Smallest and largest value of the column; meaningless if value_count is 0.
+    disk_string<uint32_t> min;
+    disk_string<uint32_t> max;
+    // Number of cells of the column with a value.
+    uint64_t value_count;
+    // Number of clustering rows without a value of the column.
+    uint64_t null_count;
+
+    template <typename Describer>
+    auto describe_type(sstable_version_types v, Describer f) { return f(column_name, min, max, value_count, null_count); }
+};
+
+// Location of a block of entries of an sstable-attached index, see sstables/attached_index.hh.
+struct attached_index_block {
+    // Value of the first entry of the block.
+    disk_string<uint32_t> first_value;
+    uint64_t offset;
+    uint32_t size;
+
+    template <typename Describer>
+    auto describe_type(sstable_version_types v, Describer f) { return f(first_value, offset, size); }
+};
+
+// A run of entries of an sstable-attached index, sorted by value and token.
+struct attached_index_segment {
+    disk_array<uint32_t, attached_index_block> blocks;
+
+    template <typename Describer>
+    auto describe_type(sstable_version_types v, Describer f) { return f(blocks); }
+};
+
+struct attached_index_column {
+    disk_string<uint32_t> column_name;
+    disk_array<uint32_t, attached_index_segment> segments;
+
+    template <typename Describer>
+    auto describe_type(sstable_version_types v, Describer f) { return f(column_name, segments); }
+};
+
+// Directory of the AttachedIndex component, written at its end.
+struct attached_index_directory {
+    disk_array<uint32_t, attached_index_column> columns;
+
+    template <typename Describer>
+    auto describe_type(sstable_version_types v, Describer f) { return f(columns); }
+};
+
 struct scylla_metadata {
     using extension_attributes = disk_hash<uint32_t, disk_string<uint32_t>, disk_string<uint32_t>>;
     using large_data_stats = disk_hash<uint32_t, large_data_type, large_data_stats_entry>;
@@ -606,6 +671,8 @@ struct scylla_metadata {
     using scylla_version = disk_string<uint32_t>;
     using ext_timestamp_stats = disk_hash<uint32_t, ext_timestamp_stats_type, int64_t>;
     using sstable_identifier = sstable_identifier_type;
+    using clustering_filter = clustering_filter_metadata;
+    using column_zone_maps = disk_array<uint32_t, column_zone_map>;
 
     disk_set_of_tagged_union<scylla_metadata_type,
             disk_tagged_union_member<scylla_metadata_type, scylla_metadata_type::Sharding, sharding_metadata>,
@@ -617,7 +684,9 @@ struct scylla_metadata {
             disk_tagged_union_member<scylla_metadata_type, scylla_metadata_type::ScyllaBuildId, scylla_build_id>,
             disk_tagged_union_member<scylla_metadata_type, scylla_metadata_type::ScyllaVersion, scylla_version>,
             disk_tagged_union_member<scylla_metadata_type, scylla_metadata_type::ExtTimestampStats, ext_timestamp_stats>,
-            disk_tagged_union_member<scylla_metadata_type, scylla_metadata_type::SSTableIdentifier, sstable_identifier>
+            disk_tagged_union_member<scylla_metadata_type, scylla_metadata_type::SSTableIdentifier, sstable_identifier>,
+            disk_tagged_union_member<scylla_metadata_type, scylla_metadata_type::ClusteringFilter, clustering_filter>,
+            disk_tagged_union_member<scylla_metadata_type, scylla_metadata_type::ColumnZoneMaps, column_zone_maps>
             > data;
 
     sstable_enabled_features get_features() const {
@@ -38,6 +38,9 @@ struct sstable_writer::writer_impl {
         if (!cfg.correct_pi_block_width) {
             _features.disable(CorrectLastPiBlockWidth);
         }
+        if (_schema.bloom_filter_layout() != utils::filter_layout::split_block) {
+            _features.disable(SplitBlockFilter);
+        }
         sst.set_features(_features);
     }
 
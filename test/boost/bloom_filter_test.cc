@@ -15,6 +15,7 @@
 
 #include "db/config.hh"
 #include "readers/from_mutations.hh"
+#include "schema/schema_builder.hh"
 #include "utils/bloom_filter.hh"
 #include "utils/error_injection.hh"
 #include "utils/i_filter.hh"
@@ -190,6 +191,77 @@ SEASTAR_TEST_CASE(test_bloom_filter_reclaim_during_reload) {
     });
 }
 
+// Writes an sstable with the given number of partitions and reopens it with its bloom filter load deferred.
+static std::pair<shared_sstable, std::vector<dht::decorated_key>> make_sstable_with_deferred_bloom_filter(test_env& env, simple_schema& ss, size_t partition_count) {
+    auto s = ss.schema();
+    auto pks = ss.make_pkeys(partition_count);
+    utils::chunked_vector<mutation> muts;
+    for (const auto& pk : pks) {
+        auto mut = mutation(s, pk);
+        mut.partition().apply_insert(*s, ss.make_ckey(0), ss.new_timestamp());
+        muts.push_back(std::move(mut));
+    }
+    auto written = make_sstable_containing(env.make_sstable(s), std::move(muts));
+    auto sst = env.reusable_sst(s, env.tempdir().path().native(), written->generation(), written->get_version(),
+            sstable::format_types::big, {.defer_bloom_filter_load = true}).get();
+    BOOST_REQUIRE_EQUAL(sst->bytes_on_disk(), written->bytes_on_disk());
+    return {std::move(sst), std::move(pks)};
+}
+
+SEASTAR_TEST_CASE(test_deferred_bloom_filter_load) {
+    return test_env::do_with_async([] (test_env& env) {
+        simple_schema ss;
+        auto s = ss.schema();
+        auto& sst_mgr = env.manager();
+
+        auto [sst, pks] = make_sstable_with_deferred_bloom_filter(env, ss, 100);
+        const auto bytes_on_disk = sst->bytes_on_disk();
+        // Until the filter is loaded, every key is reported as present.
+        BOOST_REQUIRE(sst->filter_has_key(*s, ss.make_pkey(1000).key()));
+
+        // The reload fiber loads the filter since there is enough memory for it.
+        REQUIRE_EVENTUALLY_EQUAL<bool>([&] { return sst->filter_memory_size() > 0; }, true);
+        REQUIRE_EVENTUALLY_EQUAL<size_t>([&] { return sst_mgr.get_total_memory_reclaimed(); }, 0);
+        BOOST_REQUIRE_EQUAL(sst_mgr.get_total_reclaimable_memory(), sst->filter_memory_size());
+        BOOST_REQUIRE_EQUAL(sst->bytes_on_disk(), bytes_on_disk);
+        for (const auto& pk : pks) {
+            BOOST_REQUIRE(sst->filter_has_key(*s, pk.key()));
+        }
+    });
+}
+
+SEASTAR_TEST_CASE(test_deferred_bloom_filter_load_prefers_accessed_sstables) {
+    return test_env::do_with_async([] (test_env& env) {
+        simple_schema ss;
+        auto s = ss.schema();
+        auto& sst_mgr = env.manager();
+
+        // Neither filter fits under the threshold, so both stay unloaded.
+        auto [small, small_pks] = make_sstable_with_deferred_bloom_filter(env, ss, 200);
+        auto [large, large_pks] = make_sstable_with_deferred_bloom_filter(env, ss, 400);
+        auto& reclaimed = sst_mgr.get_reclaimed_set();
+        BOOST_REQUIRE_EQUAL(std::distance(reclaimed.begin(), reclaimed.end()), 2);
+        BOOST_REQUIRE_EQUAL(&*reclaimed.begin(), small.get());
+        BOOST_REQUIRE_EQUAL(sst_mgr.get_total_memory_reclaimed(), sstables::test(small).total_memory_reclaimed() + sstables::test(large).total_memory_reclaimed());
+
+        // A read of the larger sstable moves it to the front of the reload queue.
+        BOOST_REQUIRE(large->filter_has_key(*s, large_pks[0].key()));
+        BOOST_REQUIRE_EQUAL(std::distance(reclaimed.begin(), reclaimed.end()), 2);
+        BOOST_REQUIRE_EQUAL(&*reclaimed.begin(), large.get());
+        BOOST_REQUIRE_EQUAL(large->filter_memory_size(), 0);
+
+        // Both are dropped from the reclaimed set once released.
+        small = {};
+        large = {};
+        BOOST_REQUIRE(reclaimed.empty());
+        BOOST_REQUIRE_EQUAL(sst_mgr.get_total_memory_reclaimed(), 0);
+    }, {
+        // limit available memory to the sstables_manager to keep the filters unloaded.
+        // this will set the reclaim threshold to 100 bytes.
+        .available_memory = 500
+    });
+}
+
 SEASTAR_TEST_CASE(test_bloom_filters_with_bad_partition_estimates) {
     return test_env::do_with_async([](test_env& env) {
         simple_schema ss;
@@ -246,6 +318,82 @@ SEASTAR_TEST_CASE(test_bloom_filters_with_bad_partition_estimates) {
     });
 };
 
+SEASTAR_TEST_CASE(test_split_block_bloom_filter) {
+    return seastar::async([] {
+        const auto nr_keys = 10000;
+        const auto fp_chance = 0.01;
+        auto make_key = [] (int i) {
+            return to_bytes(fmt::format("key-{}", i));
+        };
+
+        auto filter = utils::i_filter::get_filter(nr_keys, fp_chance, utils::filter_format::m_format, utils::filter_layout::split_block);
+        auto& bits = static_cast<utils::filter::bloom_filter*>(filter.get())->bits();
+        BOOST_REQUIRE_EQUAL(bits.size() % utils::filter::split_block_bloom_filter::block_bits, 0);
+        BOOST_REQUIRE_EQUAL(bits.memory_size(), utils::i_filter::get_filter_size(nr_keys, fp_chance, utils::filter_layout::split_block));
+
+        for (int i = 0; i < nr_keys; ++i) {
+            filter->add(make_key(i));
+        }
+        for (int i = 0; i < nr_keys; ++i) {
+            BOOST_REQUIRE(filter->is_present(make_key(i)));
+        }
+        int false_positives = 0;
+        for (int i = nr_keys; i < 11 * nr_keys; ++i) {
+            false_positives += filter->is_present(make_key(i));
+        }
+        BOOST_REQUIRE_LT(false_positives, 10 * nr_keys * fp_chance * 1.5);
+
+        // The bitset is all there is to the filter, like it would be after reading it from Filter.db.
+        auto storage = bits.get_storage();
+        auto reloaded = utils::filter::create_filter(0, large_bitset(bits.size(), std::move(storage)), utils::filter_format::m_format, utils::filter_layout::split_block);
+        for (int i = 0; i < nr_keys; ++i) {
+            BOOST_REQUIRE(reloaded->is_present(make_key(i)));
+        }
+
+        // Versions which don't know the layout read it as a classic filter with no hashes, which never rules a key out.
+        storage = bits.get_storage();
+        auto as_classic = utils::filter::create_filter(0, large_bitset(bits.size(), std::move(storage)), utils::filter_format::m_format);
+        for (int i = nr_keys; i < 2 * nr_keys; ++i) {
+            BOOST_REQUIRE(as_classic->is_present(make_key(i)));
+        }
+    });
+}
+
+SEASTAR_TEST_CASE(test_split_block_bloom_filter_in_sstable) {
+    return test_env::do_with_async([] (test_env& env) {
+        simple_schema ss;
+        auto schema = schema_builder(ss.schema()).set_bloom_filter_layout(utils::filter_layout::split_block).build();
+        BOOST_REQUIRE(schema->bloom_filter_layout() == utils::filter_layout::split_block);
+
+        utils::chunked_vector<mutation> mutations;
+        auto pks = ss.make_pkeys(100);
+        for (auto& pk : pks) {
+            auto mut = mutation(schema, pk);
+            mut.partition().apply_insert(*schema, ss.make_ckey(1), ss.new_timestamp());
+            mutations.push_back(std::move(mut));
+        }
+        auto sst = make_sstable_containing(env.make_sstable(schema), std::move(mutations));
+        auto check = [&] (sstables::shared_sstable sst) {
+            BOOST_REQUIRE(sst->has_feature(sstables::sstable_feature::SplitBlockFilter));
+            BOOST_REQUIRE(sst->filter_layout() == utils::filter_layout::split_block);
+            auto& filter = sstables::test(sst).get_filter();
+            BOOST_REQUIRE(dynamic_cast<utils::filter::split_block_bloom_filter*>(filter.get()));
+            for (auto& pk : pks) {
+                BOOST_REQUIRE(filter->is_present(key::from_partition_key(*schema, pk.key()).get_bytes()));
+            }
+        };
+        check(sst);
+        check(env.reusable_sst(sst).get());
+
+        // The table's layout doesn't affect sstables written with the other one.
+        auto classic_mut = mutation(ss.schema(), pks[0]);
+        classic_mut.partition().apply_insert(*ss.schema(), ss.make_ckey(1), ss.new_timestamp());
+        auto classic_sst = make_sstable_containing(env.make_sstable(ss.schema()), {std::move(classic_mut)});
+        BOOST_REQUIRE(!classic_sst->has_feature(sstables::sstable_feature::SplitBlockFilter));
+        BOOST_REQUIRE(env.reusable_sst(schema, classic_sst).get()->filter_layout() == utils::filter_layout::classic);
+    });
+}
+
 SEASTAR_TEST_CASE(test_bloom_filter_reload_after_unlink) {
     return test_env::do_with_async([] (test_env& env) {
 #ifndef SCYLLA_ENABLE_ERROR_INJECTION
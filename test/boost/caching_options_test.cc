@@ -34,3 +34,28 @@ BOOST_AUTO_TEST_CASE(test_caching_options) {
         BOOST_REQUIRE_THROW(caching_options::from_sstring(in_str), std::exception);
     }
 }
+
+BOOST_AUTO_TEST_CASE(test_caching_options_memory_bounds) {
+    using string_map = std::map<sstring, sstring>;
+    {
+        caching_options co = caching_options::from_map({});
+        BOOST_REQUIRE(!co.in_memory());
+        BOOST_REQUIRE(!co.has_memory_bounds());
+        BOOST_REQUIRE_EQUAL(co.memory_reservation(), 0);
+        BOOST_REQUIRE_EQUAL(co.memory_limit(), 0);
+    }
+    {
+        string_map in_map = { {"keys", "ALL"}, {"rows_per_partition", "ALL"}, {"in_memory", "true"},
+                {"memory_reservation_mb", "16"}, {"memory_limit_mb", "64"} };
+        caching_options co = caching_options::from_map(in_map);
+        BOOST_REQUIRE(co.in_memory());
+        BOOST_REQUIRE(co.has_memory_bounds());
+        BOOST_REQUIRE_EQUAL(co.memory_reservation(), 16 << 20);
+        BOOST_REQUIRE_EQUAL(co.memory_limit(), 64 << 20);
+        BOOST_REQUIRE(co.to_map() == in_map);
+        BOOST_REQUIRE(caching_options::from_sstring(co.to_sstring()) == co);
+    }
+    BOOST_REQUIRE_THROW(caching_options::from_map({{"memory_limit_mb", "lots"}}), std::exception);
+    BOOST_REQUIRE_THROW(caching_options::from_map({{"memory_reservation_mb", "64"}, {"memory_limit_mb", "16"}}), std::exception);
+    BOOST_REQUIRE_THROW(caching_options::from_map({{"enabled", "false"}, {"in_memory", "true"}}), std::exception);
+}
@@ -5421,13 +5421,108 @@ SEASTAR_TEST_CASE(test_parallelized_select_sum_group_by) {
             }
         }
     
-        auto msg = e.execute_cql("SELECT k, SUM(v) FROM tbl GROUP BY k;").get();
+        auto msg = e.execute_cql("SELECT k, SUM(v) FROM tbl GROUP BY k LIMIT 10;").get();
         assert_that(msg).is_rows().with_rows({
             {int32_type->decompose(int32_t(1)), int32_type->decompose(int32_t((value_count - 1) * value_count / 2))},
             {int32_type->decompose(int32_t(0)), int32_type->decompose(int32_t((value_count - 1) * value_count / 2))}
         });
 
-        BOOST_CHECK_EQUAL(stat_parallelized, qp.get_cql_stats().select_parallelized);
+        BOOST_CHECK_EQUAL(stat_parallelized + 1, qp.get_cql_stats().select_parallelized);
+
+        msg = e.execute_cql("SELECT k, SUM(v) FROM tbl GROUP BY k;").get();
+        assert_that(msg).is_rows().with_size(2);
+
+        BOOST_CHECK_EQUAL(stat_parallelized + 2, qp.get_cql_stats().select_parallelized);
+
+        // Groups spanning only part of a partition are not parallelized.
+        msg = e.execute_cql("SELECT k, c, SUM(v) FROM tbl GROUP BY k, c;").get();
+        assert_that(msg).is_rows().with_size(2 * value_count);
+
+        BOOST_CHECK_EQUAL(stat_parallelized + 2, qp.get_cql_stats().select_parallelized);
+    });
+}
+
+SEASTAR_TEST_CASE(test_parallelized_select_group_by_composite_partition_key) {
+    return with_parallelized_aggregation_enabled_thread([](cql_test_env& e) {
+        auto& qp = e.local_qp();
+        auto stat_parallelized = qp.get_cql_stats().select_parallelized;
+
+        e.execute_cql("CREATE TABLE tbl (k1 int, k2 text, c int, v int, PRIMARY KEY ((k1, k2), c));").get();
+        int partition_count = 20;
+        for (int k = 0; k < partition_count; k++) {
+            for (int c = 0; c <= k; c++) {
+                e.execute_cql(format("INSERT INTO tbl (k1, k2, c, v) VALUES ({:d}, '{:d}', {:d}, {:d});", k, k, c, c)).get();
+            }
+        }
+
+        std::vector<std::vector<bytes_opt>> expected;
+        for (int k = 0; k < partition_count; k++) {
+            expected.push_back({
+                long_type->decompose(int64_t(k + 1)),
+                utf8_type->decompose(fmt::to_string(k)),
+                int32_type->decompose(int32_t(k)),
+                int32_type->decompose(int32_t(k)),
+            });
+        }
+        // Partition key columns and aggregates are interleaved, and out of
+        // the partition key order.
+        auto msg = e.execute_cql("SELECT COUNT(*), k2, MAX(v), k1 FROM tbl GROUP BY k1, k2 LIMIT 100;").get();
+        assert_that(msg).is_rows().with_rows_ignore_order(expected);
+
+        // The first groups in token order are returned, as by a GROUP BY
+        // which is not parallelized.
+        msg = e.execute_cql("SELECT COUNT(*), k2, MAX(v), k1 FROM tbl GROUP BY k1, k2;").get();
+        auto rows = dynamic_pointer_cast<cql_transport::messages::result_message::rows>(msg)->rs().result_set().rows()
+                | std::views::take(5)
+                | std::views::transform([] (const auto& row) {
+                    return row | std::views::transform([] (const managed_bytes_opt& v) { return to_bytes_opt(v); }) | std::ranges::to<std::vector<bytes_opt>>();
+                })
+                | std::ranges::to<std::vector>();
+        msg = e.execute_cql("SELECT COUNT(*), k2, MAX(v), k1 FROM tbl GROUP BY k1, k2 LIMIT 5;").get();
+        assert_that(msg).is_rows().with_rows(rows);
+
+        msg = e.execute_cql("SELECT k2, COUNT(*) FROM tbl WHERE k1 = -1 AND k2 = '-1' GROUP BY k1, k2;").get();
+        assert_that(msg).is_rows().is_empty();
+
+        BOOST_CHECK_EQUAL(stat_parallelized + 3, qp.get_cql_stats().select_parallelized);
+
+        // Pages hold up to page size groups, and the next page starts after
+        // the last group of the previous one.
+        auto to_rows = [] (::shared_ptr<cql_transport::messages::result_message> msg) {
+            return dynamic_pointer_cast<cql_transport::messages::result_message::rows>(msg)->rs().result_set().rows()
+                    | std::views::transform([] (const auto& row) {
+                        return row | std::views::transform([] (const managed_bytes_opt& v) { return to_bytes_opt(v); }) | std::ranges::to<std::vector<bytes_opt>>();
+                    })
+                    | std::ranges::to<std::vector>();
+        };
+        auto all_rows = to_rows(e.execute_cql("SELECT COUNT(*), k2, MAX(v), k1 FROM tbl GROUP BY k1, k2;").get());
+        BOOST_REQUIRE_EQUAL(all_rows.size(), size_t(partition_count));
+        auto read_pages = [&] (sstring query, int32_t page_size) {
+            std::vector<std::vector<bytes_opt>> rows;
+            lw_shared_ptr<service::pager::paging_state> paging_state;
+            size_t pages = 0;
+            do {
+                auto qo = std::make_unique<cql3::query_options>(db::consistency_level::LOCAL_ONE, std::vector<cql3::raw_value>{},
+                        cql3::query_options::specific_options{page_size, paging_state, {}, api::new_timestamp()});
+                auto msg = e.execute_cql(query, std::move(qo)).get();
+                BOOST_REQUIRE_LE(count_rows_fetched(msg), size_t(page_size));
+                std::ranges::move(to_rows(msg), std::back_inserter(rows));
+                paging_state = extract_paging_state(msg);
+                BOOST_REQUIRE_EQUAL(has_more_pages(msg), bool(paging_state));
+                ++pages;
+            } while (paging_state);
+            return std::make_pair(rows, pages);
+        };
+        stat_parallelized = qp.get_cql_stats().select_parallelized;
+        auto [paged_rows, pages] = read_pages("SELECT COUNT(*), k2, MAX(v), k1 FROM tbl GROUP BY k1, k2;", 3);
+        BOOST_REQUIRE(paged_rows == all_rows);
+        BOOST_REQUIRE_EQUAL(pages, size_t(partition_count + 2) / 3);
+        // A LIMIT spans pages.
+        std::tie(paged_rows, pages) = read_pages("SELECT COUNT(*), k2, MAX(v), k1 FROM tbl GROUP BY k1, k2 LIMIT 7;", 3);
+        BOOST_REQUIRE(paged_rows == std::vector(all_rows.begin(), all_rows.begin() + 7));
+        BOOST_REQUIRE_EQUAL(pages, size_t(3));
+
+        BOOST_CHECK_EQUAL(stat_parallelized + (partition_count + 2) / 3 + 3, qp.get_cql_stats().select_parallelized);
     });
 }
 
@@ -17,6 +17,7 @@
 #include <seastar/testing/test_case.hh>
 #include <seastar/testing/thread_test_case.hh>
 #include <utility>
+#include <fstream>
 #include <fmt/ranges.h>
 #include <fmt/std.h>
 
@@ -43,6 +44,8 @@
 #include "db/commitlog/commitlog.hh"
 #include "test/lib/tmpdir.hh"
 #include "db/data_listeners.hh"
+#include "db/row_cache.hh"
+#include "db/row_cache_warmup.hh"
 #include "multishard_mutation_query.hh"
 #include "mutation_query.hh"
 #include "transport/messages/result_message.hh"
@@ -1857,4 +1860,105 @@ SEASTAR_TEST_CASE(test_max_purgeable_can_purge) {
     return make_ready_future<>();
 }
 
+// Saves the keys of the partitions cached on all shards, evicts the cache and
+// checks that loading the keys populates it again. A truncated file is loaded
+// up to its last complete key, and one in an unrecognized format is ignored.
+SEASTAR_TEST_CASE(test_row_cache_warmup) {
+    tmpdir saved_caches;
+    auto cfg = make_shared<db::config>();
+    cfg->saved_caches_directory(saved_caches.path().string());
+    cfg->row_cache_keys_to_save(1000);
+    cfg->row_cache_warmup_bandwidth_mb_per_sec(0);
+
+    co_await do_with_cql_env_thread([&saved_caches] (cql_test_env& e) {
+        const size_t partitions = 100;
+        e.execute_cql("CREATE TABLE ks.t (pk int PRIMARY KEY, v int)").get();
+        for (size_t pk = 0; pk < partitions; ++pk) {
+            e.execute_cql(format("INSERT INTO ks.t (pk, v) VALUES ({}, {})", pk, pk)).get();
+        }
+        e.db().invoke_on_all([] (replica::database& db) {
+            return db.find_column_family("ks", "t").flush();
+        }).get();
+
+        auto cached_keys_on = [&] (shard_id shard) {
+            return e.db().invoke_on(shard, [] (replica::database& db) {
+                return db.find_column_family("ks", "t").get_row_cache().cached_keys(1000).then([] (auto keys) {
+                    return keys.size();
+                });
+            }).get();
+        };
+        auto cached_keys = [&] {
+            size_t n = 0;
+            for (shard_id shard = 0; shard < smp::count; ++shard) {
+                n += cached_keys_on(shard);
+            }
+            return n;
+        };
+        auto evict_and_load = [&] {
+            e.db().invoke_on_all([] (replica::database& db) -> future<> {
+                db.find_column_family("ks", "t").get_row_cache().evict();
+                abort_source as;
+                co_await db::row_cache_warmup::load(db, as);
+            }).get();
+        };
+
+        e.execute_cql("SELECT * FROM ks.t").get();
+        BOOST_REQUIRE_EQUAL(cached_keys(), partitions);
+        e.db().invoke_on_all([] (replica::database& db) {
+            return db::row_cache_warmup::save(db);
+        }).get();
+
+        evict_and_load();
+        BOOST_REQUIRE_EQUAL(cached_keys(), partitions);
+
+        const auto shard0_keys = cached_keys_on(0);
+        BOOST_REQUIRE_GT(shard0_keys, 0);
+        auto file = saved_caches.path() / "row_cache" / format("{}.0.keys", e.local_db().find_schema("ks", "t")->id());
+        BOOST_REQUIRE(file_exists(file.native()).get());
+
+        std::filesystem::resize_file(file, std::filesystem::file_size(file) - 1);
+        evict_and_load();
+        BOOST_REQUIRE_EQUAL(cached_keys(), partitions - 1);
+
+        {
+            std::fstream f(file, std::ios::in | std::ios::out | std::ios::binary);
+            f.write("XXXX", 4);
+        }
+        evict_and_load();
+        BOOST_REQUIRE_EQUAL(cached_keys(), partitions - shard0_keys);
+
+        db::row_cache_warmup::remove(e.local_db()).get();
+        BOOST_REQUIRE(!file_exists((saved_caches.path() / "row_cache").native()).get());
+    }, cfg);
+}
+
+SEASTAR_TEST_CASE(test_row_cache_memory_reservations_are_capped) {
+    auto cfg = make_shared<db::config>();
+    cfg->in_memory_row_cache_fraction(0.01);
+
+    co_await do_with_cql_env_thread([] (cql_test_env& e) {
+        // Each table asks for more than half of the budget, so they don't both get it.
+        const size_t budget_mb = memory::stats().total_memory() * 0.01 / (1024 * 1024);
+        BOOST_REQUIRE_GE(budget_mb, 4);
+        const size_t requested_mb = budget_mb * 3 / 4;
+        const size_t requested = requested_mb * 1024 * 1024;
+        for (auto name : {"a", "b"}) {
+            e.execute_cql(format("CREATE TABLE ks.{} (pk int PRIMARY KEY, v int) WITH caching = {{'memory_reservation_mb': '{}'}}", name, requested_mb)).get();
+        }
+        auto reservation = [&] (const char* name) {
+            return e.local_db().find_column_family("ks", name).get_row_cache().get_cache_tracker().memory_reservation();
+        };
+        auto a = reservation("a");
+        auto b = reservation("b");
+        BOOST_REQUIRE_EQUAL(std::max(a, b), requested);
+        BOOST_REQUIRE_LT(std::min(a, b), requested);
+
+        // Dropping the table which got its reservation hands the budget over to the other one.
+        auto dropped = a == requested ? "a" : "b";
+        auto kept = a == requested ? "b" : "a";
+        e.execute_cql(format("DROP TABLE ks.{}", dropped)).get();
+        BOOST_REQUIRE_EQUAL(reservation(kept), requested);
+    }, cfg);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
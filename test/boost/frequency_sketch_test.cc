@@ -0,0 +1,72 @@
+/*
+ * Copyright (C) 2026-present ScyllaDB
+ */
+
+/*
+ * SPDX-License-Identifier: LicenseRef-ScyllaDB-Source-Available-1.0
+ */
+
+#define BOOST_TEST_MODULE core
+
+#include <boost/test/unit_test.hpp>
+#include "utils/frequency_sketch.hh"
+
+BOOST_AUTO_TEST_CASE(test_estimate_tracks_increments) {
+    utils::frequency_sketch sketch(1024);
+    BOOST_REQUIRE_EQUAL(sketch.estimate(42), 0);
+    for (unsigned i = 1; i <= 5; ++i) {
+        sketch.increment(42);
+        BOOST_REQUIRE_GE(sketch.estimate(42), i);
+    }
+    // Count-min sketch never underestimates, but may overestimate due to collisions.
+    BOOST_REQUIRE_LE(sketch.estimate(42), 5 + 1);
+}
+
+BOOST_AUTO_TEST_CASE(test_counters_saturate) {
+    utils::frequency_sketch sketch(1024);
+    for (unsigned i = 0; i < 100; ++i) {
+        sketch.increment(7);
+    }
+    BOOST_REQUIRE_EQUAL(sketch.estimate(7), utils::frequency_sketch::max_frequency);
+}
+
+BOOST_AUTO_TEST_CASE(test_aging_halves_counters) {
+    utils::frequency_sketch sketch(1024, 1000000);
+    for (unsigned i = 0; i < 8; ++i) {
+        sketch.increment(13);
+    }
+    auto before = sketch.estimate(13);
+    sketch.reset();
+    BOOST_REQUIRE_EQUAL(sketch.estimate(13), before / 2);
+    BOOST_REQUIRE_EQUAL(sketch.resets(), 1);
+}
+
+BOOST_AUTO_TEST_CASE(test_automatic_aging) {
+    utils::frequency_sketch sketch(1024, 100);
+    for (uint64_t i = 0; i < 100; ++i) {
+        sketch.increment(i * 0x9e3779b97f4a7c15ull);
+    }
+    BOOST_REQUIRE_EQUAL(sketch.resets(), 1);
+}
+
+BOOST_AUTO_TEST_CASE(test_one_hit_wonders_stay_cold) {
+    utils::frequency_sketch sketch(1024 * 1024);
+    // Hot keys are accessed repeatedly, a scan touches many keys once.
+    for (unsigned round = 0; round < 4; ++round) {
+        for (uint64_t k = 0; k < 100; ++k) {
+            sketch.increment(k);
+        }
+    }
+    for (uint64_t k = 1000; k < 11000; ++k) {
+        sketch.increment(k);
+    }
+    unsigned cold_above_one = 0;
+    for (uint64_t k = 1000; k < 11000; ++k) {
+        cold_above_one += sketch.estimate(k) > 1;
+    }
+    for (uint64_t k = 0; k < 100; ++k) {
+        BOOST_REQUIRE_GE(sketch.estimate(k), 4);
+    }
+    // Collisions are possible, but rare with this many counters.
+    BOOST_REQUIRE_LT(cold_above_one, 100);
+}
@@ -857,6 +857,53 @@ SEASTAR_TEST_CASE(test_eviction) {
 
 #ifndef SEASTAR_DEFAULT_ALLOCATOR // Depends on eviction, which is absent with the std allocator
 
+SEASTAR_TEST_CASE(test_scan_does_not_evict_frequently_read_partitions) {
+    return seastar::async([] {
+        auto s = make_schema();
+        tests::reader_concurrency_semaphore_wrapper semaphore;
+        auto mt = make_lw_shared<replica::memtable>(s);
+
+        utils::updateable_value_source<uint32_t> threshold(2);
+        cache_tracker tracker;
+        tracker.set_scan_admission_threshold(utils::updateable_value<uint32_t>(threshold));
+        row_cache cache(s, snapshot_source_from_snapshot(mt->as_data_source()), tracker);
+
+        std::vector<dht::decorated_key> keys;
+        for (int i = 0; i < 100; i++) {
+            auto m = make_new_mutation(s);
+            keys.emplace_back(m.decorated_key());
+            cache.populate(m);
+        }
+
+        const size_t hot_count = 10;
+        for (int round = 0; round < 3; ++round) {
+            for (size_t i = 0; i < hot_count; ++i) {
+                auto pr = dht::partition_range::make_singular(keys[i]);
+                auto rd = cache.make_reader(s, semaphore.make_permit(), pr);
+                auto close_rd = deferred_close(rd);
+                rd.fill_buffer().get();
+            }
+        }
+
+        {
+            auto rd = cache.make_reader(s, semaphore.make_permit());
+            auto close_rd = deferred_close(rd);
+            while (rd().get()) { }
+        }
+
+        BOOST_REQUIRE_EQUAL(tracker.get_stats().scan_admissions, hot_count);
+        BOOST_REQUIRE_EQUAL(tracker.get_stats().scan_admission_rejects, keys.size() - hot_count);
+
+        while (tracker.get_stats().partition_evictions < keys.size() - hot_count) {
+            tracker.region().evict_some();
+        }
+
+        for (size_t i = 0; i < hot_count; ++i) {
+            BOOST_REQUIRE_NO_THROW(cache.lookup(keys[i]));
+        }
+    });
+}
+
 SEASTAR_TEST_CASE(test_eviction_from_invalidated) {
     return seastar::async([] {
         auto s = make_schema();
@@ -908,6 +955,75 @@ SEASTAR_TEST_CASE(test_eviction_from_invalidated) {
 
 #endif
 
+SEASTAR_TEST_CASE(test_cached_keys) {
+    return seastar::async([] {
+        auto s = make_schema();
+        auto mt = make_lw_shared<replica::memtable>(s);
+        cache_tracker tracker;
+        row_cache cache(s, snapshot_source_from_snapshot(mt->as_data_source()), tracker);
+
+        std::vector<dht::decorated_key> keys;
+        for (int i = 0; i < 1000; i++) {
+            auto m = make_new_mutation(s);
+            keys.emplace_back(m.decorated_key());
+            cache.populate(m);
+        }
+        std::ranges::sort(keys, dht::decorated_key::less_comparator(s));
+
+        auto all = cache.cached_keys(keys.size() * 2).get();
+        BOOST_REQUIRE_EQUAL(all.size(), keys.size());
+        for (size_t i = 0; i < keys.size(); ++i) {
+            BOOST_REQUIRE(all[i].equal(*s, keys[i]));
+        }
+
+        BOOST_REQUIRE_EQUAL(cache.cached_keys(10).get().size(), 10);
+        BOOST_REQUIRE(cache.cached_keys(0).get().empty());
+    });
+}
+
+SEASTAR_TEST_CASE(test_compressed_tier) {
+    return seastar::async([] {
+        auto s = make_schema();
+        memtable_snapshot_source underlying(s);
+        cache_tracker tracker;
+        row_cache cache(s, snapshot_source([&] { return underlying(); }), tracker);
+
+        std::vector<mutation> muts;
+        for (int i = 0; i < 10; i++) {
+            auto m = make_new_mutation(s);
+            underlying.apply(m);
+            cache.populate(m);
+            muts.push_back(m);
+        }
+
+        BOOST_REQUIRE_GT(cache.compress_cold_partitions(std::numeric_limits<size_t>::max()), 0);
+        BOOST_REQUIRE_EQUAL(tracker.get_stats().partitions, 0);
+        BOOST_REQUIRE_EQUAL(tracker.compressed_tier().get_stats().partitions, muts.size());
+
+        // Writes invalidate compressed partitions, like they do cache entries.
+        auto m2 = make_new_mutation(s, muts[0].key());
+        auto mt = make_lw_shared<replica::memtable>(s);
+        mt->apply(m2);
+        cache.update(row_cache::external_updater([&] { underlying.apply(m2); }), *mt).get();
+        BOOST_REQUIRE_EQUAL(tracker.compressed_tier().get_stats().partitions, muts.size() - 1);
+        muts[0].apply(m2);
+
+        for (auto&& m : muts) {
+            verify_has(cache, m);
+        }
+        BOOST_REQUIRE_EQUAL(tracker.compressed_tier().get_stats().hits, muts.size() - 1);
+        BOOST_REQUIRE_EQUAL(tracker.compressed_tier().get_stats().partitions, 0);
+        BOOST_REQUIRE_EQUAL(tracker.get_stats().partitions, muts.size());
+
+        // Entries which were read since the sweep last passed them get a second chance.
+        for (auto&& m : muts) {
+            verify_has(cache, m);
+        }
+        BOOST_REQUIRE_EQUAL(cache.compress_cold_partitions(std::numeric_limits<size_t>::max()), 0);
+        BOOST_REQUIRE_EQUAL(tracker.get_stats().partitions, muts.size());
+    });
+}
+
 SEASTAR_TEST_CASE(test_eviction_after_schema_change) {
     return seastar::async([] {
         auto s = make_schema();
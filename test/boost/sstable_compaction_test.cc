@@ -40,6 +40,7 @@
 #include "compaction/time_window_compaction_strategy.hh"
 #include "compaction/leveled_compaction_strategy.hh"
 #include "compaction/incremental_backlog_tracker.hh"
+#include "compaction/unified_compaction_strategy.hh"
 #include "compaction/size_tiered_backlog_tracker.hh"
 #include "test/lib/mutation_assertions.hh"
 #include "counters.hh"
@@ -1077,6 +1078,146 @@ SEASTAR_TEST_CASE(check_overlapping) {
   });
 }
 
+SEASTAR_TEST_CASE(compaction_copies_non_overlapping_sstables_test) {
+    return test_env::do_with_async([] (test_env& env) {
+        simple_schema ss;
+        auto s = ss.schema();
+        auto cf = env.make_table_for_tests(s);
+        auto stop_cf = deferred_stop(cf);
+        auto sst_gen = env.make_sst_factory(s);
+        const auto keys = tests::generate_partition_keys(4, s);
+
+        auto make_mut = [&] (const dht::decorated_key& dk) {
+            mutation m(s, dk);
+            ss.add_row(m, ss.make_ckey(0), "v");
+            return m;
+        };
+
+        // The first two sstables overlap, the third one overlaps neither.
+        auto sst1 = make_sstable_containing(sst_gen, {make_mut(keys[0]), make_mut(keys[1])});
+        auto sst2 = make_sstable_containing(sst_gen, {make_mut(keys[0]), make_mut(keys[1])});
+        auto sst3 = make_sstable_containing(sst_gen, {make_mut(keys[2]), make_mut(keys[3])});
+        for (auto& sst : {sst1, sst2, sst3}) {
+            column_family_test(cf).add_sstable(sst).get();
+        }
+
+        // The output is a run, which the non-overlapping sstable is copied into.
+        auto desc = sstables::compaction_descriptor({sst1, sst2, sst3}, 0, 1024 * 1024 * 1024);
+        auto run = desc.run_identifier;
+        auto new_sstables = compact_sstables(env, std::move(desc), cf, sst_gen).get().new_sstables;
+        BOOST_REQUIRE_EQUAL(new_sstables.size(), 2);
+        auto copied = std::ranges::find_if(new_sstables, [&] (const shared_sstable& sst) {
+            return sst->get_first_decorated_key().equal(*s, keys[2]);
+        });
+        BOOST_REQUIRE(copied != new_sstables.end());
+        BOOST_REQUIRE((*copied)->generation() != sst3->generation());
+        BOOST_REQUIRE_EQUAL((*copied)->data_size(), sst3->data_size());
+        for (auto& sst : new_sstables) {
+            BOOST_REQUIRE_EQUAL(sst->run_identifier(), run);
+        }
+        assert_that(sstable_reader(*copied, s, env.make_reader_permit()))
+            .produces(make_mut(keys[2]))
+            .produces(make_mut(keys[3]))
+            .produces_end_of_stream();
+
+        // Major compactions rewrite all of their input.
+        auto major_input = std::vector<shared_sstable>{
+            make_sstable_containing(sst_gen, {make_mut(keys[0]), make_mut(keys[1])}),
+            make_sstable_containing(sst_gen, {make_mut(keys[2]), make_mut(keys[3])}),
+        };
+        for (auto& sst : major_input) {
+            column_family_test(cf).add_sstable(sst).get();
+        }
+        auto major_desc = sstables::compaction_descriptor(major_input, 0, 1024 * 1024 * 1024);
+        major_desc.is_major = true;
+        new_sstables = compact_sstables(env, std::move(major_desc), cf, sst_gen).get().new_sstables;
+        BOOST_REQUIRE_EQUAL(new_sstables.size(), 1);
+    });
+}
+
+SEASTAR_TEST_CASE(compaction_of_sub_ranges_test) {
+    return test_env::do_with_async([] (test_env& env) {
+        simple_schema ss;
+        auto s = ss.schema();
+        auto cf = env.make_table_for_tests(s);
+        auto stop_cf = deferred_stop(cf);
+        auto sst_gen = env.make_sst_factory(s);
+        const auto keys = tests::generate_partition_keys(64, s);
+
+        utils::chunked_vector<mutation> muts;
+        for (auto& key : keys) {
+            mutation m(s, key);
+            ss.add_row(m, ss.make_ckey(0), "v");
+            muts.push_back(std::move(m));
+        }
+        auto sst1 = make_sstable_containing(sst_gen, muts);
+        auto sst2 = make_sstable_containing(sst_gen, muts);
+        for (auto& sst : {sst1, sst2}) {
+            column_family_test(cf).add_sstable(sst).get();
+        }
+
+        auto desc = sstables::compaction_descriptor({sst1, sst2});
+        desc.sub_range_parallelism = 4;
+        auto run = desc.run_identifier;
+        auto new_sstables = compact_sstables(env, std::move(desc), cf, sst_gen).get().new_sstables;
+        // Every sub-range is written to its own sstables.
+        BOOST_REQUIRE_GT(new_sstables.size(), 1);
+
+        // Together, the outputs make a run holding every partition once.
+        std::ranges::sort(new_sstables, [&] (const shared_sstable& a, const shared_sstable& b) {
+            return a->get_first_decorated_key().less_compare(*s, b->get_first_decorated_key());
+        });
+        auto expected = muts.begin();
+        for (auto& sst : new_sstables) {
+            BOOST_REQUIRE_EQUAL(sst->run_identifier(), run);
+            auto reader = assert_that(sstable_reader(sst, s, env.make_reader_permit()));
+            while (expected != muts.end() && !sst->get_last_decorated_key().less_compare(*s, expected->decorated_key())) {
+                reader.produces(*expected++);
+            }
+            reader.produces_end_of_stream();
+        }
+        BOOST_REQUIRE(expected == muts.end());
+    });
+}
+
+SEASTAR_TEST_CASE(compaction_descriptor_read_amplification_score_test) {
+    return test_env::do_with_async([] (test_env& env) {
+        simple_schema ss;
+        auto s = ss.schema();
+        auto sst_gen = env.make_sst_factory(s);
+        const auto keys = tests::generate_partition_keys(2, s);
+
+        std::vector<shared_sstable> ssts;
+        for (auto& key : keys) {
+            mutation m(s, key);
+            ss.add_row(m, ss.make_ckey(0), "v");
+            ssts.push_back(make_sstable_containing(sst_gen, {std::move(m)}));
+        }
+        BOOST_REQUIRE_EQUAL(sstables::compaction_descriptor(ssts).read_amplification_score(), 0);
+
+        for (int i = 0; i < 3; i++) {
+            ssts[0]->add_read();
+        }
+        ssts[1]->add_read();
+        // Only the reads of the least read sstable are saved by merging.
+        BOOST_REQUIRE_EQUAL(sstables::compaction_descriptor(ssts).read_amplification_score(), 1);
+        BOOST_REQUIRE_EQUAL(sstables::compaction_descriptor({ssts[0]}).read_amplification_score(), 0);
+
+        ssts[1]->get_filter_tracker().add_false_positive();
+        BOOST_REQUIRE_EQUAL(sstables::compaction_descriptor(ssts).read_amplification_score(), 2);
+
+        // Hits are halved every half-life.
+        for (int i = 0; i < 5; i++) {
+            ssts[0]->add_read();
+        }
+        const auto half_life = sstables::sstable::read_amplification_half_life;
+        const auto now = lowres_clock::now();
+        BOOST_REQUIRE_EQUAL(ssts[0]->read_amplification_hits(now), 8);
+        BOOST_REQUIRE_EQUAL(ssts[0]->read_amplification_hits(now + half_life), 4);
+        BOOST_REQUIRE_EQUAL(ssts[0]->read_amplification_hits(now + 2 * half_life), 2);
+    });
+}
+
 SEASTAR_TEST_CASE(tombstone_purge_test) {
     BOOST_REQUIRE(smp::count == 1);
     return test_env::do_with_async([] (test_env& env) {
@@ -4251,6 +4392,46 @@ SEASTAR_TEST_CASE(test_twcs_partition_estimate) {
     });
 }
 
+SEASTAR_TEST_CASE(test_twcs_max_data_segregation_window_count) {
+    return test_env::do_with_async([] (test_env& env) {
+        const auto windows = 200;
+        auto make_schema = [] (sstring window_count) {
+            auto builder = schema_builder("tests", "test_twcs_max_data_segregation_window_count")
+                    .with_column("id", utf8_type, column_kind::partition_key)
+                    .with_column("cl", int32_type, column_kind::clustering_key)
+                    .with_column("value", int32_type);
+            builder.set_compaction_strategy(sstables::compaction_strategy_type::time_window);
+            builder.set_compaction_strategy_options({
+                { time_window_compaction_strategy_options::COMPACTION_WINDOW_UNIT_KEY, "HOURS" },
+                { time_window_compaction_strategy_options::COMPACTION_WINDOW_SIZE_KEY, "1" },
+                { time_window_compaction_strategy_options::MAX_DATA_SEGREGATION_WINDOW_COUNT_KEY, window_count },
+            });
+            return builder.build();
+        };
+
+        BOOST_REQUIRE_THROW(make_compaction_strategy(sstables::compaction_strategy_type::time_window, make_schema("0")->compaction_strategy_options()),
+                exceptions::configuration_exception);
+
+        // Every row is written to a window of its own, as late-arriving data would be.
+        auto segregated_sstables = [&] (sstring window_count) {
+            auto s = make_schema(window_count);
+            auto sst_gen = env.make_sst_factory(s);
+            auto cf = env.make_table_for_tests(s);
+            auto close_cf = deferred_stop(cf);
+
+            mutation m(s, tests::generate_partition_key(s));
+            for (auto ck = 0; ck < windows; ++ck) {
+                auto timestamp = gc_clock::now().time_since_epoch() - std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::hours(ck));
+                m.set_clustered_cell(clustering_key::from_exploded(*s, {int32_type->decompose(ck)}), bytes("value"), data_value(ck), timestamp.count());
+            }
+            auto sst = make_sstable_containing(sst_gen, {std::move(m)});
+            return compact_sstables(env, sstables::compaction_descriptor({sst}), cf, sst_gen, replacer_fn_no_op()).get().new_sstables.size();
+        };
+        BOOST_REQUIRE_EQUAL(segregated_sstables("10"), 10);
+        BOOST_REQUIRE_EQUAL(segregated_sstables(format("{}", windows)), windows);
+    });
+}
+
 static compaction_descriptor get_reshaping_job(sstables::compaction_strategy& cs, const std::vector<shared_sstable>& input,
                                                const schema_ptr& s, reshape_mode mode, uint64_t free_storage_space = std::numeric_limits<uint64_t>::max()) {
     reshape_config cfg {
@@ -5315,6 +5496,162 @@ SEASTAR_TEST_CASE(simple_backlog_controller_test_incremental) {
     return run_controller_test(sstables::compaction_strategy_type::incremental);
 }
 
+SEASTAR_TEST_CASE(simple_backlog_controller_test_unified) {
+    return run_controller_test(sstables::compaction_strategy_type::unified);
+}
+
+SEASTAR_THREAD_TEST_CASE(io_bandwidth_controller_test) {
+    constexpr uint32_t target = 1000;
+    constexpr uint32_t min = 16;
+    constexpr uint32_t max = 1000;
+    auto next = [] (uint32_t bandwidth, std::optional<uint64_t> latency) {
+        return io_bandwidth_controller::next_bandwidth(bandwidth, latency, target, min, max);
+    };
+
+    // Reads slower than the target cut the bandwidth, down to the minimum.
+    BOOST_REQUIRE_EQUAL(next(max, 2000), 750);
+    BOOST_REQUIRE_EQUAL(next(20, 2000), min);
+    // Reads close to the target keep it.
+    BOOST_REQUIRE_EQUAL(next(500, 900), 500);
+    BOOST_REQUIRE_EQUAL(next(500, 1000), 500);
+    // Reads well below the target, or no reads at all, grow it, up to the maximum.
+    BOOST_REQUIRE_EQUAL(next(500, 100), 550);
+    BOOST_REQUIRE_EQUAL(next(500, std::nullopt), 550);
+    BOOST_REQUIRE_EQUAL(next(980, std::nullopt), max);
+
+    // Sustained pressure converges to the minimum, and quiet periods back to the maximum.
+    uint32_t bandwidth = max;
+    for (int i = 0; i < 100; ++i) {
+        bandwidth = next(bandwidth, 5000);
+    }
+    BOOST_REQUIRE_EQUAL(bandwidth, min);
+    for (unsigned i = 0; i < io_bandwidth_controller::increase_steps; ++i) {
+        bandwidth = next(bandwidth, 10);
+    }
+    BOOST_REQUIRE_EQUAL(bandwidth, max);
+}
+
+SEASTAR_THREAD_TEST_CASE(unified_compaction_strategy_options_test) {
+    constexpr uint64_t MB = 1024 * 1024;
+    auto options = sstables::unified_compaction_strategy_options({
+        {"scaling_parameters", "T4, L10"},
+        {"min_sstable_size_in_mb", "100"},
+        {"base_shard_count", "4"},
+        {"target_sstable_size_in_mb", "1000"},
+    });
+
+    BOOST_REQUIRE_EQUAL(options.scaling_parameter(0).threshold(), 4);
+    BOOST_REQUIRE_EQUAL(options.scaling_parameter(1).threshold(), 2);
+    BOOST_REQUIRE_EQUAL(options.scaling_parameter(1).fanout(), 10);
+    // The last parameter applies to all levels above it.
+    BOOST_REQUIRE_EQUAL(options.scaling_parameter(5).fanout(), 10);
+
+    BOOST_REQUIRE_EQUAL(options.level_of(99 * MB), 0);
+    BOOST_REQUIRE_EQUAL(options.level_of(100 * MB), 1);
+    BOOST_REQUIRE_EQUAL(options.level_of(999 * MB), 1);
+    BOOST_REQUIRE_EQUAL(options.level_of(1000 * MB), 2);
+    BOOST_REQUIRE_EQUAL(options.level_of(10000 * MB), 3);
+
+    BOOST_REQUIRE_EQUAL(options.max_sstable_bytes(399 * MB), sstables::compaction_descriptor::default_max_sstable_bytes);
+    BOOST_REQUIRE_EQUAL(options.max_sstable_bytes(400 * MB), 100 * MB);
+    BOOST_REQUIRE_EQUAL(options.max_sstable_bytes(16000 * MB), 1000 * MB);
+
+    for (auto invalid : {"T1", "L", "X4", "N2", "T4,"}) {
+        BOOST_REQUIRE_THROW(sstables::unified_compaction_strategy_options({{"scaling_parameters", invalid}}), exceptions::configuration_exception);
+    }
+}
+
+// Level 0 of these options holds runs below 1MB, and is tiered with a threshold of 4.
+// Level 1 holds runs below 10MB, and is leveled, so compacted as soon as it has 2 runs.
+static const std::map<sstring, sstring> ucs_test_options = {
+    {"scaling_parameters", "T4, L10"},
+    {"min_sstable_size_in_mb", "1"},
+};
+
+static schema_ptr make_ucs_test_schema(const sstring& name) {
+    auto builder = schema_builder("tests", name)
+            .with_column("id", utf8_type, column_kind::partition_key)
+            .with_column("value", int32_type);
+    builder.set_compressor_params(compression_parameters::no_compression());
+    builder.set_compaction_strategy(sstables::compaction_strategy_type::unified);
+    builder.set_compaction_strategy_options(ucs_test_options);
+    return builder.build();
+}
+
+SEASTAR_TEST_CASE(unified_compaction_strategy_get_sstables_for_compaction_test) {
+    return test_env::do_with_async([] (test_env& env) {
+        constexpr uint64_t KB = 1024;
+        constexpr uint64_t MB = 1024 * KB;
+        auto s = make_ucs_test_schema(get_name());
+        auto keys = tests::generate_partition_keys(16, s);
+        auto sst_gen = env.make_sst_factory(s);
+        size_t next_key = 0;
+        auto make_sst = [&] (uint64_t size) {
+            mutation m(s, keys[next_key++]);
+            m.set_clustered_cell(clustering_key::make_empty(), bytes("value"), data_value(int32_t(1)), api::new_timestamp());
+            auto sst = make_sstable_containing(sst_gen, {std::move(m)});
+            sstables::test(sst).set_data_file_size(size);
+            return sst;
+        };
+        auto get_job = [&] (std::vector<shared_sstable> ssts) {
+            auto cf = env.make_table_for_tests(s);
+            auto close_cf = deferred_stop(cf);
+            for (auto& sst : ssts) {
+                column_family_test(cf).add_sstable(sst).get();
+            }
+            auto cs = cf->get_compaction_strategy();
+            auto desc = get_sstables_for_compaction(cs, cf.as_compaction_group_view(), {}).get();
+            return desc.sstables | std::ranges::to<std::unordered_set>();
+        };
+
+        std::vector<shared_sstable> level0 = {make_sst(100 * KB), make_sst(200 * KB), make_sst(300 * KB)};
+        std::vector<shared_sstable> level1 = {make_sst(2 * MB), make_sst(3 * MB)};
+
+        // Level 0 is below its threshold, the leveled level 1 is at it.
+        auto all = level0;
+        std::ranges::copy(level1, std::back_inserter(all));
+        BOOST_REQUIRE(get_job(all) == level1 | std::ranges::to<std::unordered_set>());
+
+        // Both levels are at their threshold, the lower one is preferred.
+        level0.push_back(make_sst(400 * KB));
+        all.push_back(level0.back());
+        BOOST_REQUIRE(get_job(all) == level0 | std::ranges::to<std::unordered_set>());
+
+        // The table of the test enforces min_threshold, so levels below their threshold are left alone.
+        BOOST_REQUIRE(get_job({level0[0], level0[1], level1[0]}).empty());
+    });
+}
+
+SEASTAR_TEST_CASE(unified_compaction_strategy_reshape_test) {
+    return test_env::do_with_async([] (test_env& env) {
+        auto s = make_ucs_test_schema(get_name());
+        const auto keys = tests::generate_partition_keys(64, s);
+        auto cs = sstables::make_compaction_strategy(sstables::compaction_strategy_type::unified, s->compaction_strategy_options());
+        auto make_sstables = [&] (size_t count, bool overlapping) {
+            std::vector<shared_sstable> sstables;
+            for (size_t i = 0; i < count; i++) {
+                auto sst = env.make_sstable(s);
+                auto& key = overlapping ? keys[0] : keys[i];
+                sstables::test(sst).set_values(key.key(), key.key(), stats_metadata{}, 1024);
+                sstables.push_back(std::move(sst));
+            }
+            return sstables;
+        };
+
+        // Below the off-strategy threshold of 4 runs, there is nothing to reshape.
+        BOOST_REQUIRE(get_reshaping_job(cs, make_sstables(3, false), s, reshape_mode::strict).sstables.empty());
+        // Disjoint sstables are reshaped at once.
+        BOOST_REQUIRE_EQUAL(get_reshaping_job(cs, make_sstables(64, false), s, reshape_mode::strict).sstables.size(), 64);
+        // Overlapping ones are reshaped max_threshold at a time.
+        BOOST_REQUIRE_EQUAL(get_reshaping_job(cs, make_sstables(64, true), s, reshape_mode::strict).sstables.size(),
+                uint64_t(s->max_compaction_threshold()));
+        // Relaxed mode only reshapes levels with more than max_threshold runs.
+        BOOST_REQUIRE(get_reshaping_job(cs, make_sstables(4, true), s, reshape_mode::relaxed).sstables.empty());
+        BOOST_REQUIRE_EQUAL(get_reshaping_job(cs, make_sstables(64, true), s, reshape_mode::relaxed).sstables.size(),
+                uint64_t(s->max_compaction_threshold()));
+    });
+}
+
 SEASTAR_TEST_CASE(test_compaction_strategy_cleanup_method) {
     return test_env::do_with_async([] (test_env& env) {
         constexpr size_t all_files = 64;
@@ -5404,6 +5741,9 @@ SEASTAR_TEST_CASE(test_compaction_strategy_cleanup_method) {
 
         // ICS: Check that 2 jobs are returned for a size tier containing 2x more files (single-fragment runs) than max threshold.
         run_cleanup_strategy_test(sstables::compaction_strategy_type::incremental, 32);
+
+        // UCS: Check that 2 jobs are returned for a level containing 2x more runs than max threshold.
+        run_cleanup_strategy_test(sstables::compaction_strategy_type::unified, 32);
     });
 }
 
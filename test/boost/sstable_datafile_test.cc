@@ -17,10 +17,14 @@
 
 #include "sstables/sstables.hh"
 #include "sstables/compress.hh"
+#include "sstables/column_zone_maps.hh"
+#include "sstables/attached_index.hh"
 #include "sstables/metadata_collector.hh"
 #include <seastar/testing/thread_test_case.hh>
 #include "schema/schema.hh"
 #include "schema/schema_builder.hh"
+#include "index/secondary_index.hh"
+#include "cql3/statements/index_target.hh"
 #include "replica/database.hh"
 #include "sstables/sstable_writer.hh"
 #include <memory>
@@ -46,6 +50,7 @@
 #include <boost/range/algorithm.hpp>
 #include <boost/icl/interval_map.hpp>
 #include "test/lib/sstable_utils.hh"
+#include "test/lib/key_utils.hh"
 #include "test/lib/random_utils.hh"
 #include "test/lib/test_utils.hh"
 #include "test/lib/cql_test_env.hh"
@@ -1074,6 +1079,276 @@ SEASTAR_TEST_CASE(min_max_clustering_key_test) {
     });
 }
 
+SEASTAR_TEST_CASE(clustering_filter_test) {
+    return test_env::do_with_async([] (test_env& env) {
+        auto s = schema_builder("ks", "cf")
+            .with_column("pk", int32_type, column_kind::partition_key)
+            .with_column("ck", long_type, column_kind::clustering_key)
+            .with_column("v", int32_type)
+            .set_clustering_filter_bucket_width(100)
+            .build();
+        auto v_col = s->get_column_definition("v");
+        auto make_pk = [&] (int32_t v) { return partition_key::from_single_value(*s, int32_type->decompose(v)); };
+        auto make_ck = [&] (int64_t v) { return clustering_key::from_single_value(*s, long_type->decompose(v)); };
+        auto make_ranges = [&] (std::optional<int64_t> start, std::optional<int64_t> end) {
+            return query::clustering_row_ranges{query::clustering_range(
+                    start ? std::make_optional(query::clustering_range::bound(make_ck(*start))) : std::nullopt,
+                    end ? std::make_optional(query::clustering_range::bound(make_ck(*end))) : std::nullopt)};
+        };
+
+        // Rows in buckets 10 and 50.
+        mutation m1(s, make_pk(1));
+        for (int64_t ck : {1000, 1050, 1099, 5000, 5090}) {
+            m1.set_clustered_cell(make_ck(ck), *v_col, make_atomic_cell(int32_type, int32_type->decompose(1)));
+        }
+        auto sst = make_sstable_containing(env.make_sstable(s), {std::move(m1)});
+        auto check = [&] (sstables::shared_sstable sst) {
+            BOOST_REQUIRE(sst->has_clustering_filter());
+            auto pk1 = sstables::sstable::make_hashed_key(*s, make_pk(1));
+            BOOST_REQUIRE(sst->clustering_filter_may_contain(pk1, make_ranges(1050, 1060)));
+            BOOST_REQUIRE(sst->clustering_filter_may_contain(pk1, make_ranges(900, 1000)));
+            BOOST_REQUIRE(sst->clustering_filter_may_contain(pk1, make_ranges(5050, std::nullopt)));
+            BOOST_REQUIRE(sst->clustering_filter_may_contain(pk1, query::clustering_row_ranges{query::clustering_range::make_open_ended_both_sides()}));
+            BOOST_REQUIRE(!sst->clustering_filter_may_contain(pk1, make_ranges(2000, 2099)));
+            // Bounded by the sstable's min/max clustering keys.
+            BOOST_REQUIRE(!sst->clustering_filter_may_contain(pk1, make_ranges(5100, std::nullopt)));
+            BOOST_REQUIRE(!sst->clustering_filter_may_contain(pk1, make_ranges(std::nullopt, 999)));
+        };
+        check(sst);
+        check(env.reusable_sst(sst).get());
+
+        // A partition tombstone covers all rows of its partition.
+        mutation m2(s, make_pk(2));
+        m2.partition().apply(tombstone(api::new_timestamp(), gc_clock::now()));
+        m2.set_clustered_cell(make_ck(3000), *v_col, make_atomic_cell(int32_type, int32_type->decompose(1)));
+        auto sst2 = make_sstable_containing(env.make_sstable(s), {std::move(m2)});
+        auto pk2 = sstables::sstable::make_hashed_key(*s, make_pk(2));
+        BOOST_REQUIRE(sst2->clustering_filter_may_contain(pk2, make_ranges(2000, 2099)));
+
+        // Tables without the option have no clustering filter.
+        auto s2 = schema_builder("ks", "cf2")
+            .with_column("pk", int32_type, column_kind::partition_key)
+            .with_column("ck", long_type, column_kind::clustering_key)
+            .with_column("v", int32_type)
+            .build();
+        mutation m3(s2, partition_key::from_single_value(*s2, int32_type->decompose(1)));
+        m3.set_clustered_cell(clustering_key::from_single_value(*s2, long_type->decompose(int64_t(1))), *s2->get_column_definition("v"),
+                make_atomic_cell(int32_type, int32_type->decompose(1)));
+        BOOST_REQUIRE(!make_sstable_containing(env.make_sstable(s2), {std::move(m3)})->has_clustering_filter());
+    });
+}
+
+SEASTAR_TEST_CASE(clustering_filter_reversed_read_test) {
+    return test_env::do_with_async([] (test_env& env) {
+        auto s = schema_builder("ks", "cf")
+            .with_column("pk", int32_type, column_kind::partition_key)
+            .with_column("ck", long_type, column_kind::clustering_key)
+            .with_column("v", int32_type)
+            .set_clustering_filter_bucket_width(100)
+            .build();
+        auto v_col = s->get_column_definition("v");
+        auto make_ck = [&] (int64_t v) { return clustering_key::from_single_value(*s, long_type->decompose(v)); };
+
+        // Rows in buckets 10 and 50.
+        mutation m(s, partition_key::from_single_value(*s, int32_type->decompose(1)));
+        for (int64_t ck : {1000, 1050, 1099, 5000, 5090}) {
+            m.set_clustered_cell(make_ck(ck), *v_col, make_atomic_cell(int32_type, int32_type->decompose(1)));
+        }
+        auto pr = dht::partition_range::make_singular(m.decorated_key());
+        auto sst = make_sstable_containing(env.make_sstable(s), {std::move(m)});
+
+        // Size-tiered doesn't use the min/max clustering metadata, so only the clustering filter can skip the sstable.
+        auto cs = sstables::make_compaction_strategy(sstables::compaction_strategy_type::size_tiered, s->compaction_strategy_options());
+        sstable_set set = env.make_sstable_set(cs, s);
+        set.insert(sst);
+        auto t = env.make_table_for_tests(s);
+        auto close_t = deferred_stop(t);
+
+        auto read_reversed = [&] (int64_t start, int64_t end) -> size_t {
+            auto slice = query::reverse_slice(*s, partition_slice_builder(*s)
+                    .with_range(query::clustering_range::make({make_ck(start)}, {make_ck(end)}))
+                    .build());
+            utils::estimated_histogram eh;
+            auto reader = set.create_single_key_sstable_reader(&*t, s->make_reversed(), env.make_reader_permit(), eh, pr, slice,
+                    tracing::trace_state_ptr(), ::streamed_mutation::forwarding::no, ::mutation_reader::forwarding::no);
+            auto close_reader = deferred_close(reader);
+            auto mut = read_mutation_from_mutation_reader(reader).get();
+            return mut ? mut->partition().clustered_rows().calculate_size() : 0;
+        };
+        BOOST_REQUIRE_EQUAL(read_reversed(1000, 1060), 2);
+        BOOST_REQUIRE_EQUAL(read_reversed(1099, 5050), 2);
+        BOOST_REQUIRE_EQUAL(t->cf_stats()->sstables_skipped_by_clustering_prefix_filter, 0);
+        BOOST_REQUIRE_EQUAL(read_reversed(2000, 2099), 0);
+        BOOST_REQUIRE_EQUAL(t->cf_stats()->sstables_skipped_by_clustering_prefix_filter, 1);
+    });
+}
+
+SEASTAR_TEST_CASE(column_zone_maps_test) {
+    return test_env::do_with_async([] (test_env& env) {
+        auto s = schema_builder("ks", "cf")
+            .with_column("pk", int32_type, column_kind::partition_key)
+            .with_column("ck", long_type, column_kind::clustering_key)
+            .with_column("v", int32_type)
+            .with_column("t", utf8_type)
+            .with_column("l", list_type_impl::get_instance(int32_type, true))
+            .set_column_zone_maps(true)
+            .build();
+        auto v_col = s->get_column_definition("v");
+        auto t_col = s->get_column_definition("t");
+        auto pk = partition_key::from_single_value(*s, int32_type->decompose(1));
+        auto make_ck = [&] (int64_t v) { return clustering_key::from_single_value(*s, long_type->decompose(v)); };
+        auto make_sst = [&] (int64_t first_ck, int64_t last_ck, auto v_of) {
+            mutation m(s, pk);
+            for (auto ck = first_ck; ck <= last_ck; ++ck) {
+                m.set_clustered_cell(make_ck(ck), *v_col, make_atomic_cell(int32_type, int32_type->decompose(v_of(ck))));
+                if (ck % 2) {
+                    m.set_clustered_cell(make_ck(ck), *t_col, make_atomic_cell(utf8_type, utf8_type->decompose(sstring("x"))));
+                }
+            }
+            return make_sstable_containing(env.make_sstable(s), {std::move(m)});
+        };
+        auto make_range = [&] (int32_t start, int32_t end) {
+            return query::column_value_range{
+                .id = v_col->id,
+                .range = interval<bytes>::make({int32_type->decompose(start)}, {int32_type->decompose(end)}),
+            };
+        };
+
+        auto sst1 = make_sst(0, 9, [] (int64_t ck) { return int32_t(ck + 10); });
+        auto sst2 = make_sst(100, 109, [] (int64_t ck) { return int32_t(ck); });
+        // Overlaps sst1.
+        auto sst3 = make_sst(5, 15, [] (int64_t) { return int32_t(50); });
+
+        auto check = [&] (sstables::shared_sstable sst) {
+            auto* zone_maps = sst->get_column_zone_maps();
+            BOOST_REQUIRE(zone_maps);
+            // Collections have no zone maps.
+            BOOST_REQUIRE_EQUAL(zone_maps->elements.size(), 2);
+            for (const auto& zm : zone_maps->elements) {
+                if (zm.column_name.value == v_col->name()) {
+                    BOOST_REQUIRE(zm.min.value == int32_type->decompose(10));
+                    BOOST_REQUIRE(zm.max.value == int32_type->decompose(19));
+                    BOOST_REQUIRE_EQUAL(zm.value_count, 10);
+                    BOOST_REQUIRE_EQUAL(zm.null_count, 0);
+                } else {
+                    BOOST_REQUIRE(zm.column_name.value == t_col->name());
+                    BOOST_REQUIRE_EQUAL(zm.value_count, 5);
+                    BOOST_REQUIRE_EQUAL(zm.null_count, 5);
+                }
+            }
+            BOOST_REQUIRE(sstables::column_zone_maps_may_contain(*zone_maps, *s, make_range(15, 30)));
+            BOOST_REQUIRE(sstables::column_zone_maps_may_contain(*zone_maps, *s, make_range(0, 10)));
+            BOOST_REQUIRE(!sstables::column_zone_maps_may_contain(*zone_maps, *s, make_range(20, 30)));
+            BOOST_REQUIRE(!sstables::column_zone_maps_may_contain(*zone_maps, *s, make_range(0, 9)));
+        };
+        check(sst1);
+        check(env.reusable_sst(sst1).get());
+
+        auto excluded = [&] (query::column_value_ranges ranges) {
+            return sstables::sstables_excluded_by_column_zone_maps({sst1, sst2, sst3}, *s, ranges);
+        };
+        // sst1 and sst3 have no matching values and only overlap each other.
+        BOOST_REQUIRE(excluded({make_range(100, 200)}) == std::unordered_set<const sstables::sstable*>({sst1.get(), sst3.get()}));
+        // sst1 has no matching values, but rows of sst3, which has, could be merged with its rows.
+        BOOST_REQUIRE(excluded({make_range(50, 50)}) == std::unordered_set<const sstables::sstable*>({sst2.get()}));
+        BOOST_REQUIRE(excluded({make_range(10, 200)}).empty());
+        // Restrictions of several columns are ANDed.
+        auto t_range = query::column_value_range{.id = t_col->id, .range = interval<bytes>::make_singular(utf8_type->decompose(sstring("y")))};
+        BOOST_REQUIRE_EQUAL(excluded({make_range(10, 200), t_range}).size(), 3);
+
+        // Tables without the option have no zone maps.
+        auto s2 = schema_builder("ks", "cf2")
+            .with_column("pk", int32_type, column_kind::partition_key)
+            .with_column("v", int32_type)
+            .build();
+        mutation m(s2, partition_key::from_single_value(*s2, int32_type->decompose(1)));
+        m.set_clustered_cell(clustering_key::make_empty(), *s2->get_column_definition("v"), make_atomic_cell(int32_type, int32_type->decompose(1)));
+        BOOST_REQUIRE(!make_sstable_containing(env.make_sstable(s2), {std::move(m)})->get_column_zone_maps());
+    });
+}
+
+SEASTAR_TEST_CASE(attached_index_test) {
+    return test_env::do_with_async([] (test_env& env) {
+        auto s = schema_builder("ks", "cf")
+            .with_column("pk", int32_type, column_kind::partition_key)
+            .with_column("ck", int32_type, column_kind::clustering_key)
+            .with_column("v", utf8_type)
+            .with_index(index_metadata("cf_v_idx", {
+                    {cql3::statements::index_target::target_option_name, "v"},
+                    {db::index::secondary_index::custom_class_option_name, "sstable_index"},
+                }, index_metadata_kind::custom, index_metadata::is_local_index::no))
+            .build();
+        auto v_col = s->get_column_definition("v");
+        auto cmp = [] (const bytes& a, const bytes& b) { return utf8_type->compare(a, b); };
+
+        // Large values, so that the entries are written in several segments,
+        // each split into several blocks. Values repeat across partitions, so
+        // that some of them span blocks.
+        const auto padding = sstring(1000, 'x');
+        struct entry {
+            int64_t token;
+            bytes value;
+        };
+        std::vector<entry> entries;
+        utils::chunked_vector<mutation> muts;
+        for (const auto& dk : tests::generate_partition_keys(1000, s)) {
+            mutation m(s, dk);
+            for (int32_t ck = 0; ck < 3; ++ck) {
+                auto value = utf8_type->decompose(fmt::format("{:04}{}", (muts.size() * 3 + ck) % 250, padding));
+                m.set_clustered_cell(clustering_key::from_single_value(*s, int32_type->decompose(ck)), *v_col, make_atomic_cell(utf8_type, value));
+                entries.push_back(entry{dht::token::to_int64(dk.token()), std::move(value)});
+            }
+            muts.push_back(std::move(m));
+        }
+        auto sst = make_sstable_containing(env.make_sstable(s), std::move(muts));
+        BOOST_REQUIRE(sst->has_component(component_type::AttachedIndex));
+
+        auto index = sstables::test(sst).read_attached_index().get();
+        auto* column = index->find_column(*v_col);
+        BOOST_REQUIRE(column);
+        const auto& segments = column->segments.elements;
+        BOOST_REQUIRE_GT(segments.size(), 1);
+        BOOST_REQUIRE_GT(segments.front().blocks.elements.size(), 1);
+
+        const auto mid_token = dht::token::from_int64(entries[entries.size() / 2].token);
+        const std::vector<dht::token_range> token_ranges = {
+            dht::token_range::make_open_ended_both_sides(),
+            dht::token_range::make_starting_with({mid_token, true}),
+        };
+        auto check = [&] (const interval<bytes>& values, const dht::token_range& range) {
+            std::set<int64_t> expected;
+            for (const auto& e : entries) {
+                if (values.contains(e.value, cmp) && range.contains(dht::token::from_int64(e.token), dht::token_comparator())) {
+                    expected.insert(e.token);
+                }
+            }
+            auto tokens = sst->find_in_attached_index(*v_col, values, range).get();
+            BOOST_REQUIRE(tokens);
+            auto found = *tokens | std::views::transform(&dht::token::to_int64) | std::ranges::to<std::set>();
+            BOOST_REQUIRE(found == expected);
+        };
+
+        // Range bounds on the first values of the blocks, which may also end
+        // the blocks before them.
+        for (const auto& segment : segments) {
+            const auto& blocks = segment.blocks.elements;
+            for (size_t i = 0; i < blocks.size(); ++i) {
+                const auto& first = blocks[i].first_value.value;
+                for (const auto& range : token_ranges) {
+                    check(interval<bytes>::make_singular(first), range);
+                    if (i + 1 < blocks.size()) {
+                        const auto& next = blocks[i + 1].first_value.value;
+                        check(interval<bytes>::make({first, true}, {next, false}), range);
+                        check(interval<bytes>::make({first, false}, {next, true}), range);
+                    }
+                }
+                check(interval<bytes>::make_starting_with({first, false}), token_ranges.front());
+                check(interval<bytes>::make_ending_with({first, false}), token_ranges.front());
+            }
+        }
+    });
+}
+
 SEASTAR_TEST_CASE(sstable_tombstone_metadata_check) {
     return test_env::do_with_async([] (test_env& env) {
         for (const auto version : writable_sstable_versions) {
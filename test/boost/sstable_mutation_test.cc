@@ -1468,6 +1468,68 @@ SEASTAR_TEST_CASE(test_static_compact_tables_are_read) {
     });
 }
 
+// Data queries bypassing the cache don't need the values of columns which
+// aren't in the slice. The cells of those columns are still read, to keep the
+// liveness of rows, but with empty values.
+SEASTAR_TEST_CASE(test_bypass_cache_reads_skip_unselected_column_values) {
+    return test_env::do_with_async([] (test_env& env) {
+        for (const auto version : writable_sstable_versions) {
+            auto s = schema_builder("ks", "test")
+                .with_column("pk", int32_type, column_kind::partition_key)
+                .with_column("ck", int32_type, column_kind::clustering_key)
+                .with_column("s1", utf8_type, column_kind::static_column)
+                .with_column("v1", int32_type)
+                .with_column("v2", utf8_type)
+                .build();
+            auto& s1 = *s->get_column_definition("s1");
+            auto& v1 = *s->get_column_definition("v1");
+            auto& v2 = *s->get_column_definition("v2");
+
+            const api::timestamp_type ts = 1;
+            const auto expiry = gc_clock::now() + std::chrono::hours(1);
+            const auto ttl = gc_clock::duration(std::chrono::hours(1));
+            const auto deletion_time = gc_clock::now();
+            auto ck = [&] (int i) {
+                return clustering_key::from_exploded(*s, {int32_type->decompose(i)});
+            };
+            auto dk = dht::decorate_key(*s, partition_key::from_exploded(*s, {int32_type->decompose(0)}));
+
+            auto make_mutation = [&] (bool with_values) {
+                auto value = [&] (sstring v) {
+                    return with_values ? utf8_type->decompose(v) : bytes();
+                };
+                mutation m(s, dk);
+                m.set_static_cell(s1, atomic_cell::make_live(*utf8_type, ts, value(make_random_string(1024))));
+                m.set_clustered_cell(ck(0), v1, atomic_cell::make_live(*int32_type, ts, int32_type->decompose(0)));
+                m.set_clustered_cell(ck(0), v2, atomic_cell::make_live(*utf8_type, ts, value(make_random_string(1024))));
+                // The row is only alive because of the expiring cell of v2.
+                m.set_clustered_cell(ck(1), v2, atomic_cell::make_live(*utf8_type, ts, value("v2"), expiry, ttl));
+                m.set_clustered_cell(ck(2), v1, atomic_cell::make_live(*int32_type, ts, int32_type->decompose(2)));
+                m.set_clustered_cell(ck(2), v2, atomic_cell::make_dead(ts, deletion_time));
+                return m;
+            };
+            auto m = make_mutation(true);
+            auto ms = make_sstable_mutation_source(env, s, {m}, version);
+
+            auto slice = partition_slice_builder(*s)
+                .with_regular_column("v1")
+                .with_no_static_columns()
+                .with_option<query::partition_slice::option::bypass_cache>()
+                .with_option<query::partition_slice::option::skip_unselected_column_values>()
+                .build();
+            assert_that(ms.make_mutation_reader(s, env.make_reader_permit(), dht::partition_range::make_singular(dk), slice))
+                .produces(make_mutation(false))
+                .produces_end_of_stream();
+
+            // Other reads, e.g. mutation queries, get all values.
+            slice.options.remove<query::partition_slice::option::skip_unselected_column_values>();
+            assert_that(ms.make_mutation_reader(s, env.make_reader_permit(), dht::partition_range::make_singular(dk), slice))
+                .produces(m)
+                .produces_end_of_stream();
+        }
+    });
+}
+
 SEASTAR_TEST_CASE(writer_handles_subsequent_range_tombstone_changes_without_tombstones) {
     // This test exposes a problem of a peculiar setup of tombstones that trigger
     // a mutation fragment stream validation exception if stream is compacted.
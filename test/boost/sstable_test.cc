@@ -26,6 +26,7 @@
 #include "test/lib/test_utils.hh"
 #include "schema/schema.hh"
 #include "sstables/compressor.hh"
+#include "sstables/chunk_cache.hh"
 #include "replica/database.hh"
 #include "test/boost/sstable_test.hh"
 #include "test/lib/tmpdir.hh"
@@ -721,6 +722,176 @@ SEASTAR_TEST_CASE(test_skipping_in_compressed_stream) {
     });
 }
 
+SEASTAR_TEST_CASE(test_chunk_cache_in_compressed_stream) {
+    return seastar::async([] {
+        tests::reader_concurrency_semaphore_wrapper semaphore;
+
+        tmpdir tmp;
+        auto file_path = (tmp.path() / "test").string();
+        file f = open_file_dma(file_path, open_flags::create | open_flags::wo).get();
+
+        file_input_stream_options opts;
+        opts.read_ahead = 0;
+
+        compression_parameters cp({
+            { compression_parameters::SSTABLE_COMPRESSION, "LZ4Compressor" },
+            { compression_parameters::CHUNK_LENGTH_KB, std::to_string(opts.buffer_size/1024) },
+        });
+
+        sstables::compression c;
+        auto os = make_file_output_stream(f, file_output_stream_options()).get();
+        auto out = make_compressed_file_m_format_output_stream(std::move(os), &c, cp, make_lz4_sstable_compressor_for_tests());
+
+        std::vector<temporary_buffer<char>> chunks;
+        size_t uncompressed_size = 0;
+        for (auto name : {"buf1", "buf2", "buf3"}) {
+            temporary_buffer<char> buf(c.uncompressed_chunk_length());
+            std::fill_n(buf.get_write(), buf.size(), 0);
+            strcpy(buf.get_write(), name);
+            out.write(buf.get(), buf.size()).get();
+            uncompressed_size += buf.size();
+            chunks.push_back(std::move(buf));
+        }
+        out.close().get();
+
+        auto compressed_size = seastar::file_size(file_path).get();
+        c.update(compressed_size);
+
+        lru l;
+        logalloc::region region;
+        chunk_cache_stats stats;
+        sstables::chunk_cache cache(stats, l, region);
+
+        auto make_is = [&] (uint64_t pos) {
+            f = open_file_dma(file_path, open_flags::ro).get();
+            auto stream_creator = [f](uint64_t pos, uint64_t len, file_input_stream_options options)->future<input_stream<char>> {
+                co_return input_stream<char>(make_file_data_source(std::move(f), pos, len, std::move(options)));
+            };
+            return make_compressed_file_m_format_input_stream(stream_creator, &c, pos, uncompressed_size - pos, opts, semaphore.make_permit(), std::nullopt, &cache);
+        };
+
+        auto expect = [] (input_stream<char>& in, const temporary_buffer<char>& buf) {
+            auto b = in.read_exactly(buf.size()).get();
+            BOOST_REQUIRE(b == buf);
+        };
+
+        auto in = make_is(0);
+        expect(in, chunks[0]);
+        expect(in, chunks[1]);
+        in.close().get();
+        BOOST_REQUIRE_EQUAL(stats.misses, 2);
+        BOOST_REQUIRE_EQUAL(stats.populations, 2);
+        BOOST_REQUIRE_EQUAL(stats.hits, 0);
+        BOOST_REQUIRE_EQUAL(cache.cached_bytes(), 2 * c.uncompressed_chunk_length());
+
+        // Cached chunks are served from memory, the rest is read from the file.
+        in = make_is(0);
+        expect(in, chunks[0]);
+        in.skip(chunks[1].size()).get();
+        expect(in, chunks[2]);
+        in.close().get();
+        BOOST_REQUIRE_EQUAL(stats.hits, 1);
+        BOOST_REQUIRE_EQUAL(stats.misses, 3);
+        BOOST_REQUIRE_EQUAL(stats.populations, 3);
+
+        // Reads starting in the middle of a chunk.
+        in = make_is(chunks[0].size() + 2);
+        auto b = in.read_exactly(chunks[1].size() - 2).get();
+        BOOST_REQUIRE(std::equal(b.begin(), b.end(), chunks[1].begin() + 2));
+        expect(in, chunks[2]);
+        in.close().get();
+        BOOST_REQUIRE_EQUAL(stats.hits, 3);
+        BOOST_REQUIRE_EQUAL(stats.misses, 3);
+
+        cache.evict_gently().get();
+        BOOST_REQUIRE_EQUAL(cache.cached_bytes(), 0);
+        BOOST_REQUIRE_EQUAL(stats.evictions, 3);
+        BOOST_REQUIRE_EQUAL(stats.cached_bytes, 0);
+    });
+}
+
+SEASTAR_TEST_CASE(test_compressed_stream_readahead) {
+    return seastar::async([] {
+        tests::reader_concurrency_semaphore_wrapper semaphore;
+
+        tmpdir tmp;
+        auto file_path = (tmp.path() / "test").string();
+        file f = open_file_dma(file_path, open_flags::create | open_flags::wo).get();
+
+        // Prefetches up to 8 chunks.
+        file_input_stream_options opts;
+        opts.buffer_size = 16 * 1024;
+        opts.read_ahead = 2;
+
+        compression_parameters cp({
+            { compression_parameters::SSTABLE_COMPRESSION, "LZ4Compressor" },
+            { compression_parameters::CHUNK_LENGTH_KB, "4" },
+        });
+
+        sstables::compression c;
+        auto os = make_file_output_stream(f, file_output_stream_options()).get();
+        auto out = make_compressed_file_m_format_output_stream(std::move(os), &c, cp, make_lz4_sstable_compressor_for_tests());
+
+        std::vector<temporary_buffer<char>> chunks;
+        size_t uncompressed_size = 0;
+        for (int i = 0; i < 32; ++i) {
+            temporary_buffer<char> buf(c.uncompressed_chunk_length());
+            std::fill_n(buf.get_write(), buf.size(), char('a' + i % 26));
+            out.write(buf.get(), buf.size()).get();
+            uncompressed_size += buf.size();
+            chunks.push_back(std::move(buf));
+        }
+        out.close().get();
+
+        auto compressed_size = seastar::file_size(file_path).get();
+        c.update(compressed_size);
+
+        auto make_is = [&] (uint64_t pos) {
+            f = open_file_dma(file_path, open_flags::ro).get();
+            auto stream_creator = [f](uint64_t pos, uint64_t len, file_input_stream_options options)->future<input_stream<char>> {
+                co_return input_stream<char>(make_file_data_source(std::move(f), pos, len, std::move(options)));
+            };
+            return make_compressed_file_m_format_input_stream(stream_creator, &c, pos, uncompressed_size - pos, opts, semaphore.make_permit(), std::nullopt);
+        };
+
+        auto expect = [] (input_stream<char>& in, const temporary_buffer<char>& buf) {
+            auto b = in.read_exactly(buf.size()).get();
+            BOOST_REQUIRE(b == buf);
+        };
+
+        auto in = make_is(0);
+        for (auto& chunk : chunks) {
+            expect(in, chunk);
+        }
+        BOOST_REQUIRE(in.read().get().empty());
+        in.close().get();
+
+        // Skips within and past the prefetched chunks.
+        in = make_is(0);
+        for (size_t i = 0; i < chunks.size(); i += 4) {
+            expect(in, chunks[i]);
+            expect(in, chunks[i + 1]);
+            in.skip(chunks[i + 2].size() * (i % 8 ? 2 : 1)).get();
+            if (i % 8 == 0) {
+                expect(in, chunks[i + 3]);
+            }
+        }
+        in.close().get();
+
+        // Reads starting in the middle of a chunk.
+        in = make_is(chunks[0].size() + 2);
+        auto b = in.read_exactly(chunks[1].size() - 2).get();
+        BOOST_REQUIRE(std::equal(b.begin(), b.end(), chunks[1].begin() + 2));
+        expect(in, chunks[2]);
+        in.close().get();
+
+        // Closing with prefetched chunks pending.
+        in = make_is(0);
+        expect(in, chunks[0]);
+        in.close().get();
+    });
+}
+
 // Test that sstables::key_view::tri_compare(const schema& s, partition_key_view other)
 // should correctly compare empty keys. The fact we did this incorrectly was
 // noticed while fixing #9375, and a separate issue on it is #10178.
@@ -0,0 +1,75 @@
+#
+# Copyright (C) 2026-present ScyllaDB
+#
+# SPDX-License-Identifier: LicenseRef-ScyllaDB-Source-Available-1.0
+#
+import asyncio
+import logging
+import pytest
+
+from cassandra import ConsistencyLevel  # type: ignore
+from cassandra.query import SimpleStatement  # type: ignore
+from test.cluster.conftest import skip_mode
+from test.cluster.util import new_test_keyspace
+from test.pylib.manager_client import ManagerClient
+from test.pylib.rest_client import inject_error
+
+
+logger = logging.getLogger(__name__)
+
+
+@skip_mode('release', 'error injections are not supported in release mode')
+@pytest.mark.asyncio
+async def test_adaptive_speculative_retry_hedges_slow_replica(manager: ManagerClient) -> None:
+    """
+    With adaptive_speculative_retry, a coordinator sends a speculative read
+    once the replica it reads from takes longer than usual, and the
+    speculative read is answered first when that replica is stalled.
+
+    1. Create a cluster with 3 nodes in dc1, and a coordinator in dc2, which
+       isn't a replica of the keyspace, replicated in dc1 only.
+    2. Read with ALL consistency level, to measure the latencies of all replicas.
+    3. In turn, stall the reads of each replica, and read with ONE consistency
+       level. The reads whose replica is stalled are answered by the
+       speculative ones.
+    """
+    cfg = {'adaptive_speculative_retry': True, 'speculative_retry_budget': 1.0}
+    servers = await manager.servers_add(4, config=cfg, property_file=[
+        {"dc": "dc1", "rack": "r1"},
+        {"dc": "dc1", "rack": "r2"},
+        {"dc": "dc1", "rack": "r3"},
+        {"dc": "dc2", "rack": "r1"},
+    ])
+    replicas, coordinator = servers[:3], servers[3]
+    cql = await manager.get_cql_exclusive(coordinator)
+
+    async with new_test_keyspace(manager, "WITH replication = {'class': 'NetworkTopologyStrategy', 'dc1': 3}") as ks:
+        table = f"{ks}.t"
+        await cql.run_async(f"CREATE TABLE {table} (pk int PRIMARY KEY, v int) WITH speculative_retry = '99PERCENTILE'")
+        partitions = 100
+        insert = cql.prepare(f"INSERT INTO {table} (pk, v) VALUES (?, ?)")
+        insert.consistency_level = ConsistencyLevel.ALL
+        await asyncio.gather(*[cql.run_async(insert, [pk, pk]) for pk in range(partitions)])
+
+        async def read_all(cl, times):
+            select = SimpleStatement(f"SELECT v FROM {table} WHERE pk = %s", consistency_level=cl)
+            for _ in range(times):
+                results = await asyncio.gather(*[cql.run_async(select, [pk]) for pk in range(partitions)])
+                assert [list(r)[0].v for r in results] == list(range(partitions))
+
+        async def get_metric(name):
+            metrics = await manager.metrics.query(coordinator.ip_addr)
+            return metrics.get(f"scylla_storage_proxy_coordinator_{name}") or 0
+
+        for replica in replicas:
+            await read_all(ConsistencyLevel.ALL, 5)
+            async with inject_error(manager.api, replica.ip_addr, 'storage_proxy::handle_read', parameters={'cf_name': 't'}) as handler:
+                await read_all(ConsistencyLevel.ONE, 1)
+                # Let the stalled reads go.
+                await handler.message()
+
+        sent = await get_metric("adaptive_speculative_reads")
+        won = await get_metric("speculative_reads_won")
+        logger.info(f"Adaptive speculative reads: {sent}, won: {won}")
+        assert sent > 0
+        assert won > 0
@@ -0,0 +1,82 @@
+#
+# Copyright (C) 2026-present ScyllaDB
+#
+# SPDX-License-Identifier: AGPL-3.0-or-later
+#
+import logging
+import pytest
+
+from cassandra import ConsistencyLevel  # type: ignore
+from cassandra.query import SimpleStatement  # type: ignore
+from test.pylib.manager_client import ManagerClient
+from test.cluster.util import new_test_keyspace
+
+
+logger = logging.getLogger(__name__)
+
+
+@pytest.mark.asyncio
+async def test_batched_in_reads_with_read_repair(manager: ManagerClient) -> None:
+    """
+    Multi-partition IN queries send a single read RPC per replica, for all
+    the partitions the replica is asked about. Check that such queries
+    return the same results as single-partition ones, and that partitions
+    whose replicas disagree are still repaired individually.
+
+    1. Create a cluster with 3 nodes and a table with replication factor = 3.
+    2. Write partitions with ALL consistency level.
+    3. Stop one of the nodes and overwrite some of the partitions.
+    4. Start the node, and read all partitions with an IN query with ALL
+       consistency level, which repairs the overwritten ones. Check that
+       replicas were sent far fewer reads than there are partitions.
+    5. Read them back with ONE consistency level.
+
+    Hinted handoff is disabled, so that only read repair fixes the node.
+    """
+    srvs = await manager.servers_add(3, config={'hinted_handoff_enabled': False}, auto_rack_dc="dc1")
+    cql, _ = await manager.get_ready_cql(srvs)
+
+    async def get_batched_reads():
+        total = 0
+        for srv in srvs:
+            metrics = await manager.metrics.query(srv.ip_addr)
+            total += metrics.get("scylla_storage_proxy_replica_batched_reads") or 0
+        return total
+
+    async with new_test_keyspace(manager, "WITH replication = {'class': 'NetworkTopologyStrategy', 'replication_factor': 3};") as ks:
+        table = f"{ks}.t"
+        await cql.run_async(f"CREATE TABLE {table} (pk int, ck int, v int, PRIMARY KEY (pk, ck));")
+
+        partitions = 100
+        insert = cql.prepare(f"INSERT INTO {table} (pk, ck, v) VALUES (?, ?, ?)")
+        insert.consistency_level = ConsistencyLevel.ALL
+        for pk in range(partitions):
+            for ck in range(2):
+                await cql.run_async(insert, [pk, ck, pk])
+
+        await manager.server_stop_gracefully(srvs[0].server_id)
+        overwritten = range(0, partitions, 7)
+        for pk in overwritten:
+            await cql.run_async(SimpleStatement(f"UPDATE {table} SET v = {-pk} WHERE pk = {pk} AND ck = 0",
+                                                consistency_level=ConsistencyLevel.ONE))
+        await manager.server_start(srvs[0].server_id, wait_others=2)
+        cql, _ = await manager.get_ready_cql(srvs)
+
+        def expected(pk, ck):
+            return -pk if pk in overwritten and ck == 0 else pk
+
+        in_list = ", ".join(str(pk) for pk in range(partitions))
+        for cl in [ConsistencyLevel.ALL, ConsistencyLevel.ONE]:
+            batched_reads = await get_batched_reads()
+            rows = await cql.run_async(SimpleStatement(f"SELECT pk, ck, v FROM {table} WHERE pk IN ({in_list})", consistency_level=cl))
+            assert sorted((r.pk, r.ck, r.v) for r in rows) == [(pk, ck, expected(pk, ck)) for pk in range(partitions) for ck in range(2)]
+            if cl == ConsistencyLevel.ALL:
+                # The coordinator is a replica, and sends at most one data and
+                # one digest read to each of the two other replicas.
+                batched_reads = await get_batched_reads() - batched_reads
+                logger.info(f"Batched reads: {batched_reads}")
+                assert 0 < batched_reads <= 4
+
+            rows = await cql.run_async(SimpleStatement(f"SELECT pk, ck, v FROM {table} WHERE pk IN ({in_list}) LIMIT 11", consistency_level=cl))
+            assert len(rows) == 11
+            assert all(r.v == expected(r.pk, r.ck) for r in rows)
@@ -344,3 +344,44 @@ async def test_read_repair_with_trace_logging(request, manager):
             found_read_repair |= "digest mismatch, starting read repair" == event.description
 
         assert found_read_repair
+
+
+@pytest.mark.asyncio
+@skip_mode('release', 'error injections are not supported in release mode')
+async def test_bypass_cache_read_repair_repairs_unselected_columns(manager):
+    """Data queries bypassing the cache don't read the values of columns they
+    don't select from sstables, but the mutation queries of the read repair
+    they trigger must, or the repaired replica would get empty values.
+    """
+    cmdline = ["--hinted-handoff-enabled", "0"]
+    [node1, node2] = await manager.servers_add(2, cmdline=cmdline, auto_rack_dc="dc1")
+
+    cql = manager.get_cql()
+    host1, host2 = await wait_for_cql_and_get_hosts(cql, [node1, node2], time.time() + 60)
+
+    async with new_test_keyspace(manager, "WITH replication = {'class': 'NetworkTopologyStrategy', 'replication_factor': 2};") as ks:
+        await cql.run_async(f"CREATE TABLE {ks}.t (pk int, ck int, v1 int, v2 text, PRIMARY KEY (pk, ck));")
+
+        insert_stmt = cql.prepare(f"INSERT INTO {ks}.t (pk, ck, v1, v2) VALUES (?, ?, ?, ?)")
+        insert_stmt.consistency_level = ConsistencyLevel.ONE
+
+        # Only node2 gets the rows, and keeps them in sstables.
+        values = {ck: f"{ck}-" + "x" * 1000 for ck in range(10)}
+        await manager.api.enable_injection(node1.ip_addr, "database_apply", one_shot=False)
+        for ck, v2 in values.items():
+            await cql.run_async(insert_stmt, (0, ck, ck, v2))
+        await manager.api.disable_injection(node1.ip_addr, "database_apply")
+        await manager.api.keyspace_flush(node2.ip_addr, ks)
+
+        select = SimpleStatement(f"SELECT ck, v1 FROM {ks}.t WHERE pk = 0 BYPASS CACHE", consistency_level=ConsistencyLevel.ALL)
+        rows = await cql.run_async(select)
+        assert sorted((r.ck, r.v1) for r in rows) == [(ck, ck) for ck in values]
+
+        await manager.api.keyspace_flush(node1.ip_addr, ks)
+        await manager.api.keyspace_compaction(node1.ip_addr, ks)
+        repaired = {}
+        for row in await cql.run_async(f"SELECT * FROM MUTATION_FRAGMENTS({ks}.t) WHERE pk = 0", host=host1):
+            if row.partition_region != 2:
+                continue
+            repaired[row.ck] = json.loads(row.value)["v2"]
+        assert repaired == values
@@ -0,0 +1,122 @@
+# Copyright 2026-present ScyllaDB
+#
+# SPDX-License-Identifier: LicenseRef-ScyllaDB-Source-Available-1.0
+
+###############################################################################
+# Tests for sstable-attached indexes, created with CREATE CUSTOM INDEX ...
+# USING 'sstable_index'. They are a Scylla extension which narrows down
+# filtering range scans on the indexed column, at consistency level ONE, to
+# the partitions the index finds. The queries still need ALLOW FILTERING.
+###############################################################################
+
+import pytest
+from . import nodetool
+from .util import new_test_table, unique_name, ScyllaMetrics
+from cassandra.protocol import InvalidRequest
+from cassandra.query import SimpleStatement
+from cassandra import ConsistencyLevel
+
+def select(cql, query, cl):
+    return sorted(cql.execute(SimpleStatement(query, consistency_level=cl)))
+
+def narrowed_range_scans(cql):
+    return ScyllaMetrics.query(cql).get('scylla_database_sstable_index_narrowed_range_scans') or 0
+
+# Checks that querying with the index, at CL ONE, returns the same rows as a
+# full filtering scan, at CL ALL, for all values of v in the table and a few
+# absent ones. If narrowed, checks that the index narrowed down the scans.
+def check_queries(cql, table, values, narrowed=True):
+    queries = []
+    for v in values:
+        queries.append(f"SELECT * FROM {table} WHERE v = {v} ALLOW FILTERING")
+        queries.append(f"SELECT pk, ck FROM {table} WHERE v > {v} AND v < {v + 3} ALLOW FILTERING")
+    for query in queries:
+        expected = select(cql, query, ConsistencyLevel.ALL)
+        before = narrowed_range_scans(cql)
+        assert select(cql, query, ConsistencyLevel.ONE) == expected
+        if narrowed:
+            assert narrowed_range_scans(cql) > before
+
+def test_sstable_index_query(cql, test_keyspace, scylla_only):
+    with new_test_table(cql, test_keyspace, "pk int, ck int, v int, PRIMARY KEY (pk, ck)") as table:
+        cql.execute(f"CREATE CUSTOM INDEX ON {table}(v) USING 'sstable_index'")
+        insert = cql.prepare(f"INSERT INTO {table} (pk, ck, v) VALUES (?, ?, ?)")
+        for pk in range(50):
+            for ck in range(3):
+                cql.execute(insert, [pk, ck, (pk + ck) % 10])
+        values = range(-1, 12)
+
+        # Only in memtables
+        check_queries(cql, table, values)
+        # Only in sstables
+        nodetool.flush(cql, table)
+        check_queries(cql, table, values)
+
+        # Overwritten and deleted values, split between memtables and
+        # sstables: the index still lists the old values in the sstables.
+        for pk in range(0, 50, 3):
+            cql.execute(insert, [pk, 0, 100 + pk % 2])
+        for pk in range(1, 50, 5):
+            cql.execute(f"DELETE FROM {table} WHERE pk = {pk}")
+        cql.execute(f"UPDATE {table} SET v = null WHERE pk = 2 AND ck = 1")
+        values = list(range(-1, 12)) + [100, 101]
+        check_queries(cql, table, values)
+        nodetool.flush(cql, table)
+        check_queries(cql, table, values)
+        nodetool.compact(cql, table)
+        check_queries(cql, table, values)
+
+# Indexes which existed before the sstables were written cover all of them,
+# but sstables written before the index don't have it, and are scanned.
+def test_sstable_index_created_after_data(cql, test_keyspace, scylla_only):
+    with new_test_table(cql, test_keyspace, "pk int PRIMARY KEY, v int") as table:
+        insert = cql.prepare(f"INSERT INTO {table} (pk, v) VALUES (?, ?)")
+        for pk in range(20):
+            cql.execute(insert, [pk, pk % 4])
+        nodetool.flush(cql, table)
+        cql.execute(f"CREATE CUSTOM INDEX ON {table}(v) USING 'sstable_index'")
+        for pk in range(20, 40):
+            cql.execute(insert, [pk, pk % 4])
+        check_queries(cql, table, range(5), narrowed=False)
+        nodetool.flush(cql, table)
+        check_queries(cql, table, range(5), narrowed=False)
+        nodetool.compact(cql, table)
+        check_queries(cql, table, range(5))
+
+# The index doesn't serve queries by itself, it only narrows down filtering
+# scans when it can be used, so the queries still need ALLOW FILTERING.
+def test_sstable_index_needs_filtering(cql, test_keyspace, scylla_only):
+    with new_test_table(cql, test_keyspace, "pk int PRIMARY KEY, v int, w int") as table:
+        cql.execute(f"CREATE CUSTOM INDEX ON {table}(v) USING 'sstable_index'")
+        cql.execute(f"SELECT * FROM {table} WHERE v = 1 ALLOW FILTERING")
+        with pytest.raises(InvalidRequest, match="ALLOW FILTERING"):
+            cql.execute(f"SELECT * FROM {table} WHERE v = 1")
+        with pytest.raises(InvalidRequest, match="ALLOW FILTERING"):
+            cql.execute(f"SELECT * FROM {table} WHERE v = 1 AND w = 1")
+        with pytest.raises(InvalidRequest, match="ALLOW FILTERING"):
+            cql.execute(f"SELECT * FROM {table} WHERE v != 1")
+        with pytest.raises(InvalidRequest, match="ALLOW FILTERING"):
+            cql.execute(f"SELECT * FROM {table} WHERE w = 1")
+
+def test_sstable_index_validation(cql, test_keyspace, scylla_only):
+    schema = "pk int, ck int, v int, d duration, s set<int>, PRIMARY KEY (pk, ck)"
+    with new_test_table(cql, test_keyspace, schema) as table:
+        with pytest.raises(InvalidRequest, match="only supported on regular columns"):
+            cql.execute(f"CREATE CUSTOM INDEX ON {table}(ck) USING 'sstable_index'")
+        with pytest.raises(InvalidRequest, match="not supported on column"):
+            cql.execute(f"CREATE CUSTOM INDEX ON {table}(d) USING 'sstable_index'")
+        with pytest.raises(InvalidRequest, match="not supported on column"):
+            cql.execute(f"CREATE CUSTOM INDEX ON {table}(s) USING 'sstable_index'")
+        with pytest.raises(InvalidRequest, match="have no options"):
+            cql.execute(f"CREATE CUSTOM INDEX ON {table}(v) USING 'sstable_index' WITH OPTIONS = {{'a': 'b'}}")
+
+def test_describe_sstable_index(cql, test_keyspace, scylla_only):
+    with new_test_table(cql, test_keyspace, "pk int PRIMARY KEY, v int") as table:
+        name = unique_name()
+        cql.execute(f"CREATE CUSTOM INDEX {name} ON {table}(v) USING 'sstable_index'")
+        desc = cql.execute(f"DESC INDEX {test_keyspace}.{name}").one().create_statement
+        assert f"USING 'sstable_index'" in desc
+        cql.execute(f"DROP INDEX {test_keyspace}.{name}")
+        before = narrowed_range_scans(cql)
+        select(cql, f"SELECT * FROM {table} WHERE v = 1 ALLOW FILTERING", ConsistencyLevel.ONE)
+        assert narrowed_range_scans(cql) == before
@@ -1783,3 +1783,44 @@ def test_scylla_sstable_query_data_from_snapshot(cql, test_keyspace, scylla_path
         assert out
         print(f"out: {out.decode('utf-8')}")
         assert json.loads(out)
+
+
+def test_scylla_sstable_simulate_compaction(cql, test_keyspace, scylla_path, scylla_data_dir):
+    with scylla_sstable(simple_no_clustering_table, cql, test_keyspace, scylla_data_dir) as (_, schema_file, sstables):
+        def simulate(args, sstables=[]):
+            out = subprocess.check_output([scylla_path, "sstable", "simulate-compaction", "--schema-file", schema_file] + args + sstables)
+            return json.loads(out)
+
+        # Replaying the sstables themselves
+        res = simulate(["--compaction-strategy", "SizeTieredCompactionStrategy"], sstables)
+        assert res["compaction_strategy"] == "SizeTieredCompactionStrategy"
+        assert len(res["samples"]) == len(sstables)
+
+        # Synthetic workload, 1MB flushes over the whole ring
+        res = simulate(["--compaction-strategy", "SizeTieredCompactionStrategy", "--compaction-strategy-option", "min_threshold=4",
+                        "--flushes", "64", "--flush-size-mb", "1", "--sample-interval", "8"])
+        assert res["compaction_strategy_options"] == {"min_threshold": "4"}
+        samples = res["samples"]
+        assert len(samples) == 8
+        last = samples[-1]
+        assert last["flushes"] == 64
+        assert last["flushed_bytes"] == 64 * 1024 * 1024
+        assert last["compactions"] > 0
+        assert last["sstables"] < 64
+        assert last["write_amplification"] > 1
+        assert last["live_bytes"] == last["flushed_bytes"]
+        assert last["space_amplification"] == pytest.approx(1)
+        assert last["sstables_per_read"] == pytest.approx(last["sstables"])
+
+        # Sequential writes into a leveled table hardly overlap, reads hit few of the sstables
+        res = simulate(["--compaction-strategy", "LeveledCompactionStrategy", "--compaction-strategy-option", "sstable_size_in_mb=1",
+                        "--flushes", "64", "--flush-size-mb", "1", "--key-distribution", "sequential"])
+        last = res["samples"][-1]
+        assert last["sstables_per_read"] < 2
+        assert last["sstables"] > 2
+
+        # Bounded data sets are overwritten
+        res = simulate(["--compaction-strategy", "SizeTieredCompactionStrategy", "--dataset-size-mb", "8",
+                        "--flushes", "64", "--flush-size-mb", "1"])
+        last = res["samples"][-1]
+        assert last["live_bytes"] < last["flushed_bytes"]
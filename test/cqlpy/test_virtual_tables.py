@@ -174,3 +174,14 @@ def test_token_ring_tablets(scylla_only, cql, test_keyspace_tablets):
         for row in rows:
             assert row.keyspace_name == test_keyspace_tablets
             assert row.table_name == table
+
+def test_hot_partitions(scylla_only, cql, test_keyspace):
+    _check_exists(cql, "hot_partitions", ("kind", "rank", "keyspace_name", "table_name", "partition_key", "count", "error"))
+    with util.new_test_table(cql, test_keyspace, 'pk int PRIMARY KEY, v int') as table:
+        # Only a sample of writes is tracked, so write enough to the same partition to be sampled.
+        stmt = cql.prepare(f"INSERT INTO {table} (pk, v) VALUES (42, ?)")
+        for i in range(1000):
+            cql.execute(stmt, [i])
+        rows = list(cql.execute("SELECT table_name, partition_key, count FROM system.hot_partitions WHERE kind = 'writes'"))
+        table_name = table.split('.')[1]
+        assert any(r.table_name == table_name and r.partition_key == '42' and r.count > 0 for r in rows)
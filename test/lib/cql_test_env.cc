@@ -646,6 +646,7 @@ class single_node_cql_env : public cql_test_env {
                     .available_memory = dbcfg.available_memory,
                     .static_shares = cfg->compaction_static_shares,
                     .throughput_mb_per_sec = cfg->compaction_throughput_mb_per_sec,
+                    .sub_range_parallelism = cfg->compaction_sub_range_parallelism,
                     .flush_all_tables_before_major = cfg->compaction_flush_all_tables_before_major_seconds() * 1s,
                 };
             });
@@ -102,6 +102,10 @@ class test {
         return _sst->read_filter();
     }
 
+    future<lw_shared_ptr<const attached_index>> read_attached_index() {
+        return _sst->read_attached_index();
+    }
+
     future<summary_entry&> read_summary_entry(size_t i) {
         return _sst->read_summary_entry(i);
     }
@@ -211,6 +215,10 @@ class test {
         return _sst->reclaim_memory_from_components();
     }
 
+    size_t total_memory_reclaimed() const {
+        return _sst->total_memory_reclaimed();
+    }
+
     void reload_reclaimed_components() {
         _sst->reload_reclaimed_components().get();
     }
@@ -28,14 +28,74 @@ class piggie {
     piggie(size_t sz) noexcept : _extra_size(sz) {}
 };
 
+// A node of a chain linked in random order, so that walking it accesses LSA memory randomly.
+struct chain_node {
+    chain_node* next = nullptr;
+    uint64_t value;
+
+    explicit chain_node(uint64_t v) noexcept : value(v) {}
+};
+
 static constexpr unsigned nr_seq_allocations = 1024;
 static constexpr unsigned nr_iterations = 20000;
 static constexpr unsigned nr_sizes = 32;
+static constexpr size_t chain_node_size = 64;
+static constexpr size_t nr_lookups = 10'000'000;
+
+// Measures throughput of random reads from LSA memory, which is bound by TLB misses when
+// the working set is large.
+static void run_lookup_benchmark(size_t memory_mb) {
+    logalloc::region reg;
+    auto& allocator = reg.allocator();
+    const size_t nr_nodes = memory_mb * 1024 * 1024 / chain_node_size;
+
+    // Nodes must not be moved while we hold pointers to them.
+    logalloc::reclaim_lock rl(reg);
+
+    std::vector<chain_node*> nodes;
+    nodes.reserve(nr_nodes);
+    for (size_t i = 0; i < nr_nodes; i++) {
+        void* mem = allocator.alloc<chain_node>(chain_node_size);
+        nodes.push_back(new (mem) chain_node(i));
+    }
+
+    std::mt19937 g(std::random_device{}());
+    std::shuffle(nodes.begin(), nodes.end(), g);
+    for (size_t i = 0; i < nr_nodes; i++) {
+        nodes[i]->next = nodes[(i + 1) % nr_nodes];
+    }
+
+    for (unsigned round = 0; round < 5; round++) {
+        auto n = nodes.front();
+        uint64_t sum = 0;
+        auto d = duration_in_seconds([&] {
+            for (size_t i = 0; i < nr_lookups; i++) {
+                sum += n->value;
+                n = n->next;
+            }
+        });
+        fmt::print("Lookups: {:.2f} M/s (checksum {})\n", nr_lookups / d.count() / 1e6, sum);
+    }
+
+    // Nodes are allocated larger than chain_node, so destroy() would free the wrong size.
+    for (auto n : nodes) {
+        n->~chain_node();
+        allocator.free(n, chain_node_size);
+    }
+}
 
 int main(int argc, char** argv) {
+    namespace bpo = boost::program_options;
     app_template app;
-    return app.run(argc, argv, [] {
-        return seastar::async([&] {
+    app.add_options()
+        ("huge-pages", "Allocate LSA segments in huge page sized chunks")
+        ("lookup-memory-mb", bpo::value<size_t>()->default_value(1024), "Amount of LSA memory to spread lookups over");
+
+    return app.run(argc, argv, [&app] {
+        return seastar::async([&app] {
+            if (app.configuration().contains("huge-pages")) {
+                logalloc::use_huge_page_segment_pool_backend().get();
+            }
             logalloc::prime_segment_pool(memory::stats().total_memory(), memory::min_free_memory()).get();
             logalloc::region reg;
 
@@ -73,6 +133,8 @@ int main(int argc, char** argv) {
             }
 
             fmt::print("Total time: {} s\n", total.count());
+
+            run_lookup_benchmark(app.configuration()["lookup-memory-mb"].as<size_t>());
         });
     });
 }
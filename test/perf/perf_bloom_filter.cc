@@ -0,0 +1,105 @@
+/*
+ * Copyright (C) 2026-present ScyllaDB
+ */
+
+/*
+ * SPDX-License-Identifier: LicenseRef-ScyllaDB-Source-Available-1.0
+ */
+
+#include <fmt/core.h>
+
+#include <seastar/core/align.hh>
+
+#include "utils/bloom_calculations.hh"
+#include "utils/bloom_filter.hh"
+#include "utils/i_filter.hh"
+
+#include <seastar/testing/perf_tests.hh>
+
+// Compares the classic and the split-block bloom filter layouts: memory and
+// false positive rate are printed once, probe latency is what the tests measure.
+//
+// The filters are sized so that they don't fit in the CPU caches, which is
+// where the number of cache lines touched by a probe matters.
+class bloom_filter_test {
+    static constexpr int64_t nr_keys = 4'000'000;
+    static constexpr double fp_chance = 0.01;
+    static constexpr size_t nr_probes = 4096;
+
+    static large_bitset make_bitset(size_t nr_bits) {
+        // large_bitset(size_t) has to run in a thread, the fixture doesn't.
+        utils::chunked_vector<uint64_t> storage(align_up<size_t>(nr_bits, 64) / 64);
+        return large_bitset(nr_bits, std::move(storage));
+    }
+
+    static utils::filter_ptr make_filter(utils::filter_layout layout) {
+        if (layout == utils::filter_layout::split_block) {
+            auto nr_bits = utils::filter::get_split_block_bitset_size(nr_keys, fp_chance);
+            return utils::filter::create_filter(0, make_bitset(nr_bits), utils::filter_format::m_format, layout);
+        }
+        auto spec = utils::bloom_calculations::compute_bloom_spec(utils::bloom_calculations::max_buckets_per_element(nr_keys), fp_chance);
+        auto nr_bits = utils::filter::get_bitset_size(nr_keys, spec.buckets_per_element);
+        return utils::filter::create_filter(spec.K, make_bitset(nr_bits), utils::filter_format::m_format);
+    }
+
+    static bytes make_key(int64_t i) {
+        return to_bytes(fmt::format("partition-key-{}", i));
+    }
+
+    static utils::filter_ptr populate(utils::filter_layout layout, std::string_view name) {
+        auto filter = make_filter(layout);
+        for (int64_t i = 0; i < nr_keys; ++i) {
+            filter->add(make_key(i));
+        }
+        int64_t false_positives = 0;
+        const int64_t nr_absent = nr_keys / 4;
+        for (int64_t i = nr_keys; i < nr_keys + nr_absent; ++i) {
+            false_positives += filter->is_present(make_key(i));
+        }
+        fmt::print("{}: {} bytes ({:.2f} bits per key), false positive rate {:.5f}\n", name, filter->memory_size(),
+                double(filter->memory_size()) * 8 / nr_keys, double(false_positives) / nr_absent);
+        return filter;
+    }
+
+    static std::vector<utils::hashed_key> make_probes(int64_t first) {
+        std::vector<utils::hashed_key> probes;
+        probes.reserve(nr_probes);
+        for (size_t i = 0; i < nr_probes; ++i) {
+            // Spread over the key space, so that consecutive probes don't hit the same cache lines.
+            probes.push_back(utils::make_hashed_key(make_key(first + i * 977)));
+        }
+        return probes;
+    }
+protected:
+    utils::filter_ptr _classic = populate(utils::filter_layout::classic, "classic");
+    utils::filter_ptr _split_block = populate(utils::filter_layout::split_block, "split_block");
+    // Keys which were added to the filters.
+    std::vector<utils::hashed_key> _present = make_probes(0);
+    // Keys which were not, which are rejected after fewer memory accesses by the classic layout.
+    std::vector<utils::hashed_key> _absent = make_probes(nr_keys);
+
+    size_t probe(utils::i_filter& filter, const std::vector<utils::hashed_key>& keys) {
+        size_t hits = 0;
+        for (auto& k : keys) {
+            hits += filter.is_present(k);
+        }
+        perf_tests::do_not_optimize(hits);
+        return keys.size();
+    }
+};
+
+PERF_TEST_F(bloom_filter_test, classic_present) {
+    return probe(*_classic, _present);
+}
+
+PERF_TEST_F(bloom_filter_test, classic_absent) {
+    return probe(*_classic, _absent);
+}
+
+PERF_TEST_F(bloom_filter_test, split_block_present) {
+    return probe(*_split_block, _present);
+}
+
+PERF_TEST_F(bloom_filter_test, split_block_absent) {
+    return probe(*_split_block, _absent);
+}
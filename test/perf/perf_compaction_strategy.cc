@@ -0,0 +1,188 @@
+/*
+ * Copyright (C) 2026-present ScyllaDB
+ */
+
+/*
+ * SPDX-License-Identifier: LicenseRef-ScyllaDB-Source-Available-1.0
+ */
+
+// Replays the same write workload against a table with each compaction
+// strategy: memtables of random overwrites are flushed one after the other,
+// and after each flush the strategy is asked for compaction jobs until it
+// has none. Reports, for each strategy:
+//
+//  - the write amplification of compaction, i.e. bytes written by compaction
+//    per byte flushed;
+//  - the number of sstables a single-partition read has to look at, averaged
+//    over a sample of keys, at the end of the run;
+//  - the time spent compacting.
+
+#include <fmt/ranges.h>
+#include "seastarx.hh"
+#include <seastar/core/app-template.hh>
+#include <seastar/core/reactor.hh>
+#include <seastar/util/closeable.hh>
+
+#include "compaction/compaction_manager.hh"
+#include "compaction/strategy_control.hh"
+#include "replica/memtable.hh"
+#include "schema/schema_builder.hh"
+#include "test/lib/key_utils.hh"
+#include "test/lib/log.hh"
+#include "test/lib/random_utils.hh"
+#include "test/lib/sstable_utils.hh"
+#include "test/lib/test_services.hh"
+
+using namespace sstables;
+
+namespace {
+
+struct strategy_config {
+    sstring name;
+    compaction_strategy_type type;
+    std::map<sstring, sstring> options;
+};
+
+struct workload_config {
+    unsigned flushes;
+    unsigned partitions_per_flush;
+    unsigned key_space;
+    unsigned value_size;
+};
+
+struct run_result {
+    uint64_t flushed_bytes = 0;
+    uint64_t compacted_bytes = 0;
+    unsigned compactions = 0;
+    size_t sstables = 0;
+    double sstables_per_read = 0;
+    std::chrono::duration<double> compaction_time{};
+};
+
+class all_candidates_control : public compaction::strategy_control {
+public:
+    bool has_ongoing_compaction(compaction::compaction_group_view&) const noexcept override {
+        return false;
+    }
+    future<std::vector<shared_sstable>> candidates(compaction::compaction_group_view& t) const override {
+        auto main_set = co_await t.main_sstable_set();
+        co_return *main_set->all() | std::ranges::to<std::vector>();
+    }
+    future<std::vector<frozen_sstable_run>> candidates_as_runs(compaction::compaction_group_view& t) const override {
+        auto main_set = co_await t.main_sstable_set();
+        co_return main_set->all_sstable_runs();
+    }
+};
+
+run_result run_workload(test_env& env, const strategy_config& strategy, const workload_config& cfg) {
+    auto builder = schema_builder("ks", "cf")
+            .with_column("pk", utf8_type, column_kind::partition_key)
+            .with_column("ck", int32_type, column_kind::clustering_key)
+            .with_column("v", bytes_type);
+    builder.set_compressor_params(compression_parameters::no_compression());
+    builder.set_compaction_strategy(strategy.type);
+    builder.set_compaction_strategy_options(strategy.options);
+    auto s = builder.build();
+
+    auto t = env.make_table_for_tests(s);
+    auto stop_t = deferred_stop(t);
+    auto sst_gen = env.make_sst_factory(s);
+    auto& view = t.as_compaction_group_view();
+    auto cs = t->get_compaction_strategy();
+    all_candidates_control control;
+    const auto keys = tests::generate_partition_keys(cfg.key_space, s);
+    const auto value = bytes(cfg.value_size, int8_t('x'));
+    run_result result;
+
+    for (unsigned flush = 0; flush < cfg.flushes; ++flush) {
+        auto mt = make_lw_shared<replica::memtable>(s);
+        for (unsigned i = 0; i < cfg.partitions_per_flush; ++i) {
+            mutation m(s, keys[tests::random::get_int<size_t>(0, keys.size() - 1)]);
+            m.set_clustered_cell(clustering_key::from_single_value(*s, int32_type->decompose(0)), bytes("v"), data_value(value), api::new_timestamp());
+            mt->apply(std::move(m));
+        }
+        auto sst = make_sstable_containing(sst_gen, mt);
+        result.flushed_bytes += sst->data_size();
+        view.on_compaction_completion(compaction_completion_desc{ .new_sstables = {sst} }, offstrategy::no).get();
+
+        while (true) {
+            auto desc = cs.get_sstables_for_compaction(view, control).get();
+            if (desc.sstables.empty()) {
+                break;
+            }
+            auto input = desc.sstables;
+            auto start = std::chrono::steady_clock::now();
+            auto ret = compact_sstables(env, std::move(desc), t, sst_gen).get();
+            result.compaction_time += std::chrono::steady_clock::now() - start;
+            for (auto& new_sst : ret.new_sstables) {
+                result.compacted_bytes += new_sst->data_size();
+            }
+            ++result.compactions;
+            view.on_compaction_completion(compaction_completion_desc{ .old_sstables = input, .new_sstables = ret.new_sstables }, offstrategy::no).get();
+        }
+    }
+
+    auto all = *view.main_sstable_set().get()->all() | std::ranges::to<std::vector>();
+    result.sstables = all.size();
+    constexpr size_t sampled_keys = 1000;
+    size_t lookups = 0;
+    for (size_t i = 0; i < sampled_keys; ++i) {
+        auto& key = keys[tests::random::get_int<size_t>(0, keys.size() - 1)];
+        lookups += std::ranges::count_if(all, [&] (const shared_sstable& sst) {
+            return sst->get_first_decorated_key().tri_compare(*s, key) <= 0 && sst->get_last_decorated_key().tri_compare(*s, key) >= 0;
+        });
+    }
+    result.sstables_per_read = double(lookups) / sampled_keys;
+    return result;
+}
+
+}
+
+int main(int argc, char** argv) {
+    namespace bpo = boost::program_options;
+    app_template app;
+    app.add_options()
+        ("flushes", bpo::value<unsigned>()->default_value(200), "Number of memtables flushed")
+        ("partitions-per-flush", bpo::value<unsigned>()->default_value(1000), "Number of partitions written to each memtable")
+        ("key-space", bpo::value<unsigned>()->default_value(50000), "Number of distinct partition keys written to")
+        ("value-size", bpo::value<unsigned>()->default_value(1024), "Size of the value of each partition, in bytes")
+        ("strategies", bpo::value<std::vector<sstring>>()->multitoken(), "Names of the strategies to run, all of them by default")
+        ;
+
+    return app.run(argc, argv, [&app] {
+        return seastar::async([&app] {
+            auto& config = app.configuration();
+            workload_config cfg {
+                .flushes = config["flushes"].as<unsigned>(),
+                .partitions_per_flush = config["partitions-per-flush"].as<unsigned>(),
+                .key_space = config["key-space"].as<unsigned>(),
+                .value_size = config["value-size"].as<unsigned>(),
+            };
+
+            // Flushes are about partitions-per-flush * value-size bytes, 1MB by default,
+            // so sizes are scaled down so that several levels or tiers are used.
+            std::vector<strategy_config> strategies = {
+                {"stcs", compaction_strategy_type::size_tiered, {{"min_sstable_size", "1048576"}}},
+                {"lcs", compaction_strategy_type::leveled, {{"sstable_size_in_mb", "4"}}},
+                {"ucs-t4", compaction_strategy_type::unified, {{"scaling_parameters", "T4"}, {"min_sstable_size_in_mb", "1"}, {"target_sstable_size_in_mb", "4"}}},
+                {"ucs-l10", compaction_strategy_type::unified, {{"scaling_parameters", "L10"}, {"min_sstable_size_in_mb", "1"}, {"target_sstable_size_in_mb", "4"}}},
+                {"ucs-t4-l10", compaction_strategy_type::unified, {{"scaling_parameters", "T4, L10"}, {"min_sstable_size_in_mb", "1"}, {"target_sstable_size_in_mb", "4"}}},
+            };
+            if (config.contains("strategies")) {
+                auto names = config["strategies"].as<std::vector<sstring>>();
+                std::erase_if(strategies, [&] (const strategy_config& s) { return std::ranges::find(names, s.name) == names.end(); });
+            }
+
+            fmt::print("{:<12} {:>12} {:>12} {:>12} {:>10} {:>12} {:>12}\n",
+                    "strategy", "flushed MB", "write amp", "compactions", "sstables", "sst/read", "time [s]");
+            for (auto& strategy : strategies) {
+                test_env::do_with_async([&] (test_env& env) {
+                    auto r = run_workload(env, strategy, cfg);
+                    fmt::print("{:<12} {:>12.1f} {:>12.2f} {:>12} {:>10} {:>12.2f} {:>12.3f}\n",
+                            strategy.name, r.flushed_bytes / 1e6, double(r.compacted_bytes) / r.flushed_bytes, r.compactions,
+                            r.sstables, r.sstables_per_read, r.compaction_time.count());
+                }).get();
+            }
+        });
+    });
+}
@@ -0,0 +1,124 @@
+/*
+ * Copyright (C) 2026-present ScyllaDB
+ */
+
+/*
+ * SPDX-License-Identifier: LicenseRef-ScyllaDB-Source-Available-1.0
+ */
+
+// Measures the latency of secondary index queries, which read the index and
+// then fetch the matching rows from the base table, for varying selectivity
+// of the index, i.e. the fraction of the base rows a query returns.
+
+#include <fmt/ranges.h>
+#include "seastarx.hh"
+#include "test/lib/cql_test_env.hh"
+#include "test/lib/log.hh"
+#include "transport/messages/result_message.hh"
+#include "db/config.hh"
+#include <seastar/core/app-template.hh>
+#include <seastar/core/sleep.hh>
+
+using namespace std::chrono_literals;
+
+static size_t result_rows(const shared_ptr<cql_transport::messages::result_message>& msg) {
+    auto rows = dynamic_pointer_cast<cql_transport::messages::result_message::rows>(msg);
+    if (!rows) {
+        throw std::runtime_error("Expected a rows result");
+    }
+    return rows->rs().result_set().size();
+}
+
+static int64_t result_count(const shared_ptr<cql_transport::messages::result_message>& msg) {
+    auto rows = dynamic_pointer_cast<cql_transport::messages::result_message::rows>(msg);
+    if (!rows || rows->rs().result_set().size() != 1) {
+        throw std::runtime_error("Expected a single row result");
+    }
+    return value_cast<int64_t>(long_type->deserialize(*rows->rs().result_set().rows().front().front()));
+}
+
+struct latency_stats {
+    std::vector<double> latencies_us;
+
+    double percentile(double p) {
+        std::ranges::sort(latencies_us);
+        return latencies_us[std::min(latencies_us.size() - 1, size_t(p * latencies_us.size()))];
+    }
+};
+
+int main(int argc, char** argv) {
+    namespace bpo = boost::program_options;
+    app_template app;
+    app.add_options()
+        ("partitions", bpo::value<unsigned>()->default_value(10000), "Number of partitions in the base table")
+        ("rows-per-partition", bpo::value<unsigned>()->default_value(1), "Number of rows in each partition. With more than one, "
+                "the table has a clustering key and base rows are fetched individually instead of as whole partitions")
+        ("selectivity", bpo::value<std::vector<double>>()->multitoken()->default_value({0.0001, 0.001, 0.01, 0.1}, "0.0001 0.001 0.01 0.1"),
+                "Fractions of the base rows matched by a query")
+        ("queries", bpo::value<unsigned>()->default_value(100), "Number of queries to run for each selectivity")
+        ;
+
+    return app.run(argc, argv, [&app] {
+        auto cfg_ptr = make_shared<db::config>();
+        auto& cfg = *cfg_ptr;
+        cfg.enable_commitlog(false);
+
+        return do_with_cql_env_thread([&app] (cql_test_env& env) {
+            const auto partitions = app.configuration()["partitions"].as<unsigned>();
+            const auto rows_per_partition = app.configuration()["rows-per-partition"].as<unsigned>();
+            const auto selectivities = app.configuration()["selectivity"].as<std::vector<double>>();
+            const auto queries = app.configuration()["queries"].as<unsigned>();
+            const uint64_t rows = uint64_t(partitions) * rows_per_partition;
+
+            // One indexed column per selectivity: the value of column v<i> is
+            // one of 1/selectivity values, spread uniformly across rows.
+            std::vector<uint64_t> values;
+            for (auto s : selectivities) {
+                values.push_back(std::max<uint64_t>(1, std::llround(1 / s)));
+            }
+            auto columns = std::views::iota(size_t(0), selectivities.size()) | std::views::transform([] (size_t i) { return format("v{}", i); }) | std::ranges::to<std::vector>();
+
+            env.execute_cql(format("CREATE TABLE ks.t (pk int, ck int, {} int, payload text, PRIMARY KEY (pk{}))",
+                    fmt::join(columns, " int, "), rows_per_partition > 1 ? ", ck" : "")).get();
+
+            testlog.info("Populating {} partitions with {} rows each", partitions, rows_per_partition);
+            const auto payload = sstring(100, 'x');
+            for (unsigned pk = 0; pk < partitions; ++pk) {
+                for (unsigned ck = 0; ck < rows_per_partition; ++ck) {
+                    auto row = uint64_t(pk) * rows_per_partition + ck;
+                    auto vs = values | std::views::transform([&] (uint64_t n) { return row % n; });
+                    env.execute_cql(format("INSERT INTO ks.t (pk, ck, {}, payload) VALUES ({}, {}, {}, '{}')",
+                            fmt::join(columns, ", "), pk, ck, fmt::join(vs, ", "), payload)).get();
+                }
+            }
+
+            for (size_t i = 0; i < selectivities.size(); ++i) {
+                env.execute_cql(format("CREATE INDEX ON ks.t ({})", columns[i])).get();
+            }
+            testlog.info("Waiting for the indexes to be built");
+            for (size_t i = 0; i < selectivities.size(); ++i) {
+                auto expected = (rows + values[i] - 1) / values[i];
+                while (result_count(env.execute_cql(format("SELECT COUNT(*) FROM ks.t WHERE {} = 0", columns[i])).get()) != int64_t(expected)) {
+                    sleep(100ms).get();
+                }
+            }
+
+            std::cout << format("{:>12} {:>10} {:>12} {:>12} {:>12} {:>12} {:>12}\n", "selectivity", "query", "rows/query", "p50 [us]", "p90 [us]", "p99 [us]", "max [us]");
+            for (size_t i = 0; i < selectivities.size(); ++i) {
+                for (auto [name, select] : {std::pair{"select", "*"}, std::pair{"count", "COUNT(*)"}}) {
+                    latency_stats stats;
+                    uint64_t total_rows = 0;
+                    for (unsigned q = 0; q < queries; ++q) {
+                        auto query = format("SELECT {} FROM ks.t WHERE {} = {}", select, columns[i], q % values[i]);
+                        auto start = std::chrono::steady_clock::now();
+                        auto msg = env.execute_cql(query).get();
+                        stats.latencies_us.push_back(std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count());
+                        total_rows += select == std::string_view("*") ? result_rows(msg) : result_count(msg);
+                    }
+                    std::cout << format("{:>12} {:>10} {:>12} {:>12.0f} {:>12.0f} {:>12.0f} {:>12.0f}\n", selectivities[i], name, total_rows / queries,
+                            stats.percentile(0.5), stats.percentile(0.9), stats.percentile(0.99), stats.percentile(1));
+                }
+            }
+        }, cfg_ptr);
+    });
+}
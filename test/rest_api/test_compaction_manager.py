@@ -66,3 +66,10 @@ def test_compaction_manager_stop_keyspace_compaction_tables(cql, this_dc, rest_a
                 assert resp.status_code == expected_status_code, e
 
     cql.execute(f"DROP KEYSPACE {keyspace}")
+
+def test_compaction_manager_read_amplification_by_table(rest_api):
+    resp = rest_api.send("GET", "compaction_manager/metrics/read_amplification_by_table")
+    resp.raise_for_status()
+    for entry in resp.json():
+        assert set(entry.keys()) == {"ks", "cf", "score"}
+        assert entry["score"] > 0
@@ -0,0 +1,323 @@
+/*
+ * Copyright (C) 2026-present ScyllaDB
+ */
+
+/*
+ * SPDX-License-Identifier: LicenseRef-ScyllaDB-Source-Available-1.0
+ */
+
+#include <seastar/core/condition-variable.hh>
+#include <seastar/util/log.hh>
+
+#include "compaction/compaction_backlog_manager.hh"
+#include "compaction/compaction_group_view.hh"
+#include "compaction/compaction_strategy.hh"
+#include "compaction/compaction_strategy_state.hh"
+#include "compaction/strategy_control.hh"
+#include "data_dictionary/storage_options.hh"
+#include "sstables/sstable_set.hh"
+#include "sstables/sstables.hh"
+#include "sstables/sstables_manager.hh"
+#include "tombstone_gc.hh"
+#include "tools/compaction_simulator.hh"
+
+using namespace seastar;
+
+namespace tools {
+
+namespace {
+
+logging::logger simlog("compaction_simulator");
+
+// Compactions triggered by a single flush, after which the strategy is
+// considered to be stuck, proposing the same job over and over.
+constexpr unsigned max_compactions_per_flush = 1000;
+
+// Position of the token on the ring, in [0, 1].
+double ring_position(dht::token t) {
+    return (double(dht::token::to_int64(t)) - double(std::numeric_limits<int64_t>::min())) / std::pow(2.0, 64);
+}
+
+// Fraction of the ring spanned by [first, last].
+double ring_fraction(dht::token first, dht::token last) {
+    return std::max(ring_position(last) - ring_position(first), std::ldexp(1.0, -64));
+}
+
+double ring_fraction(const sstables::shared_sstable& sst) {
+    return ring_fraction(sst->get_first_decorated_key().token(), sst->get_last_decorated_key().token());
+}
+
+dht::decorated_key synthetic_key(dht::token t) {
+    // Strategies only look at the key range of sstables, tokens alone order them.
+    return dht::decorated_key(t, partition_key::make_empty());
+}
+
+// Keeps track of the expected amount of unique data written, with a coarse
+// map of the ring. Writes are assumed to be uniformly distributed over the
+// data set, within the token range they span.
+class unique_data_tracker {
+    static constexpr size_t buckets = 1024;
+    uint64_t _dataset_size;
+    std::vector<double> _unique;
+public:
+    explicit unique_data_tracker(uint64_t dataset_size)
+        : _dataset_size(dataset_size)
+        , _unique(_dataset_size ? buckets : 1, 0.0)
+    { }
+
+    void add_write(uint64_t size, dht::token first, dht::token last) {
+        if (!_dataset_size) {
+            _unique.front() += size;
+            return;
+        }
+        const auto begin = ring_position(first);
+        const auto end = begin + ring_fraction(first, last);
+        const auto density = size / (end - begin);
+        const auto capacity = double(_dataset_size) / buckets;
+        for (auto b = size_t(begin * buckets); b < std::min(buckets, size_t(std::ceil(end * buckets))); ++b) {
+            const auto covered = std::min(end, double(b + 1) / buckets) - std::max(begin, double(b) / buckets);
+            const auto written = density * covered;
+            // What's written to the bucket overwrites the data it already has at the same rate it's full.
+            _unique[b] = std::min(capacity, _unique[b] + written * (1 - _unique[b] / capacity));
+        }
+    }
+
+    double unique_bytes() const {
+        return std::ranges::fold_left(_unique, 0.0, std::plus{});
+    }
+};
+
+class simulated_compaction_group_view : public compaction::compaction_group_view {
+    struct dummy_compaction_backlog_tracker : public compaction_backlog_tracker::impl {
+        virtual void replace_sstables(const std::vector<sstables::shared_sstable>& old_ssts, const std::vector<sstables::shared_sstable>& new_ssts) override { }
+        virtual double backlog(const compaction_backlog_tracker::ongoing_writes& ow, const compaction_backlog_tracker::ongoing_compactions& oc) const override { return 0.0; }
+    };
+
+    schema_ptr _schema;
+    sstables::sstables_manager& _sst_man;
+    mutable sstables::compaction_strategy _compaction_strategy;
+    compaction::compaction_strategy_state _compaction_strategy_state;
+    lw_shared_ptr<sstables::sstable_set> _main_set;
+    lw_shared_ptr<sstables::sstable_set> _maintenance_set;
+    std::vector<sstables::shared_sstable> _compacted_undeleted_sstables;
+    tombstone_gc_state _tombstone_gc_state;
+    compaction_backlog_tracker _backlog_tracker;
+    condition_variable _staging_done_condition;
+    mutable sstables::sstable_generation_generator _generation_generator;
+public:
+    simulated_compaction_group_view(schema_ptr schema, sstables::sstables_manager& sst_man, sstables::compaction_strategy cs)
+        : _schema(std::move(schema))
+        , _sst_man(sst_man)
+        , _compaction_strategy(std::move(cs))
+        , _compaction_strategy_state(compaction::compaction_strategy_state::make(_compaction_strategy))
+        , _maintenance_set(make_lw_shared<sstables::sstable_set>(sstables::make_partitioned_sstable_set(_schema, token_range())))
+        , _tombstone_gc_state(nullptr)
+        , _backlog_tracker(std::make_unique<dummy_compaction_backlog_tracker>())
+    {
+        _main_set = make_lw_shared<sstables::sstable_set>(_compaction_strategy.make_sstable_set(*this));
+    }
+
+    sstables::shared_sstable make_synthetic_sstable(uint64_t data_size, dht::token first, dht::token last,
+            api::timestamp_type min_timestamp, api::timestamp_type max_timestamp, uint32_t level, sstables::run_id run) const {
+        auto sst = make_sstable();
+        sstables::stats_metadata stats{};
+        stats.min_timestamp = min_timestamp;
+        stats.max_timestamp = max_timestamp;
+        stats.min_local_deletion_time = std::numeric_limits<int32_t>::max();
+        stats.max_local_deletion_time = std::numeric_limits<int32_t>::max();
+        stats.compression_ratio = 1.0;
+        stats.sstable_level = level;
+        sst->set_synthetic_metadata(data_size, synthetic_key(first), synthetic_key(last), std::move(stats), run);
+        return sst;
+    }
+
+    const sstables::sstable_set& main_set() const noexcept {
+        return *_main_set;
+    }
+
+    void replace_sstables(const std::vector<sstables::shared_sstable>& removed, const std::vector<sstables::shared_sstable>& added) {
+        for (auto& sst : removed) {
+            _main_set->erase(sst);
+        }
+        for (auto& sst : added) {
+            _main_set->insert(sst);
+        }
+    }
+
+    virtual dht::token_range token_range() const noexcept override { return dht::token_range::make(dht::first_token(), dht::last_token()); }
+    virtual const schema_ptr& schema() const noexcept override { return _schema; }
+    virtual unsigned min_compaction_threshold() const noexcept override { return _schema->min_compaction_threshold(); }
+    virtual bool compaction_enforce_min_threshold() const noexcept override { return true; }
+    virtual future<lw_shared_ptr<const sstables::sstable_set>> main_sstable_set() const override { return make_ready_future<lw_shared_ptr<const sstables::sstable_set>>(_main_set); }
+    virtual future<lw_shared_ptr<const sstables::sstable_set>> maintenance_sstable_set() const override { return make_ready_future<lw_shared_ptr<const sstables::sstable_set>>(_maintenance_set); }
+    virtual lw_shared_ptr<const sstables::sstable_set> sstable_set_for_tombstone_gc() const override { return _main_set; }
+    virtual std::unordered_set<sstables::shared_sstable> fully_expired_sstables(const std::vector<sstables::shared_sstable>& sstables, gc_clock::time_point compaction_time) const override { return {}; }
+    virtual const std::vector<sstables::shared_sstable>& compacted_undeleted_sstables() const noexcept override { return _compacted_undeleted_sstables; }
+    virtual sstables::compaction_strategy& get_compaction_strategy() const noexcept override { return _compaction_strategy; }
+    virtual compaction::compaction_strategy_state& get_compaction_strategy_state() noexcept override { return _compaction_strategy_state; }
+    virtual reader_permit make_compaction_reader_permit() const override { on_internal_error(simlog, "simulated compactions don't read sstables"); }
+    virtual sstables::sstables_manager& get_sstables_manager() noexcept override { return _sst_man; }
+    virtual sstables::shared_sstable make_sstable() const override {
+        // The sstable is never written, the directory is only there to give it a name.
+        return _sst_man.make_sstable(_schema, data_dictionary::make_local_options("compaction-simulator"), _generation_generator());
+    }
+    virtual sstables::sstable_writer_config configure_writer(sstring origin) const override { return _sst_man.configure_writer(std::move(origin)); }
+    virtual api::timestamp_type min_memtable_timestamp() const override { return api::max_timestamp; }
+    virtual api::timestamp_type min_memtable_live_timestamp() const override { return api::max_timestamp; }
+    virtual api::timestamp_type min_memtable_live_row_marker_timestamp() const override { return api::max_timestamp; }
+    virtual bool memtable_has_key(const dht::decorated_key& key) const override { return false; }
+    virtual future<> on_compaction_completion(sstables::compaction_completion_desc desc, sstables::offstrategy offstrategy) override { return make_ready_future<>(); }
+    virtual bool is_auto_compaction_disabled_by_user() const noexcept override { return false; }
+    virtual bool tombstone_gc_enabled() const noexcept override { return false; }
+    virtual const tombstone_gc_state& get_tombstone_gc_state() const noexcept override { return _tombstone_gc_state; }
+    virtual compaction_backlog_tracker& get_backlog_tracker() override { return _backlog_tracker; }
+    virtual const std::string get_group_id() const noexcept override { return "compaction-simulator"; }
+    virtual seastar::condition_variable& get_staging_done_condition() noexcept override { return _staging_done_condition; }
+    virtual dht::token_range get_token_range_after_split(const dht::token& t) const noexcept override { return dht::token_range(); }
+    virtual int64_t get_sstables_repaired_at() const noexcept override { return 0; }
+};
+
+// Compactions complete as soon as they are picked, so all sstables are
+// always candidates.
+class simulated_strategy_control : public compaction::strategy_control {
+public:
+    virtual bool has_ongoing_compaction(compaction::compaction_group_view& table_s) const noexcept override {
+        return false;
+    }
+    virtual future<std::vector<sstables::shared_sstable>> candidates(compaction::compaction_group_view& t) const override {
+        auto set = co_await t.main_sstable_set();
+        co_return *set->all() | std::ranges::to<std::vector>();
+    }
+    virtual future<std::vector<sstables::frozen_sstable_run>> candidates_as_runs(compaction::compaction_group_view& t) const override {
+        auto set = co_await t.main_sstable_set();
+        co_return set->all_sstable_runs();
+    }
+};
+
+class compaction_simulator {
+    const compaction_simulator_config& _cfg;
+    simulated_compaction_group_view _view;
+    simulated_strategy_control _control;
+    unique_data_tracker _unique_data;
+    compaction_simulator_sample _sample = {};
+private:
+    // Size of the union of the input sstables, assuming each input is
+    // uniformly spread over its own token range.
+    uint64_t merged_size(const std::vector<sstables::shared_sstable>& inputs, double output_fraction) const {
+        const auto input_size = std::ranges::fold_left(inputs | std::views::transform(std::mem_fn(&sstables::sstable::data_size)), uint64_t(0), std::plus{});
+        if (!_cfg.dataset_size) {
+            return input_size;
+        }
+        const auto output_dataset_size = _cfg.dataset_size * output_fraction;
+        double absent = 1.0;
+        for (const auto& sst : inputs) {
+            const auto fraction = ring_fraction(sst);
+            const auto coverage = std::min(1.0, fraction / output_fraction);
+            const auto density = std::min(1.0, sst->data_size() / (_cfg.dataset_size * fraction));
+            absent *= 1 - coverage * density;
+        }
+        return std::min(input_size, uint64_t(output_dataset_size * (1 - absent)));
+    }
+
+    std::vector<sstables::shared_sstable> compact(const sstables::compaction_descriptor& desc) {
+        auto first = std::ranges::min(desc.sstables | std::views::transform([] (const sstables::shared_sstable& sst) { return sst->get_first_decorated_key().token(); }));
+        auto last = std::ranges::max(desc.sstables | std::views::transform([] (const sstables::shared_sstable& sst) { return sst->get_last_decorated_key().token(); }));
+        auto min_timestamp = std::ranges::min(desc.sstables | std::views::transform([] (const sstables::shared_sstable& sst) { return sst->get_stats_metadata().min_timestamp; }));
+        auto max_timestamp = std::ranges::max(desc.sstables | std::views::transform([] (const sstables::shared_sstable& sst) { return sst->get_stats_metadata().max_timestamp; }));
+
+        const auto output_size = merged_size(desc.sstables, ring_fraction(first, last));
+        const auto first_token = uint64_t(dht::token::to_int64(first));
+        const auto token_span = uint64_t(dht::token::to_int64(last)) - first_token;
+        // Token at the given fraction of the span of the output, computed
+        // with unsigned arithmetic, which wraps around instead of overflowing.
+        auto token_at = [&] (double fraction) {
+            return first_token + uint64_t(token_span * fraction);
+        };
+        uint64_t outputs = desc.max_sstable_bytes == std::numeric_limits<uint64_t>::max() ? 1 : (output_size + desc.max_sstable_bytes - 1) / desc.max_sstable_bytes;
+        outputs = std::clamp<uint64_t>(outputs, 1, std::max<uint64_t>(token_span, 1));
+
+        std::vector<sstables::shared_sstable> ret;
+        ret.reserve(outputs);
+        for (uint64_t i = 0; i < outputs; ++i) {
+            auto output_first = dht::token::from_int64(int64_t(token_at(double(i) / outputs)));
+            auto output_last = i + 1 == outputs
+                    ? last
+                    : dht::token::from_int64(int64_t(token_at(double(i + 1) / outputs) - 1));
+            ret.push_back(_view.make_synthetic_sstable(output_size / outputs, output_first, output_last,
+                    min_timestamp, max_timestamp, desc.level, desc.run_identifier));
+        }
+        simlog.debug("Compacted {} sstable(s) of {} bytes into {} sstable(s) of {} bytes at level {}, spanning {}",
+                desc.sstables.size(), desc.sstables_size(), outputs, output_size, desc.level,
+                dht::token_range::make(ret.front()->get_first_decorated_key().token(), ret.back()->get_last_decorated_key().token()));
+        _sample.compactions++;
+        _sample.written_bytes += output_size;
+        return ret;
+    }
+
+    void compact_until_done(api::timestamp_type now) {
+        auto& cs = _view.get_compaction_strategy();
+        for (unsigned i = 0; i < max_compactions_per_flush; ++i) {
+            auto desc = cs.get_sstables_for_compaction(_view, _control).get();
+            if (desc.sstables.empty()) {
+                return;
+            }
+            auto outputs = compact(desc);
+            _view.replace_sstables(desc.sstables, outputs);
+            cs.notify_completion(_view, desc.sstables, outputs);
+        }
+        simlog.warn("Compaction strategy didn't run out of work after {} compactions at {}, moving on", max_compactions_per_flush, now);
+    }
+
+    compaction_simulator_sample take_sample(api::timestamp_type now) {
+        auto all = _view.main_set().all();
+        const auto unique_bytes = _unique_data.unique_bytes();
+        _sample.time = now;
+        _sample.sstables = all->size();
+        _sample.live_bytes = std::ranges::fold_left(*all | std::views::transform(std::mem_fn(&sstables::sstable::data_size)), uint64_t(0), std::plus{});
+        _sample.write_amplification = _sample.flushed_bytes ? double(_sample.written_bytes) / _sample.flushed_bytes : 0.0;
+        _sample.space_amplification = unique_bytes ? _sample.live_bytes / unique_bytes : 0.0;
+        _sample.sstables_per_read = std::ranges::fold_left(*all | std::views::transform([] (const sstables::shared_sstable& sst) { return ring_fraction(sst); }), 0.0, std::plus{});
+        return _sample;
+    }
+public:
+    compaction_simulator(schema_ptr schema, sstables::sstables_manager& sst_man, const compaction_simulator_config& cfg)
+        : _cfg(cfg)
+        , _view(std::move(schema), sst_man, sstables::make_compaction_strategy(cfg.strategy, cfg.strategy_options))
+        , _unique_data(cfg.dataset_size)
+    { }
+
+    std::vector<compaction_simulator_sample> run(std::vector<compaction_simulator_flush> flushes) {
+        std::ranges::sort(flushes, std::less{}, &compaction_simulator_flush::max_timestamp);
+        std::vector<compaction_simulator_sample> samples;
+        for (size_t i = 0; i < flushes.size(); ++i) {
+            const auto& f = flushes[i];
+            auto data_size = f.data_size;
+            if (_cfg.dataset_size) {
+                // A flush can't have more data than there is in its token range.
+                data_size = std::min(data_size, uint64_t(_cfg.dataset_size * ring_fraction(f.first, f.last)));
+            }
+            auto sst = _view.make_synthetic_sstable(data_size, f.first, f.last, f.min_timestamp, f.max_timestamp, 0, sstables::run_id::create_random_id());
+            _view.replace_sstables({}, {sst});
+            _unique_data.add_write(data_size, f.first, f.last);
+            _sample.flushes++;
+            _sample.flushed_bytes += data_size;
+            _sample.written_bytes += data_size;
+
+            compact_until_done(f.max_timestamp);
+
+            if ((i + 1) % std::max(_cfg.sample_interval, 1u) == 0 || i + 1 == flushes.size()) {
+                samples.push_back(take_sample(f.max_timestamp));
+            }
+        }
+        return samples;
+    }
+};
+
+} // anonymous namespace
+
+std::vector<compaction_simulator_sample> simulate_compaction(schema_ptr schema, sstables::sstables_manager& sst_man,
+        const compaction_simulator_config& cfg, std::vector<compaction_simulator_flush> flushes) {
+    return compaction_simulator(std::move(schema), sst_man, cfg).run(std::move(flushes));
+}
+
+} // namespace tools
@@ -0,0 +1,82 @@
+/*
+ * Copyright (C) 2026-present ScyllaDB
+ */
+
+/*
+ * SPDX-License-Identifier: LicenseRef-ScyllaDB-Source-Available-1.0
+ */
+
+#pragma once
+
+#include <map>
+#include <vector>
+#include <seastar/core/sstring.hh>
+
+#include "seastarx.hh"
+#include "compaction/compaction_strategy_type.hh"
+#include "dht/token.hh"
+#include "timestamp.hh"
+#include "schema/schema_fwd.hh"
+
+namespace sstables {
+class sstables_manager;
+}
+
+namespace tools {
+
+/// A write to the simulated table: a memtable flush of data_size bytes,
+/// spanning the [first, last] token range and [min_timestamp, max_timestamp].
+/// The flush happens at max_timestamp.
+struct compaction_simulator_flush {
+    uint64_t data_size;
+    dht::token first;
+    dht::token last;
+    api::timestamp_type min_timestamp;
+    api::timestamp_type max_timestamp;
+};
+
+struct compaction_simulator_config {
+    sstables::compaction_strategy_type strategy;
+    std::map<sstring, sstring> strategy_options;
+    /// Size of the data set the flushes write to. Writes are assumed to be
+    /// uniformly distributed over it, so merged sstables shrink as they
+    /// overwrite each other. 0 means an unbounded data set, i.e. inserts only.
+    uint64_t dataset_size = 0;
+    /// Take a sample every this many flushes. The last flush is always sampled.
+    unsigned sample_interval = 1;
+};
+
+/// The state of the simulated table, after a flush and the compactions it
+/// triggered.
+struct compaction_simulator_sample {
+    api::timestamp_type time;
+    uint64_t flushes;
+    uint64_t compactions;
+    /// Bytes written by flushes.
+    uint64_t flushed_bytes;
+    /// Bytes written by flushes and compactions.
+    uint64_t written_bytes;
+    uint64_t live_bytes;
+    size_t sstables;
+    /// written_bytes / flushed_bytes
+    double write_amplification;
+    /// live_bytes / the expected size of the unique data written so far
+    double space_amplification;
+    /// The expected number of sstables a read of a random partition has to
+    /// look at (before bloom filters).
+    double sstables_per_read;
+};
+
+/// Replays the flushes through the compaction strategy configured by /p cfg,
+/// compacting after each flush until the strategy has no more work.
+///
+/// Compactions are simulated by their effect on sstable metadata alone, no
+/// I/O is done. They complete instantly, so the strategy never sees
+/// ongoing compactions. Outputs are split at the size the strategy asks for,
+/// assuming data is uniformly distributed in the token range of the inputs.
+///
+/// Must be called from a seastar thread.
+std::vector<compaction_simulator_sample> simulate_compaction(schema_ptr schema, sstables::sstables_manager& sst_man,
+        const compaction_simulator_config& cfg, std::vector<compaction_simulator_flush> flushes);
+
+} // namespace tools
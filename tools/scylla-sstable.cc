@@ -22,6 +22,7 @@
 #include "init.hh"
 #include "compaction/compaction.hh"
 #include "compaction/compaction_strategy.hh"
+#include "compaction/compaction_strategy_impl.hh"
 #include "compaction/compaction_strategy_state.hh"
 #include "cql3/type_json.hh"
 #include "cql3/statements/raw/parsed_statement.hh"
@@ -40,6 +41,7 @@
 #include "sstables/open_info.hh"
 #include "replica/schema_describe_helper.hh"
 #include "test/lib/cql_test_env.hh"
+#include "tools/compaction_simulator.hh"
 #include "tools/json_writer.hh"
 #include "tools/load_system_tablets.hh"
 #include "tools/lua_sstable_consumer.hh"
@@ -1498,6 +1500,8 @@ const char* to_string(sstables::scylla_metadata_type t) {
         case sstables::scylla_metadata_type::ScyllaBuildId: return "scylla_build_id";
         case sstables::scylla_metadata_type::ExtTimestampStats: return "ext_timestamp_stats";
         case sstables::scylla_metadata_type::SSTableIdentifier: return "sstable_identifier";
+        case sstables::scylla_metadata_type::ClusteringFilter: return "clustering_filter";
+        case sstables::scylla_metadata_type::ColumnZoneMaps: return "column_zone_maps";
     }
     std::abort();
 }
@@ -1523,9 +1527,10 @@ const char* to_string(sstables::ext_timestamp_stats_type t) {
 
 class scylla_metadata_visitor {
     json_writer& _writer;
+    const schema& _schema;
 
 public:
-    scylla_metadata_visitor(json_writer& writer) : _writer(writer) { }
+    scylla_metadata_visitor(json_writer& writer, const schema& s) : _writer(writer), _schema(s) { }
 
     void operator()(const sstables::sharding_metadata& val) const {
         _writer.StartArray();
@@ -1561,6 +1566,7 @@ class scylla_metadata_visitor {
                 {sstables::sstable_feature::CorrectEmptyCounters, "CorrectEmptyCounters"},
                 {sstables::sstable_feature::CorrectUDTsInCollections, "CorrectUDTsInCollections"},
                 {sstables::sstable_feature::CorrectLastPiBlockWidth, "CorrectLastPiBlockWidth"},
+                {sstables::sstable_feature::SplitBlockFilter, "SplitBlockFilter"},
         };
         _writer.StartObject();
         _writer.Key("mask");
@@ -1623,6 +1629,35 @@ class scylla_metadata_visitor {
     void operator()(const sstables::scylla_metadata::sstable_identifier& sid) const {
         _writer.AsString(sid.value);
     }
+
+    void operator()(const sstables::scylla_metadata::clustering_filter& val) const {
+        _writer.StartObject();
+        _writer.Key("bucket_width");
+        _writer.Int64(val.bucket_width);
+        _writer.EndObject();
+    }
+
+    void operator()(const sstables::scylla_metadata::column_zone_maps& val) const {
+        _writer.StartObject();
+        for (const auto& zm : val.elements) {
+            const auto* cdef = _schema.get_column_definition(zm.column_name.value);
+            auto value_to_string = [&] (const bytes& v) {
+                return cdef && zm.value_count ? cdef->type->to_string(v) : to_hex(v);
+            };
+            _writer.Key(disk_string_to_string(zm.column_name));
+            _writer.StartObject();
+            _writer.Key("min");
+            _writer.String(value_to_string(zm.min.value));
+            _writer.Key("max");
+            _writer.String(value_to_string(zm.max.value));
+            _writer.Key("value_count");
+            _writer.Uint64(zm.value_count);
+            _writer.Key("null_count");
+            _writer.Uint64(zm.null_count);
+            _writer.EndObject();
+        }
+        _writer.EndObject();
+    }
 };
 
 void dump_scylla_metadata_operation(schema_ptr schema, reader_permit permit, const std::vector<sstables::shared_sstable>& sstables,
@@ -1642,7 +1677,7 @@ void dump_scylla_metadata_operation(schema_ptr schema, reader_permit permit, con
             continue;
         }
         for (const auto& [k, v] : m->data.data) {
-            std::visit(scylla_metadata_visitor(writer), v);
+            std::visit(scylla_metadata_visitor(writer, *schema), v);
         }
         writer.EndObject();
     }
@@ -3048,6 +3083,108 @@ void query_operation(schema_ptr sstable_schema, reader_permit permit, const std:
     }, {});
 }
 
+// Flushes of a synthetic write workload, the last one happening now.
+std::vector<tools::compaction_simulator_flush> make_synthetic_flushes(const bpo::variables_map& vm) {
+    const auto flush_count = vm["flushes"].as<uint64_t>();
+    const auto flush_size = vm["flush-size-mb"].as<uint64_t>() * 1024 * 1024;
+    const auto flush_interval = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::seconds(vm["flush-interval-s"].as<uint64_t>())).count();
+    const auto key_distribution = vm["key-distribution"].as<std::string>();
+    if (key_distribution != "uniform" && key_distribution != "sequential") {
+        throw std::invalid_argument(fmt::format("invalid value for --key-distribution: {}, expected one of (uniform, sequential)", key_distribution));
+    }
+    if (!flush_count || !flush_size) {
+        throw std::invalid_argument("--flushes and --flush-size-mb must be positive");
+    }
+
+    const auto first = uint64_t(dht::token::to_int64(dht::first_token()));
+    const auto span = uint64_t(dht::token::to_int64(dht::last_token())) - first;
+    const auto now = api::new_timestamp();
+    std::vector<tools::compaction_simulator_flush> flushes;
+    flushes.reserve(flush_count);
+    for (uint64_t i = 0; i < flush_count; ++i) {
+        const auto end = now - api::timestamp_type(flush_count - i - 1) * flush_interval;
+        auto& f = flushes.emplace_back(flush_size, dht::first_token(), dht::last_token(), end - flush_interval, end);
+        if (key_distribution == "sequential") {
+            // Each flush covers the next slice of the ring.
+            f.first = dht::token::from_int64(int64_t(first + uint64_t(span * (double(i) / flush_count))));
+            f.last = dht::token::from_int64(int64_t(first + uint64_t(span * (double(i + 1) / flush_count)) - 1));
+        }
+    }
+    return flushes;
+}
+
+void simulate_compaction_operation(schema_ptr schema, reader_permit permit, const std::vector<sstables::shared_sstable>& sstables,
+        sstables::sstables_manager& sst_man, const bpo::variables_map& vm) {
+    tools::compaction_simulator_config cfg{
+        .strategy = schema->compaction_strategy(),
+        .strategy_options = schema->compaction_strategy_options(),
+        .dataset_size = vm["dataset-size-mb"].as<uint64_t>() * 1024 * 1024,
+        .sample_interval = vm["sample-interval"].as<unsigned>(),
+    };
+    if (vm.contains("compaction-strategy")) {
+        cfg.strategy = sstables::compaction_strategy::type(vm["compaction-strategy"].as<std::string>());
+        cfg.strategy_options.clear();
+    }
+    for (const auto& [key, value] : vm["compaction-strategy-option"].as<program_options::string_map>()) {
+        cfg.strategy_options[key] = value;
+    }
+    sstables::compaction_strategy_impl::validate_options_for_strategy_type(cfg.strategy_options, cfg.strategy);
+
+    std::vector<tools::compaction_simulator_flush> flushes;
+    if (sstables.empty()) {
+        flushes = make_synthetic_flushes(vm);
+    } else {
+        // The sstables are replayed as if they were flushed in the order they were written.
+        flushes = sstables | std::views::transform([] (const sstables::shared_sstable& sst) {
+            const auto& stats = sst->get_stats_metadata();
+            return tools::compaction_simulator_flush{sst->data_size(), sst->get_first_decorated_key().token(), sst->get_last_decorated_key().token(),
+                    stats.min_timestamp, stats.max_timestamp};
+        }) | std::ranges::to<std::vector>();
+    }
+
+    const auto samples = tools::simulate_compaction(schema, sst_man, cfg, std::move(flushes));
+
+    json_writer writer;
+    writer.StartObject();
+    writer.Key("compaction_strategy");
+    writer.String(sstables::compaction_strategy::name(cfg.strategy));
+    writer.Key("compaction_strategy_options");
+    writer.StartObject();
+    for (const auto& [key, value] : cfg.strategy_options) {
+        writer.Key(key);
+        writer.String(value);
+    }
+    writer.EndObject();
+    writer.Key("samples");
+    writer.StartArray();
+    for (const auto& sample : samples) {
+        writer.StartObject();
+        writer.Key("timestamp");
+        writer.Int64(sample.time);
+        writer.Key("flushes");
+        writer.Uint64(sample.flushes);
+        writer.Key("compactions");
+        writer.Uint64(sample.compactions);
+        writer.Key("flushed_bytes");
+        writer.Uint64(sample.flushed_bytes);
+        writer.Key("written_bytes");
+        writer.Uint64(sample.written_bytes);
+        writer.Key("live_bytes");
+        writer.Uint64(sample.live_bytes);
+        writer.Key("sstables");
+        writer.Uint64(sample.sstables);
+        writer.Key("write_amplification");
+        writer.Double(sample.write_amplification);
+        writer.Key("space_amplification");
+        writer.Double(sample.space_amplification);
+        writer.Key("sstables_per_read");
+        writer.Double(sample.sstables_per_read);
+        writer.EndObject();
+    }
+    writer.EndArray();
+    writer.EndObject();
+}
+
 const std::vector<operation_option> global_options {
     typed_option<sstring>("schema-file", "schema.cql", "use the file containing the schema description as the schema source"),
     typed_option<sstring>("keyspace", "keyspace name"),
@@ -3360,6 +3497,67 @@ for more information on this operation, including usage examples.
                 typed_option<std::string>("output-format", "text", "the output-format, one of (text, json)"),
             }},
             query_operation},
+/* simulate-compaction */
+    {{"simulate-compaction",
+            "Simulate compaction of a write workload, to predict its amplification",
+R"(
+Replay a write workload through a compaction strategy, without doing any I/O,
+and report write amplification, space amplification and the number of sstables
+a read has to look at, over the simulated time.
+
+The workload is either the input sstables, replayed as if they were flushed
+in the order they were written, or a synthetic one: --flushes flushes of
+--flush-size-mb each, --flush-interval-s apart, the last happening now. With
+--key-distribution=uniform each flush spans the whole ring, with sequential
+each flush covers the next slice of the ring.
+
+The compaction strategy and its options are those of the schema, unless
+overridden with --compaction-strategy and --compaction-strategy-option.
+
+Compactions are simulated by their effect on sstable metadata alone:
+* they are done as soon as the strategy asks for them, so the strategy never
+  sees ongoing compactions;
+* their output is the union of the inputs, assuming writes are uniformly
+  distributed over a data set of --dataset-size-mb (by default unbounded,
+  i.e. writes are inserts, never overwriting each other);
+* data never expires and tombstones are never purged.
+
+The output is JSON, with a sample of the state of the table every
+--sample-interval flushes:
+
+$ROOT := {
+    "compaction_strategy": String,
+    "compaction_strategy_options": {"$key": String, ...},
+    "samples": [$SAMPLE, ...]
+}
+
+$SAMPLE := {
+    "timestamp": Int64, // write timestamp of the last flush
+    "flushes": Uint64,
+    "compactions": Uint64,
+    "flushed_bytes": Uint64,
+    "written_bytes": Uint64, // by flushes and compactions
+    "live_bytes": Uint64,
+    "sstables": Uint64,
+    "write_amplification": Double, // written_bytes / flushed_bytes
+    "space_amplification": Double, // live_bytes / expected size of the unique data
+    "sstables_per_read": Double // expected number of sstables spanning a random token
+}
+
+See https://docs.scylladb.com/operating-scylla/admin-tools/scylla-sstable#simulate-compaction
+for more information on this operation.
+)",
+            {
+                typed_option<std::string>("compaction-strategy", "the compaction strategy to simulate, instead of that of the schema"),
+                typed_option<program_options::string_map>("compaction-strategy-option", {}, "option(s) of the compaction strategy, overriding those of the schema"),
+                typed_option<uint64_t>("dataset-size-mb", 0, "size of the data set written to, 0 for unbounded (inserts only)"),
+                typed_option<unsigned>("sample-interval", 1u, "report the state of the table every this many flushes"),
+                typed_option<uint64_t>("flushes", 1000, "number of flushes of the synthetic workload"),
+                typed_option<uint64_t>("flush-size-mb", 64, "size of the flushes of the synthetic workload"),
+                typed_option<uint64_t>("flush-interval-s", 60, "interval between the flushes of the synthetic workload"),
+                typed_option<std::string>("key-distribution", "uniform", "key distribution of the synthetic workload, one of (uniform, sequential)"),
+            }},
+            simulate_compaction_operation},
 };
 
 } // anonymous namespace
@@ -15,10 +15,23 @@
 #include <seastar/core/loop.hh>
 #include "utils/large_bitset.hh"
 #include <array>
+#include <bit>
+#include <cmath>
 #include <cstdlib>
 #include "utils/bloom_calculations.hh"
 #include "bloom_filter.hh"
 
+#ifdef __x86_64__
+#include <x86intrin.h>
+#define arch_target(name) [[gnu::target(name)]]
+#else
+#define arch_target(name)
+#endif
+
+#if defined(__aarch64__)
+#include <arm_neon.h>
+#endif
+
 namespace utils {
 namespace filter {
 
@@ -72,18 +85,141 @@ bool bloom_filter::is_present(const bytes_view& key) {
     return is_present(make_hashed_key(key));
 }
 
+// Each 32-bit word of a block gets the bit selected by the top 5 bits of the key multiplied by the word's salt.
+alignas(32) static constexpr uint32_t split_block_salt[8] = {
+    0x47b6137bU, 0x44974d91U, 0x8824ad5bU, 0xa2b7289dU,
+    0x705495c7U, 0x2df1424bU, 0x9efc4947U, 0x5c6bfb31U,
+};
+
+// The words of a block are stored as uint64_t pairs. Viewing them as uint32_t
+// relies on the host being little endian, which is also what makes the layout
+// of Filter.db the same on all supported architectures.
+static_assert(std::endian::native == std::endian::little);
+
+static inline uint32_t split_block_mask(uint32_t key, unsigned word) {
+    return uint32_t(1) << ((key * split_block_salt[word]) >> 27);
+}
+
+#if defined(__aarch64__)
+
+bool split_block_test(const uint64_t* block, uint32_t key) {
+    auto k = vdupq_n_u32(key);
+    auto one = vdupq_n_u32(1);
+    auto words = reinterpret_cast<const uint32_t*>(block);
+    auto lo = vshlq_u32(one, vreinterpretq_s32_u32(vshrq_n_u32(vmulq_u32(k, vld1q_u32(split_block_salt)), 27)));
+    auto hi = vshlq_u32(one, vreinterpretq_s32_u32(vshrq_n_u32(vmulq_u32(k, vld1q_u32(split_block_salt + 4)), 27)));
+    // Bits of the mask which are not set in the block.
+    auto missing = vorrq_u32(vbicq_u32(lo, vld1q_u32(words)), vbicq_u32(hi, vld1q_u32(words + 4)));
+    return vmaxvq_u32(missing) == 0;
+}
+
+#else
+
+arch_target("default") bool split_block_test(const uint64_t* block, uint32_t key) {
+    auto words = reinterpret_cast<const uint32_t*>(block);
+    for (unsigned i = 0; i < 8; ++i) {
+        auto mask = split_block_mask(key, i);
+        if ((words[i] & mask) != mask) {
+            return false;
+        }
+    }
+    return true;
+}
+
+#endif
+
+#ifdef __x86_64__
+
+arch_target("avx2") bool split_block_test(const uint64_t* block, uint32_t key) {
+    auto k = _mm256_set1_epi32(key);
+    auto shifts = _mm256_srli_epi32(_mm256_mullo_epi32(k, _mm256_load_si256(reinterpret_cast<const __m256i*>(split_block_salt))), 27);
+    auto mask = _mm256_sllv_epi32(_mm256_set1_epi32(1), shifts);
+    auto b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(block));
+    // Sets the carry flag iff (~b & mask) == 0.
+    return _mm256_testc_si256(b, mask);
+}
+
+#endif
+
+split_block_bloom_filter::split_block_bloom_filter(bitmap&& bs, filter_format format)
+    : bloom_filter(0, std::move(bs), format)
+    , _nr_blocks(_bitset.size() / block_bits)
+{
+    if (!_nr_blocks || _bitset.size() % block_bits) {
+        throw std::invalid_argument(fmt::format("Invalid split-block bloom filter size: {} bits", _bitset.size()));
+    }
+}
+
+size_t split_block_bloom_filter::block_of(const hashed_key& key) const noexcept {
+    // Maps the hash uniformly to [0, _nr_blocks) without a division.
+    return (static_cast<unsigned __int128>(key.hash()[0]) * _nr_blocks) >> 64;
+}
+
+void split_block_bloom_filter::add(const bytes_view& key) {
+    add(make_hashed_key(key));
+}
+
+void split_block_bloom_filter::add(const hashed_key& hk) {
+    auto block = block_of(hk) * words_per_block;
+    auto k = uint32_t(hk.hash()[1]);
+    for (unsigned i = 0; i < 8; ++i) {
+        // Word i is the lower (even i) or upper (odd i) half of the i/2-th uint64_t of the block.
+        _bitset.set(block * 64 + i * 32 + std::countr_zero(split_block_mask(k, i)));
+    }
+}
+
+bool split_block_bloom_filter::is_present(hashed_key key) {
+    // Blocks never straddle chunks of the bitset's storage, so their words are contiguous.
+    static_assert(utils::chunked_vector<uint64_t>::max_chunk_capacity() % words_per_block == 0);
+    auto block = &_bitset.get_storage()[block_of(key) * words_per_block];
+    return split_block_test(block, uint32_t(key.hash()[1]));
+}
+
+// The probability of a false positive in a split-block filter with given number of bits per element.
+//
+// The number of elements in a block follows the Poisson distribution. With i elements in a block,
+// each bit checked by a probe is set with probability 1 - (1 - 1/32)^i.
+static double split_block_false_positive_rate(double bits_per_element) {
+    const double lambda = split_block_bloom_filter::block_bits / bits_per_element;
+    double p = std::exp(-lambda);
+    double fpr = 0;
+    for (unsigned i = 0; i < 4 * lambda + 100; ++i) {
+        fpr += p * std::pow(1 - std::pow(1 - 1.0 / 32, i), 8);
+        p *= lambda / (i + 1);
+    }
+    return fpr;
+}
+
+size_t get_split_block_bitset_size(int64_t num_elements, double max_false_pos_prob) {
+    // Beyond this, the filter is bigger than the data it is supposed to save reads of.
+    static constexpr double max_bits_per_element = 64;
+    double bits_per_element = 1;
+    while (bits_per_element < max_bits_per_element && split_block_false_positive_rate(bits_per_element) > max_false_pos_prob) {
+        bits_per_element += 0.5;
+    }
+    auto num_bits = std::max<int64_t>(std::ceil(num_elements * bits_per_element), 1);
+    return align_up<int64_t>(num_bits, split_block_bloom_filter::block_bits);
+}
+
 size_t get_bitset_size(int64_t num_elements, int buckets_per) {
     int64_t num_bits = (num_elements * buckets_per) + bloom_calculations::EXCESS;
     num_bits = align_up<int64_t>(num_bits, 64);  // Seems to be implied in origin
     return num_bits;
 }
 
-filter_ptr create_filter(int hash, large_bitset&& bitset, filter_format format) {
+filter_ptr create_filter(int hash, large_bitset&& bitset, filter_format format, filter_layout layout) {
+    if (layout == filter_layout::split_block) {
+        return std::make_unique<split_block_bloom_filter>(std::move(bitset), format);
+    }
     return std::make_unique<murmur3_bloom_filter>(hash, std::move(bitset), format);
 }
 
 filter_ptr create_filter(int hash, int64_t num_elements, int buckets_per, filter_format format) {
     return std::make_unique<murmur3_bloom_filter>(hash, large_bitset(get_bitset_size(num_elements, buckets_per)), format);
 }
+
+filter_ptr create_split_block_filter(int64_t num_elements, double max_false_pos_prob, filter_format format) {
+    return std::make_unique<split_block_bloom_filter>(large_bitset(get_split_block_bitset_size(num_elements, max_false_pos_prob)), format);
+}
 }
 }
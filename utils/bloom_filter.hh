@@ -21,8 +21,9 @@ class bloom_filter: public i_filter {
 public:
     using bitmap = large_bitset;
 
-private:
+protected:
     bitmap _bitset;
+private:
     int _hash_count;
     filter_format _format;
 
@@ -66,6 +67,40 @@ struct murmur3_bloom_filter: public bloom_filter {
     {}
 };
 
+// A split-block Bloom filter (Putze et al., "Cache-, Hash- and Space-Efficient
+// Bloom Filters").
+//
+// The bitset is divided into blocks of 256 bits, i.e. half of a cache line.
+// A key selects a single block and sets one bit in each of its eight 32-bit
+// words, so a probe touches one cache line rather than num_hashes() random
+// ones, and checks all eight words at once with AVX2 or NEON where available.
+// For the same false positive rate, it needs somewhat more memory than
+// the classic layout.
+//
+// The bitset is stored in Filter.db like that of the classic layout, with
+// the number of hashes set to 0, so that versions which don't know the layout
+// treat the filter as always present instead of returning false negatives.
+// The layout itself is recorded in the sstable's features.
+class split_block_bloom_filter : public bloom_filter {
+public:
+    static constexpr size_t block_bits = 256;
+    static constexpr size_t words_per_block = block_bits / 64;
+private:
+    size_t _nr_blocks;
+
+    size_t block_of(const hashed_key& key) const noexcept;
+public:
+    split_block_bloom_filter(bitmap&& bs, filter_format format);
+
+    using bloom_filter::is_present;
+
+    virtual void add(const bytes_view& key) override;
+
+    void add(const hashed_key& key);
+
+    virtual bool is_present(hashed_key key) override;
+};
+
 struct always_present_filter: public i_filter {
 
     virtual bool is_present(const bytes_view& key) override {
@@ -90,7 +125,11 @@ struct always_present_filter: public i_filter {
 // Get the size of the bitset (in bits, not bytes) for the specific parameters.
 size_t get_bitset_size(int64_t num_elements, int buckets_per);
 
-filter_ptr create_filter(int hash, large_bitset&& bitset, filter_format format);
+// Get the size of the bitset (in bits, not bytes) of a split-block filter for the specific parameters.
+size_t get_split_block_bitset_size(int64_t num_elements, double max_false_pos_prob);
+
+filter_ptr create_filter(int hash, large_bitset&& bitset, filter_format format, filter_layout layout = filter_layout::classic);
 filter_ptr create_filter(int hash, int64_t num_elements, int buckets_per, filter_format format);
+filter_ptr create_split_block_filter(int64_t num_elements, double max_false_pos_prob, filter_format format);
 }
 }
@@ -0,0 +1,116 @@
+/*
+ * Copyright (C) 2026-present ScyllaDB
+ */
+
+/*
+ * SPDX-License-Identifier: LicenseRef-ScyllaDB-Source-Available-1.0
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <vector>
+
+namespace utils {
+
+// Approximate, bounded-memory access frequency estimator.
+//
+// This is the count-min sketch variant used by the TinyLFU admission policy:
+// each key is mapped to `hash_count` 4-bit saturating counters, and the estimate
+// is the minimum of them. To make the sketch reflect recent popularity rather
+// than all-time popularity, all counters are halved once the number of recorded
+// accesses reaches the sample size ("aging").
+//
+// Keys are given as already-hashed 64-bit values. The sketch never allocates
+// after construction.
+class frequency_sketch {
+public:
+    static constexpr unsigned max_frequency = 15;
+private:
+    static constexpr unsigned hash_count = 4;
+    static constexpr unsigned counters_per_word = 16;
+    static constexpr uint64_t reset_mask = 0x7777777777777777ull;
+
+    std::vector<uint64_t> _table;
+    uint64_t _word_mask;
+    uint64_t _sample_size;
+    uint64_t _additions = 0;
+    uint64_t _resets = 0;
+private:
+    static uint64_t rehash(uint64_t h, unsigned i) noexcept {
+        static constexpr uint64_t seeds[hash_count] = {
+            0xc3a5c85c97cb3127ull, 0xb492b66fbe98f273ull, 0x9ae16a3b2f90404full, 0xcbf29ce484222325ull,
+        };
+        h = (h ^ seeds[i]) * 0x9e3779b97f4a7c15ull;
+        return h ^ (h >> 29);
+    }
+
+    struct slot {
+        uint64_t& word;
+        unsigned shift;
+    };
+
+    slot slot_for(uint64_t hash, unsigned i) noexcept {
+        auto h = rehash(hash, i);
+        return {_table[(h >> 4) & _word_mask], unsigned(h & (counters_per_word - 1)) * 4};
+    }
+
+    unsigned counter_at(uint64_t hash, unsigned i) const noexcept {
+        auto h = rehash(hash, i);
+        return (_table[(h >> 4) & _word_mask] >> (unsigned(h & (counters_per_word - 1)) * 4)) & 0xf;
+    }
+public:
+    // Creates a sketch with at least `counters` counters (rounded up to a power of two words).
+    // The sketch is aged after `sample_size` accesses; by default ten times the
+    // number of counters, which is what TinyLFU recommends.
+    explicit frequency_sketch(size_t counters, uint64_t sample_size = 0)
+        : _table(std::bit_ceil(std::max<size_t>(counters / counters_per_word, 1)))
+        , _word_mask(_table.size() - 1)
+        , _sample_size(sample_size ? sample_size : _table.size() * counters_per_word * 10)
+    { }
+
+    // Returns the estimated number of recorded accesses for the key, capped at max_frequency.
+    unsigned estimate(uint64_t hash) const noexcept {
+        unsigned freq = max_frequency;
+        for (unsigned i = 0; i < hash_count; ++i) {
+            freq = std::min(freq, counter_at(hash, i));
+        }
+        return freq;
+    }
+
+    // Records an access to the key.
+    void increment(uint64_t hash) noexcept {
+        bool added = false;
+        for (unsigned i = 0; i < hash_count; ++i) {
+            auto s = slot_for(hash, i);
+            if (((s.word >> s.shift) & 0xf) < max_frequency) {
+                s.word += uint64_t(1) << s.shift;
+                added = true;
+            }
+        }
+        if (added && ++_additions >= _sample_size) {
+            reset();
+        }
+    }
+
+    // Halves all counters.
+    void reset() noexcept {
+        for (auto& w : _table) {
+            w = (w >> 1) & reset_mask;
+        }
+        _additions /= 2;
+        ++_resets;
+    }
+
+    void clear() noexcept {
+        std::fill(_table.begin(), _table.end(), 0);
+        _additions = 0;
+    }
+
+    size_t memory_usage() const noexcept { return _table.size() * sizeof(uint64_t); }
+    uint64_t resets() const noexcept { return _resets; }
+};
+
+} // namespace utils
@@ -17,7 +17,7 @@
 namespace utils {
 static logging::logger filterlog("bloom_filter");
 
-filter_ptr i_filter::get_filter(int64_t num_elements, double max_false_pos_probability, filter_format fformat) {
+filter_ptr i_filter::get_filter(int64_t num_elements, double max_false_pos_probability, filter_format fformat, filter_layout layout) {
     SCYLLA_ASSERT(seastar::thread::running_in_thread());
 
     if (max_false_pos_probability > 1.0) {
@@ -28,16 +28,24 @@ filter_ptr i_filter::get_filter(int64_t num_elements, double max_false_pos_proba
         return std::make_unique<filter::always_present_filter>();
     }
 
+    if (layout == filter_layout::split_block) {
+        return filter::create_split_block_filter(num_elements, max_false_pos_probability, fformat);
+    }
+
     int buckets_per_element = bloom_calculations::max_buckets_per_element(num_elements);
     auto spec = bloom_calculations::compute_bloom_spec(buckets_per_element, max_false_pos_probability);
     return filter::create_filter(spec.K, num_elements, spec.buckets_per_element, fformat);
 }
 
-size_t i_filter::get_filter_size(int64_t num_elements, double max_false_pos_probability) {
+size_t i_filter::get_filter_size(int64_t num_elements, double max_false_pos_probability, filter_layout layout) {
     if (max_false_pos_probability >= 1.0) {
         return 0;
     }
 
+    if (layout == filter_layout::split_block) {
+        return filter::get_split_block_bitset_size(num_elements, max_false_pos_probability) / 8;
+    }
+
     int buckets_per_element = bloom_calculations::max_buckets_per_element(num_elements);
     auto spec = bloom_calculations::compute_bloom_spec(buckets_per_element, max_false_pos_probability);
 
@@ -22,6 +22,14 @@ enum class filter_format {
     m_format,
 };
 
+// How the bits of a key are spread over the filter's bitset.
+enum class filter_layout {
+    // k bits anywhere in the bitset.
+    classic,
+    // 8 bits within a single 256-bit block, see filter::split_block_bloom_filter.
+    split_block,
+};
+
 class hashed_key {
 private:
     std::array<uint64_t, 2> _hash;
@@ -52,11 +60,13 @@ struct i_filter {
      *         Asserts that the given probability can be satisfied using this
      *         filter.
      */
-    static filter_ptr get_filter(int64_t num_elements, double max_false_pos_prob, filter_format format);
+    static filter_ptr get_filter(int64_t num_elements, double max_false_pos_prob, filter_format format,
+            filter_layout layout = filter_layout::classic);
 
     /**
      * @return the size of the smallest filter (in bytes), according to the conditions described at get_filter()
      */
-    static size_t get_filter_size(int64_t num_elements, double max_false_pos_prob);
+    static size_t get_filter_size(int64_t num_elements, double max_false_pos_prob,
+            filter_layout layout = filter_layout::classic);
 };
 }
@@ -734,18 +734,20 @@ class segment_store_backend {
     uintptr_t _segments_base;
 
 public:
-    explicit segment_store_backend(memory::memory_layout layout, bool freed_segment_increases_general_memory_availability) noexcept
+    explicit segment_store_backend(memory::memory_layout layout, bool freed_segment_increases_general_memory_availability, size_t alignment = segment::size) noexcept
         : _layout(layout)
         , _freed_segment_increases_general_memory_availability(freed_segment_increases_general_memory_availability)
-        , _segments_base(align_up(_layout.start, static_cast<uintptr_t>(segment::size)))
+        , _segments_base(align_up(_layout.start, static_cast<uintptr_t>(alignment)))
     { }
     virtual ~segment_store_backend() = default;
     memory::memory_layout memory_layout() const noexcept { return _layout; }
     uintptr_t segments_base() const noexcept { return _segments_base; }
     virtual void* alloc_segment_memory() noexcept = 0;
-    virtual void free_segment_memory(void* seg) noexcept = 0;
+    // Returns the amount of memory given back, which is 0 when the segment
+    // is kept until the rest of its release unit is freed.
+    virtual size_t free_segment_memory(void* seg) noexcept = 0;
     virtual size_t free_memory() const noexcept = 0;
-    bool can_allocate_more_segments(size_t non_lsa_reserve) const noexcept {
+    virtual bool can_allocate_more_segments(size_t non_lsa_reserve) const noexcept {
         if (_freed_segment_increases_general_memory_availability) {
             return free_memory() >= non_lsa_reserve + segment::size;
         } else {
@@ -765,8 +767,9 @@ class seastar_memory_segment_store_backend : public segment_store_backend {
     virtual void* alloc_segment_memory() noexcept override {
         return aligned_alloc(segment::size, segment::size);
     }
-    virtual void free_segment_memory(void* seg) noexcept override {
+    virtual size_t free_segment_memory(void* seg) noexcept override {
         ::free(seg);
+        return segment::size;
     }
     virtual size_t free_memory() const noexcept override {
         return memory::free_memory();
@@ -821,18 +824,98 @@ class standard_memory_segment_store_backend : public segment_store_backend {
         --_available_segments;
         return reinterpret_cast<void*>(seg);
     }
-    virtual void free_segment_memory(void* seg) noexcept override {
+    virtual size_t free_segment_memory(void* seg) noexcept override {
         unpoison(reinterpret_cast<char*>(seg), sizeof(free_segment));
         auto fs = new (seg) free_segment;
         fs->next = _freelist;
         _freelist = fs;
         ++_available_segments;
+        return segment_size;
     }
     virtual size_t free_memory() const noexcept override {
         return _available_segments * segment_size;
     }
 };
 
+// Segments are allocated from the seastar allocator, in huge page sized and aligned chunks.
+//
+// This allows the kernel to map LSA memory with transparent huge pages (and
+// keeps segments of the same huge page together when seastar memory is
+// backed by hugetlbfs), which reduces TLB misses on workloads dominated by
+// lookups in LSA memory, like row cache reads.
+// A chunk is returned to the seastar allocator only when all of its segments
+// are freed, so only whole chunks count as reclaimed memory.
+class huge_page_segment_store_backend : public segment_store_backend {
+public:
+    static constexpr size_t huge_page_size = 2 * 1024 * 1024;
+    static constexpr size_t segments_per_huge_page = huge_page_size / segment::size;
+private:
+    // Segments of allocated chunks which are not handed out.
+    utils::dynamic_bitset _free_segments;
+    size_t _nr_free_segments = 0;
+    // Number of handed out segments in each chunk.
+    std::vector<uint8_t> _used_segments;
+
+    size_t idx_of(const void* seg) const noexcept {
+        return (reinterpret_cast<uintptr_t>(seg) - _segments_base) / segment::size;
+    }
+    void* segment_at(size_t idx) const noexcept {
+        return reinterpret_cast<void*>(_segments_base + idx * segment::size);
+    }
+public:
+    huge_page_segment_store_backend()
+        : segment_store_backend(memory::get_memory_layout(), true, huge_page_size)
+        , _free_segments((_layout.end - _segments_base) / segment::size)
+        , _used_segments((_layout.end - _segments_base) / huge_page_size)
+    { }
+    virtual void* alloc_segment_memory() noexcept override {
+        if (_nr_free_segments) {
+            auto idx = _free_segments.find_last_set();
+            _free_segments.clear(idx);
+            --_nr_free_segments;
+            ++_used_segments[idx / segments_per_huge_page];
+            return segment_at(idx);
+        }
+        auto p = aligned_alloc(huge_page_size, huge_page_size);
+        if (!p) {
+            return nullptr;
+        }
+        // A no-op when seastar memory is backed by hugetlbfs.
+        madvise(p, huge_page_size, MADV_HUGEPAGE);
+        auto first = idx_of(p);
+        for (size_t i = 1; i < segments_per_huge_page; ++i) {
+            _free_segments.set(first + i);
+        }
+        _nr_free_segments += segments_per_huge_page - 1;
+        _used_segments[first / segments_per_huge_page] = 1;
+        return p;
+    }
+    virtual size_t free_segment_memory(void* seg) noexcept override {
+        auto idx = idx_of(seg);
+        if (--_used_segments[idx / segments_per_huge_page]) {
+            _free_segments.set(idx);
+            ++_nr_free_segments;
+            return 0;
+        }
+        auto first = idx - idx % segments_per_huge_page;
+        for (size_t i = first; i < first + segments_per_huge_page; ++i) {
+            if (i != idx) {
+                _free_segments.clear(i);
+            }
+        }
+        _nr_free_segments -= segments_per_huge_page - 1;
+        unpoison(reinterpret_cast<char*>(segment_at(first)), huge_page_size);
+        ::free(segment_at(first));
+        return huge_page_size;
+    }
+    virtual size_t free_memory() const noexcept override {
+        return memory::free_memory() + _nr_free_segments * segment::size;
+    }
+    virtual bool can_allocate_more_segments(size_t non_lsa_reserve) const noexcept override {
+        return _nr_free_segments || memory::free_memory() >= non_lsa_reserve + huge_page_size;
+    }
+};
+
 static constexpr size_t segment_npos = size_t(-1);
 
 // Segments are allocated from a large contiguous memory area.
@@ -852,6 +935,10 @@ class contiguous_memory_segment_store {
         _backend = std::make_unique<standard_memory_segment_store_backend>(available_memory / segment::size);
         llogger.debug("using the standard allocator segment pool backend with {} available memory", available_memory);
     }
+    void use_huge_page_segment_pool_backend() {
+        _backend = std::make_unique<huge_page_segment_store_backend>();
+        llogger.debug("using the huge page segment pool backend");
+    }
     const segment* segment_from_idx(size_t idx) const noexcept {
         return reinterpret_cast<segment*>(_backend->segments_base()) + idx;
     }
@@ -874,9 +961,10 @@ class contiguous_memory_segment_store {
         poison(seg, sizeof(segment));
         return {seg, idx_from_segment(seg)};
     }
-    void free_segment(segment *seg) noexcept {
+    // Returns the amount of memory given back to the backend's allocator.
+    size_t free_segment(segment *seg) noexcept {
         seg->~segment();
-        _backend->free_segment_memory(seg);
+        return _backend->free_segment_memory(seg);
     }
     size_t max_segments() const noexcept {
         return (_backend->memory_layout().end - _backend->segments_base()) / segment::size;
@@ -919,6 +1007,10 @@ class segment_store {
         _segment_indexes = {};
         llogger.debug("using the standard allocator segment pool backend with {} available memory", available_memory);
     }
+    void use_huge_page_segment_pool_backend() {
+        // Segments are allocated with the default allocator, which has no notion of huge pages.
+        llogger.debug("ignoring the huge page segment pool backend with the default allocator");
+    }
     const segment* segment_from_idx(size_t idx) const noexcept {
         if (_delegate_store) {
             return _delegate_store->segment_from_idx(idx);
@@ -960,7 +1052,7 @@ class segment_store {
         _segment_indexes[seg] = ret;
         return {seg, ret};
     }
-    void free_segment(segment *seg) noexcept {
+    size_t free_segment(segment *seg) noexcept {
         if (_delegate_store) {
             return _delegate_store->free_segment(seg);
         }
@@ -969,6 +1061,7 @@ class segment_store {
         size_t i = idx_from_segment(seg);
         _segment_indexes.erase(seg);
         _segments[i] = nullptr;
+        return segment::size;
     }
     ~segment_store() {
         free_segments();
@@ -1071,6 +1164,7 @@ class segment_pool {
     logalloc::tracker::impl& tracker() { return _tracker; }
     void prime(size_t available_memory, size_t min_free_memory);
     void use_standard_allocator_segment_pool_backend(size_t available_memory);
+    void use_huge_page_segment_pool_backend();
     segment* new_segment(region::impl* r);
     const segment_descriptor& descriptor(const segment* seg) const noexcept {
         uintptr_t index = idx_from_segment(seg);
@@ -1253,8 +1347,12 @@ size_t segment_pool::reclaim_segments(size_t target, is_preemptible preempt) {
     // contiguous memory.
     size_t failed_reclaims_allowance = 10;
 
+    // When memory is given back to the store in units of several segments (e.g. huge pages),
+    // only the units released as a whole count as reclaimed, so keep going until they cover the target.
+    size_t released_memory = 0;
+
     for (size_t src_idx = _lsa_owned_segments_bitmap.find_first_set();
-            reclaimed_segments != target && src_idx != utils::dynamic_bitset::npos
+            reclaimed_segments < target && src_idx != utils::dynamic_bitset::npos
                     && _free_segments > _current_emergency_reserve_goal;
             src_idx = _lsa_owned_segments_bitmap.find_next_set(src_idx)) {
         auto src = segment_from_idx(src_idx);
@@ -1268,8 +1366,8 @@ size_t segment_pool::reclaim_segments(size_t target, is_preemptible preempt) {
         }
         _lsa_free_segments_bitmap.clear(src_idx);
         _lsa_owned_segments_bitmap.clear(src_idx);
-        _store.free_segment(src);
-        ++reclaimed_segments;
+        released_memory += _store.free_segment(src);
+        reclaimed_segments = released_memory / segment::size;
         --_free_segments;
         if (preempt && need_preempt()) {
             break;
@@ -1438,6 +1536,16 @@ void segment_pool::use_standard_allocator_segment_pool_backend(size_t available_
     _lsa_free_segments_bitmap = utils::dynamic_bitset(max_segments());
 }
 
+void segment_pool::use_huge_page_segment_pool_backend() {
+    if (_segments_in_use || _free_segments) {
+        throw std::runtime_error("cannot change segment store backend after segments are allocated");
+    }
+    _store.use_huge_page_segment_pool_backend();
+    _segments = std::vector<segment_descriptor>(max_segments());
+    _lsa_owned_segments_bitmap = utils::dynamic_bitset(max_segments());
+    _lsa_free_segments_bitmap = utils::dynamic_bitset(max_segments());
+}
+
 inline void segment_pool::on_segment_compaction(size_t used_size) noexcept {
     _stats.segments_compacted++;
     _stats.memory_compacted += used_size;
@@ -2976,6 +3084,12 @@ future<> use_standard_allocator_segment_pool_backend(size_t available_memory) {
     });
 }
 
+future<> use_huge_page_segment_pool_backend() {
+    return smp::invoke_on_all([] {
+        shard_tracker().get_impl().segment_pool().use_huge_page_segment_pool_backend();
+    });
+}
+
 }
 
 // Orders segments by free space, assuming all segments have the same size.
@@ -540,6 +540,12 @@ future<> prime_segment_pool(size_t available_memory, size_t min_free_memory);
 // Call once, when initializing the application, before any LSA allocation takes place.
 future<> use_standard_allocator_segment_pool_backend(size_t available_memory);
 
+// Allocate segments in huge page sized chunks, to reduce TLB misses on access to LSA memory.
+//
+// Has no effect with the default allocator (debug mode).
+// Call once, when initializing the application, before any LSA allocation takes place.
+future<> use_huge_page_segment_pool_backend();
+
 }
 
 template <> struct fmt::formatter<logalloc::occupancy_stats> : fmt::formatter<string_view> {
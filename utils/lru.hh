@@ -115,6 +115,15 @@ class lru {
         }
     }
 
+    // Like add(e), but places e at the least recently used end, so that it is evicted
+    // before anything else in the absence of later touches.
+    void add_front(evictable& e) noexcept {
+        _list.push_front(e);
+        if (e.is_index()) {
+            _index_list.push_front(static_cast<index_evictable&>(e));
+        }
+    }
+
     // Like add(e) but makes sure that e is evicted right before "more_recent" in the absence of later touches.
     void add_before(evictable& more_recent, evictable& e) noexcept {
         _list.insert(_list.iterator_to(more_recent), e);